@@ -0,0 +1,601 @@
+// Headless benchmark runner (built by `make bench` in build/).
+//
+// Measures whole-program simulation throughput of Computer_3bit_v1 in each
+// evaluation mode and on the instruction-level ISA_Simulator, plus a set of
+// component microbenchmarks, and prints the results as one JSON document so
+// runs can be diffed and tracked over time.
+//
+// Usage (from build/):
+//   ../bench [--programs DIR] [--min-time SECONDS] [--max-workers N] [--out FILE]
+//
+// The banked-memory scaling runs evaluate a wide Main_Memory and a 4096-address
+// Program_Memory with 1, 2, 4, ... up to --max-workers threads (default: the
+// number of hardware threads).
+//
+// The generic-computer runs build Computer_Generic from 3bit_v1, 4bit_v1,
+// 8bit_v1 and an 8-bit ISA with a 24-bit PC, and time construction and a
+// counting loop in tree and event-driven mode, to show how cost scales with
+// the architecture's widths.
+//
+// Every measurement repeats its workload until at least --min-time seconds
+// of timed work have accumulated (default 0.5 s). Output written by the
+// simulator itself (program listings, halt messages) is discarded.
+
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../computers/Computer_Generic.hpp"
+#include "../parts/Main_Memory.hpp"
+#include "../parts/Program_Memory.hpp"
+#include "../devices/Decoder.hpp"
+#include "../devices/Fixed_Decoder.hpp"
+#include "../devices/Fixed_Register.hpp"
+#include "../devices/Multiplier.hpp"
+#include "../devices/Multiplier_Sequential.hpp"
+#include "../devices/Register.hpp"
+#include "../utilities/isa_simulator.hpp"
+#include "../utilities/worker_pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct Bench_Result
+{
+    std::string name;
+    std::string unit;       ///< what one operation is ("tick", "evaluate", ...)
+    uint64_t    operations = 0;
+    double      seconds = 0.0;
+};
+
+static double seconds_since(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Call `batch` until min_time seconds of it have been timed.
+ * @param batch Runs some operations and returns how many it ran
+ * @param setup Optional untimed step run before every batch
+ */
+static Bench_Result run_timed(const std::string& name, const std::string& unit, double min_time,
+                              const std::function<uint64_t()>& batch,
+                              const std::function<void()>& setup = nullptr)
+{
+    Bench_Result result;
+    result.name = name;
+    result.unit = unit;
+    while (result.seconds < min_time)
+    {
+        if (setup)
+            setup();
+        Clock::time_point start = Clock::now();
+        result.operations += batch();
+        result.seconds += seconds_since(start);
+    }
+    return result;
+}
+
+// ── Whole-program throughput ──────────────────────────────────────────────────
+
+enum class Eval_Mode { TREE, COMPILED, EVENT_DRIVEN };
+
+static const char* mode_name(Eval_Mode mode)
+{
+    switch (mode)
+    {
+        case Eval_Mode::TREE:         return "tree";
+        case Eval_Mode::COMPILED:     return "compiled";
+        case Eval_Mode::EVENT_DRIVEN: return "event_driven";
+    }
+    return "";
+}
+
+/// Ticks per second of one program; halted programs are restarted (untimed).
+static bool bench_program(const std::string& path, Eval_Mode mode, double min_time, Bench_Result& result)
+{
+    Computer_3bit_v1 computer("bench");
+    if (!computer.load_program(path))
+        return false;
+    computer.prepare_run();
+    if (mode == Eval_Mode::COMPILED)
+        computer.set_compiled_evaluation(true);
+    else if (mode == Eval_Mode::EVENT_DRIVEN)
+        computer.set_event_driven_evaluation(true);
+
+    const std::string program = path.substr(path.find_last_of('/') + 1);
+    auto batch = [&computer]() -> uint64_t {
+        uint64_t ticks = 0;
+        while (ticks < 1000 && computer.clock_tick())
+            ++ticks;
+        return ticks;
+    };
+    auto restart_if_halted = [&computer]() {
+        if (computer.get_is_running())
+            return;
+        computer.reset_ram();
+        computer.reset_pc();
+    };
+    result = run_timed(program + "/" + mode_name(mode), "tick", min_time, batch, restart_if_halted);
+    return true;
+}
+
+// ── Microbenchmarks ───────────────────────────────────────────────────────────
+
+/// Drive every input of a component from one bench-owned signal array.
+static std::unique_ptr<bool[]> connect_all(Component& component)
+{
+    std::unique_ptr<bool[]> signals(new bool[component.get_num_inputs()]());
+    for (uint16_t i = 0; i < component.get_num_inputs(); ++i)
+        component.connect_input(&signals[i], i);
+    return signals;
+}
+
+static void set_bits(bool* signals, uint16_t first, uint16_t count, uint32_t value)
+{
+    for (uint16_t i = 0; i < count; ++i)
+        signals[first + i] = (value >> i) & 1;
+}
+
+static Bench_Result bench_main_memory(Main_Memory::Engine engine, const std::string& name, double min_time)
+{
+    const uint16_t address_bits = 6, data_bits = 3;
+    Main_Memory memory(address_bits, data_bits, "bench_ram", engine);
+    std::unique_ptr<bool[]> signals = connect_all(memory);
+    const uint16_t we = 3 * address_bits + data_bits;
+    signals[we + 1] = 1;  // RE_A
+    signals[we + 2] = 1;  // RE_B
+
+    uint32_t step = 0;
+    return run_timed(name, "evaluate", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 1000; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, address_bits, step);
+            set_bits(signals.get(), address_bits, address_bits, step * 7);
+            set_bits(signals.get(), 2 * address_bits, address_bits, step * 13);
+            set_bits(signals.get(), 3 * address_bits, data_bits, step);
+            signals[we] = step & 1;
+            memory.evaluate();
+        }
+        return 1000;
+    });
+}
+
+static Bench_Result bench_program_memory(bool rom_fetch, const std::string& name, double min_time)
+{
+    const uint16_t decoder_bits = 9, data_bits = 3;
+    Program_Memory memory(decoder_bits, data_bits, "bench_pm");
+    memory.set_rom_fetch_enabled(rom_fetch);
+    std::unique_ptr<bool[]> signals = connect_all(memory);
+    signals[decoder_bits + 4 * data_bits + 1] = 1;  // RE
+
+    uint32_t step = 0;
+    return run_timed(name, "evaluate", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, decoder_bits, step * 5);
+            memory.evaluate();
+        }
+        return 100;
+    });
+}
+
+static Bench_Result bench_program_memory_sparse(uint16_t decoder_bits, const std::string& name, double min_time)
+{
+    const uint16_t data_bits = 4;
+    const uint32_t program_size = 4096;
+    Program_Memory memory(decoder_bits, data_bits, "bench_sparse_pm", Program_Memory::Engine::SPARSE);
+    for (uint32_t address = 0; address < program_size; ++address)
+        memory.set_instruction(address, static_cast<uint16_t>(address & 0xF), 1, 2, 3);
+    std::unique_ptr<bool[]> signals = connect_all(memory);
+    signals[decoder_bits + 4 * data_bits + 1] = 1;  // RE
+
+    // Fetch from the program and from far outside it
+    uint32_t step = 0;
+    const uint32_t address_mask = memory.get_num_addresses() - 1;
+    return run_timed(name, "evaluate", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            const uint32_t address = (step & 1) ? (step * 5) % program_size : (step * 40503u) & address_mask;
+            set_bits(signals.get(), 0, decoder_bits, address);
+            memory.evaluate();
+        }
+        return 100;
+    });
+}
+
+// ── Banked memory scaling ─────────────────────────────────────────────────────
+
+static Bench_Result bench_main_memory_banked(uint16_t num_workers, double min_time)
+{
+    const uint16_t address_bits = 10, data_bits = 8;
+    Main_Memory memory(address_bits, data_bits, "bench_ram_banked");
+    std::unique_ptr<bool[]> signals = connect_all(memory);
+    std::unique_ptr<Worker_Pool> pool(num_workers > 1 ? new Worker_Pool(num_workers) : nullptr);
+    memory.set_worker_pool(pool.get());
+    const uint16_t we = 3 * address_bits + data_bits;
+    signals[we + 1] = 1;  // RE_A
+    signals[we + 2] = 1;  // RE_B
+
+    uint32_t step = 0;
+    return run_timed("main_memory_1024x8_banked/workers_" + std::to_string(num_workers), "evaluate", min_time,
+                     [&]() -> uint64_t {
+        for (int i = 0; i < 20; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, address_bits, step);
+            set_bits(signals.get(), address_bits, address_bits, step * 7);
+            set_bits(signals.get(), 2 * address_bits, address_bits, step * 13);
+            set_bits(signals.get(), 3 * address_bits, data_bits, step);
+            signals[we] = step & 1;
+            memory.evaluate();
+        }
+        return 20;
+    });
+}
+
+static Bench_Result bench_program_memory_banked(uint16_t num_workers, double min_time)
+{
+    const uint16_t decoder_bits = 12, data_bits = 4;
+    Program_Memory memory(decoder_bits, data_bits, "bench_pm_banked");
+    memory.set_rom_fetch_enabled(false);
+    std::unique_ptr<bool[]> signals = connect_all(memory);
+    std::unique_ptr<Worker_Pool> pool(num_workers > 1 ? new Worker_Pool(num_workers) : nullptr);
+    memory.set_worker_pool(pool.get());
+    signals[decoder_bits + 4 * data_bits + 1] = 1;  // RE
+
+    uint32_t step = 0;
+    return run_timed("program_memory_4096_banked/workers_" + std::to_string(num_workers), "evaluate", min_time,
+                     [&]() -> uint64_t {
+        for (int i = 0; i < 5; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, decoder_bits, step * 5);
+            memory.evaluate();
+        }
+        return 5;
+    });
+}
+
+static Bench_Result bench_decoder(Decoder::Structure structure, const std::string& name, double min_time)
+{
+    const uint16_t num_bits = 9;
+    Decoder decoder(num_bits, "bench_decoder", structure);
+    std::unique_ptr<bool[]> signals = connect_all(decoder);
+
+    uint32_t step = 0;
+    return run_timed(name, "evaluate", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, num_bits, step);
+            decoder.evaluate();
+        }
+        return 100;
+    });
+}
+
+static Bench_Result bench_fixed_decoder(double min_time)
+{
+    const uint16_t num_bits = 9;
+    Fixed_Decoder<num_bits> decoder("bench_fixed_decoder");
+    std::unique_ptr<bool[]> signals = connect_all(decoder);
+
+    uint32_t step = 0;
+    return run_timed("fixed_decoder_9bit", "evaluate", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, num_bits, step);
+            decoder.evaluate();
+        }
+        return 100;
+    });
+}
+
+/// Register or Fixed_Register: a write every other evaluate, read always enabled.
+template <typename Register_Type>
+static Bench_Result bench_register(Register_Type& reg, uint16_t num_bits, const std::string& name, double min_time)
+{
+    std::unique_ptr<bool[]> signals = connect_all(reg);
+    signals[num_bits + 1] = true;
+
+    uint32_t step = 0;
+    return run_timed(name, "evaluate", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, num_bits, step * 2654435761u);
+            signals[num_bits] = (step & 1) != 0;
+            reg.evaluate();
+        }
+        return 100;
+    });
+}
+
+static Bench_Result bench_multiplier(uint16_t num_bits, double min_time)
+{
+    Multiplier multiplier(num_bits, "bench_mult");
+    std::unique_ptr<bool[]> signals = connect_all(multiplier);
+    signals[2 * num_bits] = 1;  // output_enable
+
+    uint32_t step = 0;
+    return run_timed("multiplier_" + std::to_string(num_bits) + "bit", "multiply", min_time, [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, 2 * num_bits, step * 2654435761u);
+            multiplier.evaluate();
+        }
+        return 100;
+    });
+}
+
+static Bench_Result bench_multiplier_sequential(uint16_t num_bits, double min_time)
+{
+    Multiplier_Sequential multiplier(num_bits, "bench_mult_seq");
+    std::unique_ptr<bool[]> signals = connect_all(multiplier);
+    signals[2 * num_bits + 1] = 1;  // output_enable
+
+    uint32_t step = 0;
+    return run_timed("multiplier_sequential_" + std::to_string(num_bits) + "bit", "multiply", min_time,
+                     [&]() -> uint64_t {
+        for (int i = 0; i < 100; ++i, ++step)
+        {
+            set_bits(signals.get(), 0, 2 * num_bits, step * 2654435761u);
+            multiplier.start();
+            for (uint16_t cycle = 0; cycle <= num_bits && multiplier.is_busy(); ++cycle)
+                multiplier.evaluate();
+        }
+        return 100;
+    });
+}
+
+/// Instruction-level reference model running the same program (no gates).
+static bool bench_isa_simulator(const std::string& path, double min_time, Bench_Result& result)
+{
+    ISA_Simulator sim(*get_isa("3bit_v1"));
+    if (!sim.load_mc_file(path))
+        return false;
+
+    const std::string program = path.substr(path.find_last_of('/') + 1);
+    auto batch = [&sim]() -> uint64_t { return sim.run(1000000); };
+    auto restart_if_halted = [&sim]() {
+        if (sim.is_halted())
+            sim.reset();
+    };
+    result = run_timed(program + "/isa", "instruction", min_time, batch, restart_if_halted);
+    return true;
+}
+
+static Bench_Result bench_construction(double min_time)
+{
+    return run_timed("computer_3bit_v1_construction", "construct", min_time, []() -> uint64_t {
+        Computer_3bit_v1* computer = new Computer_3bit_v1("bench");
+        delete computer;
+        return 1;
+    });
+}
+
+// ── Generic computer scaling ──────────────────────────────────────────────────
+
+/// Registered ISA `key`, or 8bit_v1 widened to a 24-bit PC for "8bit_pc24".
+static ISA_Def bench_isa(const std::string& key)
+{
+    if (key != "8bit_pc24")
+        return *get_isa(key);
+    ISA_Def isa = *get_isa("8bit_v1");
+    isa.key = key;
+    isa.display_name = "8-bit v1, 24-bit PC";
+    isa.pc_bits = 24;
+    return isa;
+}
+
+static Bench_Result bench_generic_construction(const std::string& key, double min_time)
+{
+    const ISA_Def isa = bench_isa(key);
+    return run_timed("generic_" + key + "_construction", "construct", min_time, [&isa]() -> uint64_t {
+        Computer_Generic* computer = new Computer_Generic(isa, "bench");
+        delete computer;
+        return 1;
+    });
+}
+
+/// Ticks per second of an endless MOVL/ADD/CMP/JEQ counting loop (batches of
+/// 100 ticks: a gate-level 8-bit RAM takes milliseconds per tick).
+static Bench_Result bench_generic_ticks(const std::string& key, Eval_Mode mode, double min_time)
+{
+    Computer_Generic computer(bench_isa(key), "bench");
+    computer.load_image({
+        { 0b001, 1, 0, 1 },   // MOVL [0:1] = 1
+        { 0b010, 0, 1, 0 },   // ADD  [0] += [1]
+        { 0b100, 0, 0, 0 },   // CMP  [0] vs [0:0]
+        { 0b101, 0, 0, 1 },   // JEQ  1
+    });
+    computer.prepare_run();
+    if (mode == Eval_Mode::EVENT_DRIVEN)
+        computer.set_event_driven_evaluation(true);
+
+    auto batch = [&computer]() -> uint64_t {
+        uint64_t ticks = 0;
+        while (ticks < 100 && computer.clock_tick())
+            ++ticks;
+        return ticks;
+    };
+    auto restart_if_halted = [&computer]() {
+        if (computer.get_is_running())
+            return;
+        computer.reset_ram();
+        computer.reset_pc();
+    };
+    return run_timed("generic_" + key + "/" + mode_name(mode), "tick", min_time, batch, restart_if_halted);
+}
+
+// ── JSON output ───────────────────────────────────────────────────────────────
+
+static std::string json_escape(const std::string& text)
+{
+    std::string escaped;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+static void write_results(std::ostream& out, const std::vector<Bench_Result>& programs,
+                          const std::vector<Bench_Result>& micro, double min_time)
+{
+    char timestamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    auto write_list = [&out](const std::vector<Bench_Result>& results) {
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Bench_Result& r = results[i];
+            const double per_second = r.seconds > 0 ? r.operations / r.seconds : 0.0;
+            const double ns_per_op = r.operations > 0 ? 1e9 * r.seconds / r.operations : 0.0;
+            out << "    {\"name\": \"" << json_escape(r.name) << "\", \"unit\": \"" << r.unit
+                << "\", \"operations\": " << r.operations
+                << ", \"seconds\": " << r.seconds
+                << ", \"per_second\": " << per_second
+                << ", \"ns_per_op\": " << ns_per_op << "}"
+                << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+    };
+
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"schema_version\": 1,\n";
+    out << "  \"timestamp\": \"" << timestamp << "\",\n";
+#ifdef __VERSION__
+    out << "  \"compiler\": \"" << json_escape(__VERSION__) << "\",\n";
+#endif
+    out << "  \"min_time\": " << min_time << ",\n";
+    out << "  \"programs\": [\n";
+    write_list(programs);
+    out << "  ],\n";
+    out << "  \"micro\": [\n";
+    write_list(micro);
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// ── Main ──────────────────────────────────────────────────────────────────────
+
+int main(int argc, char** argv)
+{
+    std::string programs_dir = "../programs/3bit_v1";
+    std::string out_path;
+    double min_time = 0.5;
+    uint16_t max_workers = static_cast<uint16_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--programs" && i + 1 < argc)
+            programs_dir = argv[++i];
+        else if (arg == "--min-time" && i + 1 < argc)
+            min_time = std::atof(argv[++i]);
+        else if (arg == "--max-workers" && i + 1 < argc)
+            max_workers = static_cast<uint16_t>(std::max(1, std::atoi(argv[++i])));
+        else if (arg == "--out" && i + 1 < argc)
+            out_path = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--programs DIR] [--min-time SECONDS] [--max-workers N] [--out FILE]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    // Silence the simulator's own console output while measuring
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+
+    std::vector<Bench_Result> programs;
+    bool programs_ok = true;
+    for (const char* program : { "pong.mc", "long_mult.mc", "running_LEDs.mc" })
+    {
+        const std::string path = programs_dir + "/" + program;
+        bool loaded = true;
+        for (Eval_Mode mode : { Eval_Mode::TREE, Eval_Mode::COMPILED, Eval_Mode::EVENT_DRIVEN })
+        {
+            Bench_Result result;
+            loaded = bench_program(path, mode, min_time, result);
+            if (!loaded)
+                break;
+            programs.push_back(result);
+        }
+        Bench_Result result;
+        if (loaded)
+            loaded = bench_isa_simulator(path, min_time, result);
+        if (!loaded)
+        {
+            std::cerr << "Error: bench - could not load " << path << std::endl;
+            programs_ok = false;
+            continue;
+        }
+        programs.push_back(result);
+    }
+
+    std::vector<Bench_Result> micro;
+    micro.push_back(bench_main_memory(Main_Memory::Engine::GATE_LEVEL, "main_memory_gate_level", min_time));
+    micro.push_back(bench_main_memory(Main_Memory::Engine::WORD_LEVEL, "main_memory_word_level", min_time));
+    micro.push_back(bench_program_memory(true, "program_memory_rom_fetch", min_time));
+    micro.push_back(bench_program_memory(false, "program_memory_gate_level", min_time));
+    micro.push_back(bench_program_memory_sparse(9, "program_memory_sparse_9bit", min_time));
+    micro.push_back(bench_program_memory_sparse(24, "program_memory_sparse_24bit", min_time));
+    micro.push_back(bench_decoder(Decoder::Structure::FLAT, "decoder_9bit", min_time));
+    micro.push_back(bench_decoder(Decoder::Structure::PREDECODED, "decoder_predecoded_9bit", min_time));
+    micro.push_back(bench_fixed_decoder(min_time));
+    {
+        Register runtime_register(16, "bench_register");
+        Fixed_Register<16> fixed_register("bench_fixed_register");
+        micro.push_back(bench_register(runtime_register, 16, "register_16bit", min_time));
+        micro.push_back(bench_register(fixed_register, 16, "fixed_register_16bit", min_time));
+    }
+    micro.push_back(bench_multiplier(8, min_time));
+    micro.push_back(bench_multiplier_sequential(8, min_time));
+    micro.push_back(bench_construction(min_time));
+    for (const char* key : { "3bit_v1", "4bit_v1", "8bit_v1", "8bit_pc24" })
+    {
+        micro.push_back(bench_generic_construction(key, min_time));
+        micro.push_back(bench_generic_ticks(key, Eval_Mode::TREE, min_time));
+        micro.push_back(bench_generic_ticks(key, Eval_Mode::EVENT_DRIVEN, min_time));
+    }
+    // Powers of two below max_workers, then max_workers itself
+    std::vector<uint16_t> worker_counts;
+    for (uint32_t workers = 1; workers < max_workers; workers *= 2)
+        worker_counts.push_back(static_cast<uint16_t>(workers));
+    worker_counts.push_back(max_workers);
+    for (uint16_t workers : worker_counts)
+    {
+        micro.push_back(bench_main_memory_banked(workers, min_time));
+        micro.push_back(bench_program_memory_banked(workers, min_time));
+    }
+
+    std::cout.rdbuf(console);
+
+    if (out_path.empty())
+    {
+        write_results(std::cout, programs, micro, min_time);
+    }
+    else
+    {
+        std::ofstream out(out_path);
+        if (!out)
+        {
+            std::cerr << "Error: bench - could not open " << out_path << std::endl;
+            return 1;
+        }
+        write_results(out, programs, micro, min_time);
+    }
+    return programs_ok ? 0 : 2;
+}
@@ -1,21 +1,15 @@
 #include "AND_Gate.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 
 AND_Gate::AND_Gate(uint16_t num_inputs_param, const std::string& name)
     : Component(name)
 {
     num_inputs = num_inputs_param;
-    // create component name string (include hex address and optional provided name)
-    std::ostringstream oss;
-    oss << "AND_Gate 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
-    component_name = oss.str();
+    // get_component_name() formats "AND_Gate 0x<address> - name" on demand
+    class_name = "AND_Gate";
     num_outputs = 1;
     initialize_IO_arrays();
 }
@@ -26,11 +20,21 @@ AND_Gate::~AND_Gate()
 
 void AND_Gate::evaluate()
 {
+    Profiler::Scope profile_scope(this);
+    if (inputs_verified)
+    {
+        // All inputs proven connected when compiled (Netlist::Scope): no checks
+        bool result = true;
+        for (uint16_t i = 0; i < num_inputs; ++i)
+            result &= *inputs[i];
+        outputs[0] = result;
+        return;
+    }
     // AND all input bits together
     outputs[0] = true;
     for (uint16_t i = 0; i < num_inputs; ++i) {
         if (inputs[i] == nullptr) {
-            std::cerr << "Error: " << component_name << " - input[" << i << "] not connected" << std::endl;
+            Console::err() << "Error: " << get_component_name() << " - input[" << i << "] not connected" << std::endl;
             outputs[0] = false; // Set output to false if any input is not connected
             return;
         }
@@ -38,3 +42,8 @@ void AND_Gate::evaluate()
     }
 }
 
+void AND_Gate::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    netlist.emit(Netlist::Op_Type::AND, inputs, num_inputs, &outputs[0]);
+}
@@ -7,6 +7,7 @@ public:
     AND_Gate(uint16_t num_inputs = 2, const std::string& name = "");
     ~AND_Gate() override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
 };
 
 
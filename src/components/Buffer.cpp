@@ -1,19 +1,14 @@
 #include "Buffer.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 
 Buffer::Buffer(uint16_t num_inputs_param, const std::string& name)
     : Component(name)
 {
     num_inputs = num_inputs_param;
-    std::ostringstream oss;
-    oss << "Buffer 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Buffer";
     num_outputs = num_inputs;
     initialize_IO_arrays();
 }
@@ -24,13 +19,29 @@ Buffer::~Buffer()
 
 void Buffer::evaluate()
 {
+    Profiler::Scope profile_scope(this);
+    if (inputs_verified)
+    {
+        // All inputs proven connected when compiled (Netlist::Scope): no checks
+        for (uint16_t i = 0; i < num_inputs; ++i)
+            outputs[i] = *inputs[i];
+        return;
+    }
     // Pass through: Output[i] = Input[i]
     for (uint16_t i = 0; i < num_inputs; ++i) {
         if (inputs[i] == nullptr) {
-            std::cerr << "Error: " << component_name << " - input[" << i << "] not connected" << std::endl;
+            Console::err() << "Error: " << get_component_name() << " - input[" << i << "] not connected" << std::endl;
             return;
         }
         outputs[i] = *inputs[i];
     }
 }
 
+void Buffer::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t i = 0; i < num_inputs; ++i)
+    {
+        netlist.emit(Netlist::Op_Type::BUF, &inputs[i], 1, &outputs[i]);
+    }
+}
@@ -7,6 +7,7 @@ public:
     Buffer(uint16_t num_inputs = 1, const std::string& name = "");
     ~Buffer() override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
 };
 
 
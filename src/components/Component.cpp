@@ -1,28 +1,87 @@
 #include "Component.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/signal_arena.hpp"
 #include <iostream>
+#include <sstream>
 
-Component::Component(const std::string& name)
+Component::Component(const std::string& name) : given_name(name)
 {
-    if (!name.empty())
-    {
-        component_name = name;
-    }
 }
 
 Component::~Component()
 {
+    if (io_in_arena)
+        return;
     if (inputs != nullptr)
         delete[] inputs;
     if (outputs != nullptr)
         delete[] outputs;
 }
 
+// ── Allocation ────────────────────────────────────────────────────────────────
+
+namespace
+{
+    /// Sits in front of every component allocated with new; keeps the object max-aligned.
+    struct alignas(alignof(std::max_align_t)) Allocation_Header
+    {
+        bool in_arena;
+    };
+
+    void* allocate_component(size_t size)
+    {
+        const size_t total = sizeof(Allocation_Header) + size;
+        Signal_Arena* arena = Signal_Arena::get_current();
+        Allocation_Header* header = static_cast<Allocation_Header*>(
+            arena ? arena->allocate_object(total) : ::operator new(total));
+        header->in_arena = arena != nullptr;
+        return header + 1;
+    }
+
+    void release_component(void* object)
+    {
+        if (object == nullptr)
+            return;
+        Allocation_Header* header = static_cast<Allocation_Header*>(object) - 1;
+        if (!header->in_arena)
+            ::operator delete(header);
+    }
+}
+
+void* Component::operator new(size_t size)
+{
+    return allocate_component(size);
+}
+
+void* Component::operator new[](size_t size)
+{
+    return allocate_component(size);
+}
+
+void Component::operator delete(void* object) noexcept
+{
+    release_component(object);
+}
+
+void Component::operator delete[](void* object) noexcept
+{
+    release_component(object);
+}
+
 void Component::evaluate()
 {
     // Default implementation does nothing
     // Leaf components override this for their logic
 }
 
+void Component::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // No gate-level description: fall back to calling evaluate()
+    netlist.emit_opaque(this);
+}
+
 // void Component::update()
 // {
 //     // Default update: evaluate this component and propagate to downstream components.
@@ -36,7 +95,7 @@ void Component::evaluate()
 
 void Component::print_outputs() const
 {
-    std::cout << component_name << " outputs: ";
+    std::cout << get_component_name() << " outputs: ";
     for (uint16_t i = 0; i < num_outputs; ++i)
     {
         std::cout << outputs[i];
@@ -61,7 +120,7 @@ bool* Component::get_outputs() const
 
 void Component::print_inputs() const
 {
-    std::cout << component_name << " inputs: ";
+    std::cout << get_component_name() << " inputs: ";
     for (uint16_t i = 0; i < num_inputs; ++i)
     {
         if (inputs[i])
@@ -85,42 +144,81 @@ void Component::print_io() const
 
 void Component::set_component_name(const std::string& name)
 {
-    component_name = name;
+    given_name = name;
+    name_parent = nullptr;
 }
 
-void Component::initialize_IO_arrays()
+void Component::set_name_parent(const Component* parent, uint32_t index)
 {
-    // Allocate input pointers
-    if (num_inputs > 0)
-    {
-        inputs = new bool*[num_inputs];
-        for (uint16_t i = 0; i < num_inputs; ++i)
-        {
-            inputs[i] = nullptr;
-        }
-    }
-    else
-    {
-        inputs = nullptr;
-    }
-    
-    // Allocate outputs
-    if (num_outputs > 0)
-    {
-        outputs = new bool[num_outputs];
-        for (uint16_t i = 0; i < num_outputs; ++i)
-        {
-            outputs[i] = false;
-        }
-    }
-    else
+    name_parent = parent;
+    name_index = index;
+}
+
+std::string Component::get_given_name() const
+{
+    if (name_parent)
+        return name_parent->child_name(name_index);
+    return given_name;
+}
+
+std::string Component::get_component_name() const
+{
+    std::string given = get_given_name();
+    if (!class_name)
+        return given.empty() ? std::string("component") : given;
+
+    std::ostringstream oss;
+    oss << class_name << " 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
+    if (!given.empty())
     {
-        outputs = nullptr;
+        oss << " - " << given;
     }
+    return oss.str();
+}
+
+size_t Component::get_owned_bytes() const
+{
+    static const size_t inline_name_capacity = std::string().capacity();
+    size_t bytes = num_inputs * sizeof(bool*) + num_outputs * sizeof(bool);
+    if (given_name.capacity() > inline_name_capacity)
+        bytes += given_name.capacity() + 1;
+    bytes += downstream_components.capacity() * sizeof(Component*);
+    return bytes;
+}
+
+std::string Component::child_name(uint32_t index) const
+{
+    (void)index;
+    return std::string();
+}
+
+void Component::for_each_child(const std::function<void(Component&)>& visit)
+{
+    (void)visit;
+}
+
+void Component::initialize_IO_arrays()
+{
+    _allocate_IO_storage();
 }
 
 void Component::allocate_IO_arrays()
 {
+    _allocate_IO_storage();
+}
+
+void Component::_allocate_IO_storage()
+{
+    Signal_Arena* arena = Signal_Arena::get_current();
+    if (arena != nullptr)
+    {
+        // Arena blocks are zero-filled: inputs start unconnected, outputs low
+        inputs = (num_inputs > 0) ? arena->allocate_pointers(num_inputs) : nullptr;
+        outputs = (num_outputs > 0) ? arena->allocate_signals(num_outputs, output_net) : nullptr;
+        io_in_arena = true;
+        return;
+    }
+
     // Allocate input pointers
     if (num_inputs > 0)
     {
@@ -135,7 +233,7 @@ void Component::allocate_IO_arrays()
         inputs = nullptr;
     }
     
-    // Allocate outputs (without initializing values)
+    // Allocate outputs
     if (num_outputs > 0)
     {
         outputs = new bool[num_outputs];
@@ -154,25 +252,42 @@ bool Component::connect_input(const bool* const upstream_output_p, uint16_t inpu
 {
     if (input_index >= num_inputs)
     {
-        std::cerr << "Error: " << component_name << " - input index " << input_index 
+        Console::err() << "Error: " << get_component_name() << " - input index " << input_index 
                   << " out of range (max: " << num_inputs - 1 << ")" << std::endl;
         return false;
     }
     inputs[input_index] = const_cast<bool*>(upstream_output_p);
+    if (upstream_output_p == nullptr)
+        inputs_verified = false;
     return true;
 }
 
+bool Component::verify_inputs()
+{
+    bool connected = true;
+    for (uint16_t i = 0; i < num_inputs; ++i)
+    {
+        if (inputs[i] == nullptr)
+        {
+            Console::err() << "Error: " << get_component_name() << " - input[" << i << "] not connected" << std::endl;
+            connected = false;
+        }
+    }
+    inputs_verified = connected;
+    return connected;
+}
+
 bool Component::connect_output(Component* const downstream_component_p, uint16_t output_index, uint16_t downstream_index)
 {
     if (!downstream_component_p)
     {
-        std::cerr << "Error: " << component_name << " - downstream component pointer is null" << std::endl;
+        Console::err() << "Error: " << get_component_name() << " - downstream component pointer is null" << std::endl;
         return false;
     }
     
     if (output_index >= num_outputs)
     {
-        std::cerr << "Error: " << component_name << " - output index " << output_index 
+        Console::err() << "Error: " << get_component_name() << " - output index " << output_index 
                   << " out of range (max: " << num_outputs - 1 << ")" << std::endl;
         return false;
     }
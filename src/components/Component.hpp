@@ -1,9 +1,13 @@
 #pragma once
 
 #include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 
+class Netlist;
+
 /**
  * @brief Abstract base class for all logic components
  * 
@@ -25,6 +29,18 @@ public:
      */
     virtual ~Component();
 
+    /**
+     * @brief Places components created with `new` in the active Signal_Arena
+     * 
+     * With no arena active this is an ordinary heap allocation. A small
+     * header in front of the object records which one it was, so `delete`
+     * works the same either way (arena memory is released with the arena).
+     */
+    static void* operator new(size_t size);
+    static void* operator new[](size_t size);
+    static void operator delete(void* object) noexcept;
+    static void operator delete[](void* object) noexcept;
+
     /**
      * @brief Runs internal calculations and updates outputs based on current inputs
      * 
@@ -33,6 +49,29 @@ public:
      */
     virtual void evaluate();
     
+    /**
+     * @brief Appends the primitive gate operations performed by evaluate() to a netlist
+     * 
+     * Overrides must emit ops in the same order evaluate() performs them so that
+     * one pass over the netlist reproduces one evaluate(). The default emits an
+     * opaque call to evaluate(), so components without an override still work.
+     * 
+     * @param netlist Netlist to append to
+     */
+    virtual void compile(Netlist& netlist);
+    
+    /**
+     * @brief Calls `visit` on each component this one owns
+     * 
+     * Covers children held by value and by pointer, whether or not compile()
+     * reaches them, but not grandchildren: callers recurse. Memory_Footprint
+     * and Computer::verify_connections() walk the component tree this way.
+     * The default visits nothing, which is right for leaf components.
+     * 
+     * @param visit Called once per direct child
+     */
+    virtual void for_each_child(const std::function<void(Component&)>& visit);
+    
     /**
      * @brief Calls evaluate() and signals all downstream components to update themselves
      * 
@@ -60,6 +99,36 @@ public:
      */
     virtual bool connect_output(Component* const downstream_component_p, uint16_t output_index, uint16_t downstream_index);
     
+    /**
+     * @brief Checks whether an input has an upstream signal attached
+     * 
+     * @param input_index Index of the input to check
+     * @return true if the input is connected, false if it is nullptr or out of range
+     */
+    bool is_input_connected(uint16_t input_index) const
+    {
+        return input_index < num_inputs && inputs[input_index] != nullptr;
+    }
+    
+    /**
+     * @brief Records whether every input is known to be connected
+     * 
+     * Set by Netlist::Scope when compile() finds all inputs attached, and by
+     * Computer::verify_connections() for every component it owns. While it
+     * is set, the primitive gates skip their per-input nullptr checks in
+     * evaluate(). connect_input() clears it when an input is disconnected.
+     * 
+     * @param verified true if every input is connected
+     */
+    void set_inputs_verified(bool verified) { inputs_verified = verified; }
+    
+    /**
+     * @brief Gets whether evaluate() may skip its unconnected-input checks
+     * 
+     * @return true if every input was verified connected and none has been detached since
+     */
+    bool get_inputs_verified() const { return inputs_verified; }
+    
     /**
      * @brief Gets the value of a specific output
      * 
@@ -75,6 +144,13 @@ public:
      */
     bool* get_outputs() const;
     
+    /**
+     * @brief Gets the arena net index of output 0 (outputs have consecutive indices)
+     * 
+     * @return Net index, or Signal_Arena::NO_NET if this component's IO was heap-allocated
+     */
+    uint32_t get_output_net() const { return output_net; }
+    
     /**
      * @brief Prints all outputs of this component to standard output
      */
@@ -105,18 +181,68 @@ public:
     uint16_t get_num_outputs() const { return num_outputs; }
     
     /**
-     * @brief Sets the name identifier for this component
+     * @brief Sets the given name of this component (the part after " - ")
      * 
      * @param name The new name for this component
      */
     void set_component_name(const std::string& name);
     
+    /**
+     * @brief Names this component after a parent, without building a string
+     * 
+     * The given name becomes parent->child_name(index), formatted only when
+     * it is asked for. Used by composites that create many children, so a
+     * Computer's tens of thousands of gates carry no name strings.
+     * 
+     * @param parent Component whose child_name() names this one (must outlive it)
+     * @param index Index the parent understands, e.g. the bit position
+     */
+    void set_name_parent(const Component* parent, uint32_t index);
+    
     /**
      * @brief Gets the name identifier for this component
      * 
+     * Built on demand: "Class 0x<address>" or "Class 0x<address> - given name"
+     * (just the given name, or "component", for classes without a class name).
+     * 
      * @return The component's name
      */
-    const std::string& get_component_name() const { return component_name; }
+    std::string get_component_name() const;
+    
+    /**
+     * @brief Gets the name passed to the constructor or derived from the parent
+     * 
+     * @return The given name, empty if there is none
+     */
+    std::string get_given_name() const;
+    
+    /**
+     * @brief Gets the class name used in get_component_name()
+     * 
+     * @return The class name, or nullptr if this class does not set one
+     */
+    const char* get_class_name() const { return class_name; }
+    
+    /**
+     * @brief Gets the size of this object, members held by value included
+     * 
+     * Classes that add data members override this with sizeof(*this) so the
+     * most-derived size is reported.
+     * 
+     * @return Object size in bytes
+     */
+    virtual size_t get_object_size() const { return sizeof(*this); }
+    
+    /**
+     * @brief Gets the heap and arena bytes this component owns outside its object
+     * 
+     * Counts the IO arrays, the name string and the downstream list;
+     * composites add their pointer arrays and vectors. Child components are
+     * not included (Memory_Footprint reaches them through for_each_child()).
+     * 
+     * @return Owned bytes
+     */
+    virtual size_t get_owned_bytes() const;
 
 protected:
     /**
@@ -134,9 +260,51 @@ protected:
     void allocate_IO_arrays();
 
     /**
-     * @brief Name identifier for this component
+     * @brief Allocates inputs (nullptr) and outputs (low) from the active
+     *        Signal_Arena if there is one, otherwise from the heap
+     */
+    void _allocate_IO_storage();
+
+    /**
+     * @brief Checks every input once, reporting each unconnected one
+     * 
+     * Sets inputs_verified when all inputs are connected, so evaluate() can
+     * call this only while the flag is clear (the fixed-width devices do).
+     * 
+     * @return true if every input is connected
+     */
+    bool verify_inputs();
+
+    /**
+     * @brief Given name of the child named with set_name_parent(this, index)
+     * 
+     * Composites that name their children by index override this; the
+     * default is no name.
+     * 
+     * @param index Index passed to set_name_parent()
+     * @return The child's given name
      */
-    std::string component_name = "component";
+    virtual std::string child_name(uint32_t index) const;
+
+    /**
+     * @brief Class name for get_component_name(), a string literal set by the constructor
+     */
+    const char* class_name = nullptr;
+    
+    /**
+     * @brief Name passed to the constructor (unused while name_parent is set)
+     */
+    std::string given_name;
+    
+    /**
+     * @brief Parent whose child_name(name_index) is this component's given name, if any
+     */
+    const Component* name_parent = nullptr;
+    
+    /**
+     * @brief Index of this component in name_parent's child_name()
+     */
+    uint32_t name_index = 0;
     
     /**
      * @brief Number of inputs for this component
@@ -160,6 +328,21 @@ protected:
      */
     bool* outputs = nullptr;
     
+    /**
+     * @brief Arena net index of outputs[0] (UINT32_MAX when not arena-allocated)
+     */
+    uint32_t output_net = UINT32_MAX;
+    
+    /**
+     * @brief True if inputs/outputs live in a Signal_Arena (not deleted by this component)
+     */
+    bool io_in_arena = false;
+    
+    /**
+     * @brief True if every input was verified connected (see set_inputs_verified)
+     */
+    bool inputs_verified = false;
+    
     /**
      * @brief Pointers to downstream components that depend on this component's outputs
      */
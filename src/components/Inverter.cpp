@@ -1,20 +1,15 @@
 #include "Inverter.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 
 Inverter::Inverter(uint16_t num_inputs_param, const std::string& name)
     : Component(name)
 {
     num_inputs = num_inputs_param;
-    // create component name string (include hex address and optional provided name)
-    std::ostringstream oss;
-    oss << "Inverter 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    // get_component_name() formats "Inverter 0x<address> - name" on demand
+    class_name = "Inverter";
     num_outputs = num_inputs;
     initialize_IO_arrays();
 }
@@ -25,13 +20,29 @@ Inverter::~Inverter()
 
 void Inverter::evaluate()
 {
+    Profiler::Scope profile_scope(this);
+    if (inputs_verified)
+    {
+        // All inputs proven connected when compiled (Netlist::Scope): no checks
+        for (uint16_t i = 0; i < num_inputs; ++i)
+            outputs[i] = !*inputs[i];
+        return;
+    }
     // Invert each bit: Output[i] = NOT Input[i]
     for (uint16_t i = 0; i < num_inputs; ++i) {
         if (inputs[i] == nullptr) {
-            std::cerr << "Error: " << component_name << " - input[" << i << "] not connected" << std::endl;
+            Console::err() << "Error: " << get_component_name() << " - input[" << i << "] not connected" << std::endl;
             return;
         }
         outputs[i] = !(*inputs[i]);
     }
 }
 
+void Inverter::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t i = 0; i < num_inputs; ++i)
+    {
+        netlist.emit(Netlist::Op_Type::NOT, &inputs[i], 1, &outputs[i]);
+    }
+}
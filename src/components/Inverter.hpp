@@ -7,6 +7,7 @@ public:
     Inverter(uint16_t num_inputs = 1, const std::string& name = "");
     ~Inverter() override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
 };
 
 
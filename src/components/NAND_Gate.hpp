@@ -7,6 +7,7 @@ public:
     NAND_Gate(uint16_t num_inputs = 2, const std::string& name = "");
     ~NAND_Gate() override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
 };
 
 
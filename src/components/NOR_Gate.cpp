@@ -1,20 +1,15 @@
 #include "NOR_Gate.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 
 NOR_Gate::NOR_Gate(uint16_t num_inputs_param, const std::string& name)
     : Component(name)
 {
     num_inputs = num_inputs_param;
-    // create component name string (include hex address and optional provided name)
-    std::ostringstream oss;
-    oss << "NOR_Gate 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    // get_component_name() formats "NOR_Gate 0x<address> - name" on demand
+    class_name = "NOR_Gate";
     num_outputs = 1;
     initialize_IO_arrays();
 }
@@ -25,11 +20,21 @@ NOR_Gate::~NOR_Gate()
 
 void NOR_Gate::evaluate()
 {
+    Profiler::Scope profile_scope(this);
+    if (inputs_verified)
+    {
+        // All inputs proven connected when compiled (Netlist::Scope): no checks
+        bool result = false;
+        for (uint16_t i = 0; i < num_inputs; ++i)
+            result |= *inputs[i];
+        outputs[0] = !result;
+        return;
+    }
     // NOR: NOT(OR all bits together)
     bool result = false;
     for (uint16_t i = 0; i < num_inputs; ++i) {
         if (inputs[i] == nullptr) {
-            std::cerr << "Error: " << component_name << " - input[" << i << "] not connected" << std::endl;
+            Console::err() << "Error: " << get_component_name() << " - input[" << i << "] not connected" << std::endl;
             return;
         }
         result = result || (*inputs[i]);
@@ -37,3 +42,8 @@ void NOR_Gate::evaluate()
     outputs[0] = !result;
 }
 
+void NOR_Gate::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    netlist.emit(Netlist::Op_Type::NOR, inputs, num_inputs, &outputs[0]);
+}
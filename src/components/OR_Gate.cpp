@@ -1,20 +1,15 @@
 #include "OR_Gate.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 
 OR_Gate::OR_Gate(uint16_t num_inputs_param, const std::string& name)
     : Component(name)
 {
     num_inputs = num_inputs_param;
-    // create component name string (include hex address and optional provided name)
-    std::ostringstream oss;
-    oss << "OR_Gate 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    // get_component_name() formats "OR_Gate 0x<address> - name" on demand
+    class_name = "OR_Gate";
     num_outputs = 1;
     initialize_IO_arrays();
 }
@@ -25,14 +20,29 @@ OR_Gate::~OR_Gate()
 
 void OR_Gate::evaluate()
 {
+    Profiler::Scope profile_scope(this);
+    if (inputs_verified)
+    {
+        // All inputs proven connected when compiled (Netlist::Scope): no checks
+        bool result = false;
+        for (uint16_t i = 0; i < num_inputs; ++i)
+            result |= *inputs[i];
+        outputs[0] = result;
+        return;
+    }
     // OR all input bits together
     outputs[0] = false;
     for (uint16_t i = 0; i < num_inputs; ++i) {
         if (inputs[i] == nullptr) {
-            std::cerr << "Error: " << component_name << " - input[" << i << "] not connected" << std::endl;
+            Console::err() << "Error: " << get_component_name() << " - input[" << i << "] not connected" << std::endl;
             return;
         }
         outputs[0] = outputs[0] || (*inputs[i]);
     }
 }
 
+void OR_Gate::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    netlist.emit(Netlist::Op_Type::OR, inputs, num_inputs, &outputs[0]);
+}
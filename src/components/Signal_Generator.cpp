@@ -1,18 +1,13 @@
 #include "Signal_Generator.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 
 Signal_Generator::Signal_Generator(const std::string& name)
     : Component(name)
 {
-    std::ostringstream oss;
-    oss << "Signal_Generator 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Signal_Generator";
     num_inputs = 0;
     num_outputs = 1;
     initialize_IO_arrays();
@@ -24,6 +19,7 @@ Signal_Generator::~Signal_Generator()
 
 void Signal_Generator::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Signal generator has no inputs to evaluate
     // Output is set directly via go_high() and go_low()
 }
@@ -44,6 +40,12 @@ void Signal_Generator::go_low()
 
 bool Signal_Generator::connect_input(const bool* const upstream_output_p, uint16_t input_index)
 {
-    std::cerr << "Error: " << component_name << " does not accept any inputs" << std::endl;
+    Console::err() << "Error: " << get_component_name() << " does not accept any inputs" << std::endl;
     return false;
 }
+
+void Signal_Generator::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // Outputs are driven externally by go_high()/go_low(); nothing to emit
+}
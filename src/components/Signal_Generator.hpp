@@ -7,6 +7,7 @@ public:
     Signal_Generator(const std::string& name = "");
     ~Signal_Generator() override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
     
     /**
      * @brief Sets all outputs to high (true)
@@ -1,28 +1,18 @@
 #include "XOR_Gate.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 
 XOR_Gate::XOR_Gate(uint16_t num_inputs_param, const std::string& name)
     : Component(name)
 {
     num_inputs = num_inputs_param;
-    // create component name string (include hex address and optional provided name)
-    std::ostringstream oss;
-    oss << "XOR_Gate 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    // get_component_name() formats "XOR_Gate 0x<address> - name" on demand
+    class_name = "XOR_Gate";
     num_outputs = 1;
     
-    // Allocate inputs
-    inputs = new bool*[num_inputs];
-    for (uint16_t i = 0; i < num_inputs; ++i)
-        inputs[i] = nullptr;
-    
-    // Allocate outputs as bool array
-    outputs = new bool[num_outputs];
+    // Allocate inputs and output
+    initialize_IO_arrays();
     
     // Create buffers and inverters for each input
     // Create one num_inputs-input AND gate per input
@@ -111,6 +101,7 @@ bool XOR_Gate::connect_input(const bool* const upstream_output_p, uint16_t input
 
 void XOR_Gate::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all internal components in topological order
     // First evaluate all buffers
     for (auto buffer : input_buffers)
@@ -131,3 +122,34 @@ void XOR_Gate::evaluate()
     outputs[0] = output_or_gate->get_output(0);
 }
 
+void XOR_Gate::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // Two inputs: the one-hot network reduces to plain parity
+    if (num_inputs == 2)
+    {
+        netlist.emit(Netlist::Op_Type::XOR, inputs, num_inputs, &outputs[0]);
+        return;
+    }
+
+    // Otherwise emit the network as-is (one-hot semantics, not parity)
+    for (auto buffer : input_buffers)
+        buffer->compile(netlist);
+    for (auto inverter : input_inverters)
+        inverter->compile(netlist);
+    for (auto and_gate : and_gates)
+        and_gate->compile(netlist);
+    output_or_gate->compile(netlist);
+    netlist.emit_buffer(output_or_gate->get_outputs(), &outputs[0]);
+}
+
+void XOR_Gate::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (Buffer* buffer : input_buffers)
+        visit(*buffer);
+    for (Inverter* inverter : input_inverters)
+        visit(*inverter);
+    for (AND_Gate* and_gate : and_gates)
+        visit(*and_gate);
+    visit(*output_or_gate);
+}
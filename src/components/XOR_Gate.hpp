@@ -13,6 +13,9 @@ public:
     ~XOR_Gate() override;
     bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
 private:
     std::vector<Buffer*> input_buffers;      // one buffer per input
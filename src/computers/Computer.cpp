@@ -1,4 +1,8 @@
 #include "Computer.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -12,7 +16,7 @@ Computer::Computer(uint16_t num_bits_, uint16_t num_ram_addr_bits_,
       num_ram_address_bits(num_ram_addr_bits_),
       num_ram_addresses(static_cast<uint16_t>(1u << num_ram_addr_bits_)),
       pc_bits(pc_bits_),
-      num_pm_addresses(static_cast<uint16_t>(1u << pc_bits_)),
+      num_pm_addresses(1u << pc_bits_),
       cpu(nullptr),
       program_memory(nullptr),
       ram(nullptr),
@@ -29,8 +33,6 @@ Computer::Computer(uint16_t num_bits_, uint16_t num_ram_addr_bits_,
       ram_we_gated(nullptr),
       ram_data_mux(nullptr),
       ram_write_addr_high_mux(nullptr),
-      pm_load_addr_sigs(nullptr),
-      pm_load_data_sigs(nullptr),
       pm_zero_sigs(nullptr),
       ram_addr_sigs(nullptr),
       data_a_ptrs(nullptr),
@@ -43,16 +45,15 @@ Computer::Computer(uint16_t num_bits_, uint16_t num_ram_addr_bits_,
       pm_decoder(nullptr),
       cmp_not(nullptr),
       ram_read2_addr_mux_low(nullptr),
-      ram_read2_addr_mux_high(nullptr)
+      ram_read2_addr_mux_high(nullptr),
+      netlist(nullptr),
+      compiled_evaluation(false),
+      event_driven_evaluation(false)
 {
+    Signal_Arena::Scope arena_scope(signal_arena);
+
     // Signal generators for PM loading are sized here since pc_bits / num_bits
     // are already known. Subclass constructors do not need to create them.
-    pm_load_addr_sigs = new std::vector<Signal_Generator>();
-    pm_load_addr_sigs->resize(pc_bits);
-    
-    pm_load_data_sigs = new std::vector<Signal_Generator>();
-    pm_load_data_sigs->resize(4 * num_bits);
-    
     pm_zero_sigs = new std::vector<Signal_Generator>();
     pm_zero_sigs->resize(4 * num_bits);
     for (auto& sig : *pm_zero_sigs)
@@ -88,9 +89,16 @@ Computer::Computer(uint16_t num_bits_, uint16_t num_ram_addr_bits_,
     read_addr_high_low->go_low();
     read_addr_high_low->evaluate();
 
-    // Create page registers (initially all 0's)
+    // Create page registers (initially all 0's). Nothing drives them yet, so they
+    // hold zero: data and write enable tied low, read enable tied high.
     rampage = new Register(num_bits, "rampage");
     opcodepage = new Register(num_bits, "opcodepage");
+    for (Register* page : { rampage, opcodepage })
+    {
+        for (uint16_t i = 0; i <= num_bits; ++i)
+            page->connect_input(read_addr_high_low->get_outputs(), i);
+        page->connect_input(ram_read_enable->get_outputs(), static_cast<uint16_t>(num_bits + 1));
+    }
 }
 
 Computer::~Computer()
@@ -124,8 +132,6 @@ Computer::~Computer()
     }
     delete[] ram_write_addr_high_mux;
     
-    delete pm_load_addr_sigs;
-    delete pm_load_data_sigs;
     delete pm_zero_sigs;
     delete ram_addr_sigs;
 
@@ -134,6 +140,26 @@ Computer::~Computer()
     delete cmp_not;
     delete ram_read2_addr_mux_low;
     delete ram_read2_addr_mux_high;
+
+    delete netlist;
+    delete worker_pool;
+}
+
+size_t Computer::get_owned_bytes() const
+{
+    size_t bytes = Part::get_owned_bytes();
+    // The PM/RAM constant signals are visited as children; only the spare capacity is ours
+    for (const std::vector<Signal_Generator>* signals : { pm_zero_sigs, ram_addr_sigs })
+    {
+        if (signals)
+            bytes += (signals->capacity() - signals->size()) * sizeof(Signal_Generator);
+    }
+    if (data_a_ptrs)
+        bytes += 3 * num_bits * sizeof(const bool*);
+    if (ram_write_addr_high_mux)
+        bytes += num_bits * sizeof(AND_Gate*);
+    bytes += computer_version.capacity() + ISA_version.capacity();
+    return bytes;
 }
 
 bool Computer::load_program(const std::string& filename)
@@ -163,35 +189,31 @@ bool Computer::load_program(const std::string& filename)
         }
         if (!file.is_open())
         {
-            std::cerr << "Error: Could not open program file: " << filename << std::endl;
+            Console::err() << "Error: Could not open program file: " << filename << std::endl;
             return false;
         }
         else
         {
-            std::cout << "Opened program file: " << resolved_path << std::endl;
+            Console::out() << "Opened program file: " << resolved_path << std::endl;
         }
     }
     
-    std::cout << "Loading program from: " << filename << std::endl;
+    Console::out() << "Loading program from: " << filename << std::endl;
     
-    uint16_t address = 0;
+    std::vector<Instruction> image;
     std::string line;
-    
-    uint16_t decoder_bits      = program_memory->get_decoder_bits();
-    uint16_t data_bits         = program_memory->get_data_bits();
-    uint16_t data_inputs_start = decoder_bits;
-
-    while (std::getline(file, line) && address < num_pm_addresses)
+    while (std::getline(file, line) && image.size() < num_pm_addresses)
     {
         if (line.empty() || line[0] == '#' ||
             line.find_first_not_of(" \t\r\n") == std::string::npos)
             continue;
 
+        uint32_t address = static_cast<uint32_t>(image.size());
         std::istringstream iss(line);
         std::string opcode_str, a_str, b_str, c_str;
         if (!(iss >> opcode_str >> a_str >> b_str >> c_str))
         {
-            std::cerr << "Warning: Malformed line at address " << address
+            Console::err() << "Warning: Malformed line at address " << address
                       << ": " << line << std::endl;
             continue;
         }
@@ -204,11 +226,11 @@ bool Computer::load_program(const std::string& filename)
         if (opcode >= (1u << num_bits) || a_val >= (1u << num_bits) ||
             b_val  >= (1u << num_bits) || c_val >= (1u << num_bits))
         {
-            std::cerr << "Error: Value out of range at address " << address << std::endl;
+            Console::err() << "Error: Value out of range at address " << address << std::endl;
             continue;
         }
 
-        std::cout << "  [" << std::setw(3) << std::setfill('0') << address << "] "
+        Console::out() << "  [" << std::setw(3) << std::setfill('0') << address << "] "
                   << to_binary(opcode, num_bits) << " "
                   << to_binary(a_val,  num_bits) << " "
                   << to_binary(b_val,  num_bits) << " "
@@ -216,63 +238,70 @@ bool Computer::load_program(const std::string& filename)
                   << get_opcode_name(opcode) << " "
                   << a_val << " " << b_val << " " << c_val << std::endl;
 
-        for (uint16_t i = 0; i < decoder_bits; ++i)
-        {
-            bool bit = ((address >> i) & 1) != 0;
-            if (bit) (*pm_load_addr_sigs)[i].go_high();
-            else     (*pm_load_addr_sigs)[i].go_low();
-            (*pm_load_addr_sigs)[i].evaluate();
-            program_memory->connect_input(&(*pm_load_addr_sigs)[i].get_outputs()[0], i);
-        }
+        image.push_back({ opcode, a_val, b_val, c_val });
+    }
+
+    // Addresses past the end of the file keep their previous contents
+    for (uint32_t address = 0; address < image.size(); ++address)
+    {
+        const Instruction& instr = image[address];
+        program_memory->set_instruction(address, instr.opcode, instr.a, instr.b, instr.c);
+    }
+    _connect_pm_for_run();
+    mark_netlist_dirty();
+    program_memory->evaluate();
+    
+    Console::out() << "Loaded " << image.size() << " instructions" << std::endl;
+    file.close();
+    return true;
+}
 
-        uint16_t values[4] = { opcode, a_val, b_val, c_val };
-        for (uint16_t reg = 0; reg < 4; ++reg)
+bool Computer::load_image(const std::vector<Instruction>& image)
+{
+    if (image.size() > num_pm_addresses)
+    {
+        Console::err() << "Error: " << get_component_name() << " - program image has " << image.size()
+                  << " instructions, Program Memory holds " << num_pm_addresses << std::endl;
+        return false;
+    }
+    const uint16_t limit = static_cast<uint16_t>(1u << num_bits);
+    for (size_t address = 0; address < image.size(); ++address)
+    {
+        const Instruction& instr = image[address];
+        if (instr.opcode >= limit || instr.a >= limit || instr.b >= limit || instr.c >= limit)
         {
-            for (uint16_t b = 0; b < data_bits; ++b)
-            {
-                uint16_t idx = reg * data_bits + b;
-                bool bit = ((values[reg] >> b) & 1) != 0;
-                if (bit) (*pm_load_data_sigs)[idx].go_high();
-                else     (*pm_load_data_sigs)[idx].go_low();
-                (*pm_load_data_sigs)[idx].evaluate();
-                program_memory->connect_input(
-                    &(*pm_load_data_sigs)[idx].get_outputs()[0],
-                    static_cast<uint16_t>(data_inputs_start + idx));
-            }
+            Console::err() << "Error: " << get_component_name() << " - value out of range at address "
+                      << address << std::endl;
+            return false;
         }
-
-        pm_write_enable->go_high();
-        pm_write_enable->evaluate();
-        program_memory->evaluate();
-        pm_write_enable->go_low();
-        pm_write_enable->evaluate();
-
-        address++;
     }
 
-    bool* pc_outputs = cpu->get_pc_outputs();
-    for (uint16_t i = 0; i < pc_bits; ++i)
+    program_memory->zero_all();
+    for (uint32_t address = 0; address < image.size(); ++address)
     {
-        program_memory->connect_input(&pc_outputs[i], i);
+        const Instruction& instr = image[address];
+        program_memory->set_instruction(address, instr.opcode, instr.a, instr.b, instr.c);
     }
+    _connect_pm_for_run();
+    mark_netlist_dirty();
     program_memory->evaluate();
+    return true;
+}
 
-    // Reconnect PM data inputs to permanent zeros to prevent stale write data
-    // from corrupting subsequent memory operations
-    for (uint16_t b = 0; b < 4 * data_bits; ++b)
+void Computer::load_ram(const std::vector<uint16_t>& values)
+{
+    ram->zero_all();
+    const size_t count = std::min(values.size(), static_cast<size_t>(num_ram_addresses));
+    for (uint16_t address = 0; address < count; ++address)
     {
-        program_memory->connect_input(&(*pm_zero_sigs)[b].get_outputs()[0],
-                                      static_cast<uint16_t>(data_inputs_start + b));
+        ram->set_register_value(address, values[address]);
     }
-    
-    std::cout << "Loaded " << address << " instructions" << std::endl;
-    file.close();
-    return true;
+    mark_netlist_dirty();
 }
 
 void Computer::run(bool interactive)
 {
-    std::cout << "\n=== Starting Execution";
+    Console::out() << "\n=== Starting Execution";
 
     program_memory->evaluate();
 
@@ -280,12 +309,12 @@ void Computer::run(bool interactive)
     {
         if (interactive) // Prompt user to press Enter once per cycle
         {
-            std::cout << "\nPress Enter to continue (or 'q' to quit): ";
+            Console::out() << "\nPress Enter to continue (or 'q' to quit): ";
             std::string input;
             std::getline(std::cin, input);
             if (input == "q" || input == "Q")
             {
-                std::cout << "Execution stopped by user." << std::endl;
+                Console::out() << "Execution stopped by user." << std::endl;
                 break;
             }
         }
@@ -294,10 +323,23 @@ void Computer::run(bool interactive)
         print_state();
     }
 
-    std::cout << "\n=== Program HALTED ===" << std::endl;
+    Console::out() << "\n=== Program HALTED ===" << std::endl;
     // print_state();
 }
 
+uint64_t Computer::run_headless(uint64_t max_cycles)
+{
+    program_memory->evaluate();
+
+    uint64_t ticks = 0;
+    while (is_running && ticks < max_cycles)
+    {
+        clock_tick();
+        ++ticks;
+    }
+    return ticks;
+}
+
 bool Computer::clock_tick()
 {
     if (is_running)
@@ -306,7 +348,7 @@ bool Computer::clock_tick()
     }
     else
     {
-        std::cout << "Computer is halted. No further execution." << std::endl;
+        Console::out() << "Computer is halted. No further execution." << std::endl;
         return false;
     }
     
@@ -317,10 +359,10 @@ bool Computer::clock_tick()
 
 void Computer::print_state() const
 {
-    std::cout << "\n" << std::string(50, '=') << std::endl;
+    Console::out() << "\n" << std::string(50, '=') << std::endl;
     
-    uint16_t pc_value = program_memory->get_selected_address();
-    std::cout << "PC: " << std::setw(3) << std::setfill('0') << pc_value
+    uint32_t pc_value = program_memory->get_selected_address();
+    Console::out() << "PC: " << std::setw(3) << std::setfill('0') << pc_value
               << " (" << to_binary(pc_value, pc_bits) << ")"
               << "    Execution Count: " << execution_count << std::endl;
     
@@ -334,7 +376,7 @@ void Computer::print_state() const
         c_val  |= (pm_outputs[3 * num_bits + i] ? 1 : 0) << i;
     }
     
-    std::cout << "Instruction: "
+    Console::out() << "Instruction: "
               << to_binary(opcode, num_bits) << " "
               << to_binary(a_val,  num_bits) << " "
               << to_binary(b_val,  num_bits) << " "
@@ -348,7 +390,7 @@ void Computer::print_state() const
         bool* stored_flags = cpu->get_cmp_flags();
         if (stored_flags)
         {
-            std::cout << "Compare Flags: "
+            Console::out() << "Compare Flags: "
                       << "EQ="  << (stored_flags[0] ? '1' : '0') << ", "
                       << "NEQ=" << (stored_flags[1] ? '1' : '0') << ", "
                       << "LT_U="<< (stored_flags[2] ? '1' : '0') << ", "
@@ -361,18 +403,19 @@ void Computer::print_state() const
     ram->print_pages(8);
     ram->print_io();
     
-    std::cout << std::string(50, '=') << std::endl;
+    Console::out() << std::string(50, '=') << std::endl;
 }
 
 void Computer::reset()
 {
     // TODO: Reset PC through control unit
     // TODO: Write zeros to all RAM addresses
-    std::cout << "Computer reset to initial state" << std::endl;
+    Console::out() << "Computer reset to initial state" << std::endl;
 }
 
 void Computer::reset_pc()
 {
+    mark_netlist_dirty();
     cpu->set_run_halt_flag(true);
     cpu->reset_pc();
     is_running = true;
@@ -381,6 +424,7 @@ void Computer::reset_pc()
 
 void Computer::set_pc(uint16_t address)
 {
+    mark_netlist_dirty();
     cpu->set_run_halt_flag(true);
     cpu->set_pc(address);
     is_running = true;
@@ -389,19 +433,19 @@ void Computer::set_pc(uint16_t address)
 
 void Computer::reset_ram()
 {
+    mark_netlist_dirty();
     ram->zero_all();
 }
 
 void Computer::reset_all()
 {
+    mark_netlist_dirty();
     // Zero all RAM
     ram->zero_all();
 
     // Zero all PM instructions
-    for (uint16_t addr = 0; addr < num_pm_addresses; ++addr)
-    {
-        write_pm_instruction(addr, 0, 0, 0, 0);
-    }
+    program_memory->zero_all();
+    _connect_pm_for_run();
 
     // Reset PC to 0 and clear halt
     cpu->set_run_halt_flag(true);
@@ -412,6 +456,7 @@ void Computer::reset_all()
 
 void Computer::clear_halt()
 {
+    mark_netlist_dirty();
     cpu->set_run_halt_flag(true);
     is_running = true;
 }
@@ -427,6 +472,24 @@ void Computer::toggle_ram_read_flag(bool flag_high)
 
 void Computer::evaluate()
 {
+    Profiler::Scope profile_scope(this);
+    if (compiled_evaluation)
+    {
+        if (!netlist)
+            compile_netlist();
+        if (event_driven_evaluation)
+        {
+            netlist->evaluate_event_driven();
+        }
+        else
+        {
+            netlist->evaluate();
+            mark_netlist_dirty();
+        }
+        return;
+    }
+    mark_netlist_dirty();
+
     program_memory->evaluate();
 
     // Evaluate PM opcode decoder (if wired by subclass).
@@ -449,6 +512,10 @@ void Computer::evaluate()
 
     ram->evaluate();   // combinational reads
     cpu->evaluate();   // compute next values
+
+    // Allow subclass to evaluate ISA-specific gates before the write-data mux
+    // and write-address gates use them
+    evaluate_isa_write_gates();
     
     // Evaluate write-path logic
     // New design: a single `Multiplexer` device provides the write-data outputs.
@@ -457,9 +524,6 @@ void Computer::evaluate()
         ram_data_mux->evaluate();
     }
 
-    // Allow subclass to evaluate ISA-specific gates before write-address gates use them
-    evaluate_isa_write_gates();
-
     // Evaluate any per-bit write-address high-bit gates if allocated by subclass
     if (ram_write_addr_high_mux)
     {
@@ -477,6 +541,312 @@ void Computer::evaluate()
     ram->evaluate();   // latch writes
 }
 
+void Computer::compile_ram_read_flag(Netlist& netlist, bool flag_high)
+{
+    netlist.emit_const(ram_read_flag->get_outputs(), flag_high);
+    ram_read_flag_not->compile(netlist);
+    ram_we_gated->compile(netlist);
+}
+
+void Computer::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // Same sequence as the component-tree path of evaluate(); fetch and
+    // decode settle in the read phase, before the RAM reads that use them
+    netlist.begin_phase("read");
+    program_memory->compile(netlist);
+    if (pm_decoder)
+        pm_decoder->compile(netlist);
+    if (cmp_not)
+        cmp_not->compile(netlist);
+    if (ram_read2_addr_mux_low)
+        ram_read2_addr_mux_low->compile(netlist);
+    if (ram_read2_addr_mux_high)
+        ram_read2_addr_mux_high->compile(netlist);
+
+    // Phase 1: reads
+    compile_ram_read_flag(netlist, true);
+    ram->compile(netlist);
+    cpu->compile(netlist);
+    compile_isa_write_gates(netlist);
+    if (ram_data_mux)
+        ram_data_mux->compile(netlist);
+    if (ram_write_addr_high_mux)
+    {
+        for (uint16_t i = 0; i < num_bits; ++i)
+        {
+            if (ram_write_addr_high_mux[i])
+                ram_write_addr_high_mux[i]->compile(netlist);
+        }
+    }
+
+    // Phase 2: writes
+    netlist.begin_phase("write");
+    ram_write_or->compile(netlist);
+    compile_ram_read_flag(netlist, false);
+    ram->compile(netlist);
+}
+
+void Computer::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (Component* child : std::initializer_list<Component*>{ cpu, program_memory, ram, rampage, opcodepage,
+                                                                pm_write_enable, pm_read_enable,
+                                                                ram_write_enable, ram_read_enable,
+                                                                read_addr_high_low, ram_write_or, ram_read_flag,
+                                                                ram_read_flag_not, ram_we_gated, ram_data_mux,
+                                                                pm_decoder, cmp_not,
+                                                                ram_read2_addr_mux_low, ram_read2_addr_mux_high })
+    {
+        if (child)
+            visit(*child);
+    }
+    if (ram_write_addr_high_mux)
+    {
+        for (uint16_t i = 0; i < num_bits; ++i)
+        {
+            if (ram_write_addr_high_mux[i])
+                visit(*ram_write_addr_high_mux[i]);
+        }
+    }
+    for (std::vector<Signal_Generator>* signals : { pm_zero_sigs, ram_addr_sigs })
+    {
+        if (!signals)
+            continue;
+        for (Signal_Generator& signal : *signals)
+            visit(signal);
+    }
+}
+
+void Computer::compile_netlist()
+{
+    invalidate_netlist();
+    netlist = new Netlist();
+    compile(*netlist);
+    netlist->levelize();
+}
+
+// Netlist::Scope's check over `component` and everything it owns: each component is
+// marked verified or not, and its unconnected inputs are listed unless an enclosing
+// component is already missing one (they are then only a consequence).
+static void check_subtree_inputs(Component& component, std::vector<const Component*>& path, bool inside_dangling,
+                                 std::vector<Netlist::Dangling_Input>& dangling_inputs)
+{
+    path.push_back(&component);
+    bool dangling = false;
+    for (uint16_t i = 0; i < component.get_num_inputs(); ++i)
+    {
+        if (component.is_input_connected(i))
+            continue;
+        if (!inside_dangling)
+            dangling_inputs.push_back({ path, i });
+        dangling = true;
+    }
+    component.set_inputs_verified(!dangling);
+    component.for_each_child([&](Component& child) {
+        check_subtree_inputs(child, path, inside_dangling || dangling, dangling_inputs);
+    });
+    path.pop_back();
+}
+
+bool Computer::verify_connections()
+{
+    std::vector<Netlist::Dangling_Input> dangling_inputs;
+    std::vector<const Component*> path;
+    check_subtree_inputs(*this, path, false, dangling_inputs);
+    for (const Netlist::Dangling_Input& input : dangling_inputs)
+    {
+        Console::err() << "Error: " << get_component_name() << " - unconnected input: "
+                       << Netlist::hierarchical_name(input.path) << " input[" << input.input_index << "]" << std::endl;
+    }
+    return dangling_inputs.empty();
+}
+
+void Computer::invalidate_netlist()
+{
+    delete netlist;
+    netlist = nullptr;
+}
+
+void Computer::mark_netlist_dirty()
+{
+    if (netlist)
+        netlist->mark_all_dirty();
+}
+
+void Computer::set_event_driven_evaluation(bool enabled)
+{
+    event_driven_evaluation = enabled;
+    if (enabled)
+        compiled_evaluation = true;
+    mark_netlist_dirty();
+}
+
+void Computer::save_checkpoint(Checkpoint& checkpoint) const
+{
+    signal_arena.save_signals(checkpoint.signals);
+    checkpoint.ram_words = ram->get_words();
+    checkpoint.is_running = is_running;
+    checkpoint.execution_count = execution_count;
+}
+
+bool Computer::restore_checkpoint(const Checkpoint& checkpoint)
+{
+    if (checkpoint.ram_words.size() != ram->get_words().size() ||
+        !signal_arena.restore_signals(checkpoint.signals))
+    {
+        Console::err() << "Error: Computer - checkpoint does not match " << get_component_name() << std::endl;
+        return false;
+    }
+    ram->set_words(checkpoint.ram_words);
+    is_running = checkpoint.is_running;
+    execution_count = checkpoint.execution_count;
+    // The PM flip-flops may hold a different program than the ROM image
+    program_memory->invalidate_rom_image();
+    mark_netlist_dirty();
+    return true;
+}
+
+void Computer::set_num_workers(uint16_t num_workers)
+{
+    // Detach the memories before the old pool's threads are joined
+    program_memory->set_worker_pool(nullptr);
+    ram->set_worker_pool(nullptr);
+    delete worker_pool;
+    worker_pool = nullptr;
+
+    if (num_workers > 1)
+    {
+        worker_pool = new Worker_Pool(num_workers);
+        program_memory->set_worker_pool(worker_pool);
+        ram->set_worker_pool(worker_pool);
+    }
+}
+
+// ── Machine state ─────────────────────────────────────────────────────────────
+
+// Blob header: magic "CST", version, flip-flop count (u32), execution count (u64),
+// RAM word count (u32). The packed bits follow, then the RAM words (u16 each).
+static constexpr uint8_t STATE_MAGIC[3] = { 'C', 'S', 'T' };
+static constexpr uint8_t STATE_VERSION = 2;
+static constexpr size_t  STATE_HEADER_BYTES = 20;
+
+std::vector<uint8_t> Computer::save_state() const
+{
+    const std::vector<Flip_Flop*>& flip_flops = signal_arena.get_flip_flops();
+    const uint32_t count = static_cast<uint32_t>(flip_flops.size());
+    const std::vector<uint16_t>& words = ram->get_words();
+    const uint32_t num_words = static_cast<uint32_t>(words.size());
+    const size_t bit_bytes = (count + 1 + 7) / 8;
+
+    // Bit 0 of the packed area is the run flag, flip-flop i is bit i + 1
+    std::vector<uint8_t> state(STATE_HEADER_BYTES + bit_bytes + 2 * size_t(num_words), 0);
+    state[0] = STATE_MAGIC[0];
+    state[1] = STATE_MAGIC[1];
+    state[2] = STATE_MAGIC[2];
+    state[3] = STATE_VERSION;
+    for (int i = 0; i < 4; ++i)
+        state[4 + i] = static_cast<uint8_t>(count >> (8 * i));
+    for (int i = 0; i < 8; ++i)
+        state[8 + i] = static_cast<uint8_t>(execution_count >> (8 * i));
+    for (int i = 0; i < 4; ++i)
+        state[16 + i] = static_cast<uint8_t>(num_words >> (8 * i));
+
+    uint8_t* bits = state.data() + STATE_HEADER_BYTES;
+    if (is_running)
+        bits[0] |= 1;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (flip_flops[i]->get_output(0))
+            bits[(i + 1) / 8] |= static_cast<uint8_t>(1u << ((i + 1) % 8));
+    }
+
+    // Word-level RAM is not built from flip-flops
+    uint8_t* word_bytes = bits + bit_bytes;
+    for (uint32_t address = 0; address < num_words; ++address)
+    {
+        word_bytes[2 * address] = static_cast<uint8_t>(words[address]);
+        word_bytes[2 * address + 1] = static_cast<uint8_t>(words[address] >> 8);
+    }
+    return state;
+}
+
+bool Computer::restore_state(const std::vector<uint8_t>& state)
+{
+    const std::vector<Flip_Flop*>& flip_flops = signal_arena.get_flip_flops();
+    const uint32_t count = static_cast<uint32_t>(flip_flops.size());
+    const uint32_t num_words = static_cast<uint32_t>(ram->get_words().size());
+    const size_t bit_bytes = (count + 1 + 7) / 8;
+
+    uint32_t saved_count = 0;
+    uint32_t saved_words = 0;
+    if (state.size() >= STATE_HEADER_BYTES)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            saved_count |= static_cast<uint32_t>(state[4 + i]) << (8 * i);
+            saved_words |= static_cast<uint32_t>(state[16 + i]) << (8 * i);
+        }
+    }
+    if (state.size() != STATE_HEADER_BYTES + bit_bytes + 2 * size_t(num_words) ||
+        state[0] != STATE_MAGIC[0] || state[1] != STATE_MAGIC[1] || state[2] != STATE_MAGIC[2] ||
+        state[3] != STATE_VERSION || saved_count != count || saved_words != num_words)
+    {
+        Console::err() << "Error: Computer - state blob does not match " << get_component_name()
+                  << " (" << count << " flip-flops, " << num_words << " RAM words)" << std::endl;
+        return false;
+    }
+
+    execution_count = 0;
+    for (int i = 0; i < 8; ++i)
+        execution_count |= static_cast<uint64_t>(state[8 + i]) << (8 * i);
+
+    const uint8_t* bits = state.data() + STATE_HEADER_BYTES;
+    is_running = bits[0] & 1;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if ((bits[(i + 1) / 8] >> ((i + 1) % 8)) & 1)
+            flip_flops[i]->force_set();
+        else
+            flip_flops[i]->force_reset();
+    }
+
+    const uint8_t* word_bytes = bits + bit_bytes;
+    std::vector<uint16_t> words(num_words);
+    for (uint32_t address = 0; address < num_words; ++address)
+        words[address] = static_cast<uint16_t>(word_bytes[2 * address] | (word_bytes[2 * address + 1] << 8));
+    ram->set_words(words);
+
+    // Register outputs are read before the registers are next evaluated (the
+    // PC feeds PM), so drive them from the restored bits as set_bit() would.
+    // Gates further downstream are recomputed by the next evaluate().
+    for (Register* reg : signal_arena.get_registers())
+        reg->refresh_outputs();
+    program_memory->invalidate_rom_image();
+    mark_netlist_dirty();
+    sync_pc();
+    return true;
+}
+
+double Computer::get_activity_factor() const
+{
+    return netlist ? netlist->get_activity_factor() : 0.0;
+}
+
+void Computer::set_profiling(bool enabled)
+{
+    Profiler::set_enabled(enabled);
+}
+
+void Computer::reset_profile()
+{
+    Profiler::reset();
+}
+
+void Computer::print_profile(size_t max_rows, size_t max_depth) const
+{
+    Profiler::print_report(Console::out(), max_rows, max_depth);
+}
+
 std::string Computer::to_binary(uint16_t value, uint16_t bits) const
 {
     std::string result;
@@ -506,7 +876,12 @@ void Computer::evaluate_isa_write_gates()
     // Default no-op: subclasses may override to evaluate ISA-specific gates
 }
 
-uint16_t Computer::get_pc() const
+void Computer::compile_isa_write_gates(Netlist& netlist)
+{
+    // Default no-op: counterpart of evaluate_isa_write_gates()
+}
+
+uint32_t Computer::get_pc() const
 {
     return program_memory->get_selected_address();
 }
@@ -523,9 +898,25 @@ uint16_t Computer::read_ram(uint16_t address) const
 
 void Computer::write_ram(uint16_t address, uint16_t value)
 {
+    mark_netlist_dirty();
     ram->set_register_value(address, value);
 }
 
+const bool* Computer::get_pc_signals() const
+{
+    return cpu->get_pc_outputs();
+}
+
+const bool* Computer::get_ram_signals(uint16_t address) const
+{
+    return ram->get_register_outputs(address);
+}
+
+const bool* Computer::get_run_halt_signal() const
+{
+    return cpu->get_run_halt_flag_output();
+}
+
 void Computer::read_pm_instruction(uint16_t address, uint16_t& opcode,
                                    uint16_t& a, uint16_t& b, uint16_t& c) const
 {
@@ -535,58 +926,9 @@ void Computer::read_pm_instruction(uint16_t address, uint16_t& opcode,
 void Computer::write_pm_instruction(uint16_t address, uint16_t opcode,
                                     uint16_t a_val, uint16_t b_val, uint16_t c_val)
 {
-    uint16_t decoder_bits_     = program_memory->get_decoder_bits();
-    uint16_t data_bits_        = program_memory->get_data_bits();
-    uint16_t data_inputs_start = decoder_bits_;
-    
-    // Set address via signal generators
-    for (uint16_t i = 0; i < decoder_bits_; ++i)
-    {
-        bool bit = ((address >> i) & 1) != 0;
-        if (bit) (*pm_load_addr_sigs)[i].go_high();
-        else     (*pm_load_addr_sigs)[i].go_low();
-        (*pm_load_addr_sigs)[i].evaluate();
-        program_memory->connect_input(&(*pm_load_addr_sigs)[i].get_outputs()[0], i);
-    }
-    
-    // Set data (opcode, A, B, C) via signal generators
-    uint16_t values[4] = { opcode, a_val, b_val, c_val };
-    for (uint16_t reg = 0; reg < 4; ++reg)
-    {
-        for (uint16_t b = 0; b < data_bits_; ++b)
-        {
-            uint16_t idx = reg * data_bits_ + b;
-            bool bit = ((values[reg] >> b) & 1) != 0;
-            if (bit) (*pm_load_data_sigs)[idx].go_high();
-            else     (*pm_load_data_sigs)[idx].go_low();
-            (*pm_load_data_sigs)[idx].evaluate();
-            program_memory->connect_input(
-                &(*pm_load_data_sigs)[idx].get_outputs()[0],
-                static_cast<uint16_t>(data_inputs_start + idx));
-        }
-    }
-    
-    // Pulse write enable
-    pm_write_enable->go_high();
-    pm_write_enable->evaluate();
-    program_memory->evaluate();
-    pm_write_enable->go_low();
-    pm_write_enable->evaluate();
-    
-    // Restore PC outputs as PM address inputs
-    bool* pc_outputs = cpu->get_pc_outputs();
-    for (uint16_t i = 0; i < pc_bits; ++i)
-    {
-        program_memory->connect_input(&pc_outputs[i], i);
-    }
-    
-    // Reconnect PM data inputs to permanent zeros to prevent stale write data
-    // from corrupting subsequent writes
-    for (uint16_t b = 0; b < 4 * data_bits_; ++b)
-    {
-        program_memory->connect_input(&(*pm_zero_sigs)[b].get_outputs()[0],
-                                      static_cast<uint16_t>(data_inputs_start + b));
-    }
+    program_memory->set_instruction(address, opcode, a_val, b_val, c_val);
+    _connect_pm_for_run();
+    mark_netlist_dirty();
 }
 
 void Computer::get_current_instruction(uint16_t& opcode, uint16_t& a,
@@ -614,52 +956,58 @@ bool* Computer::get_cmp_flags() const
 
 void Computer::prepare_run()
 {
-    // Ensure PM data inputs are connected (in case no write has happened yet)
-    uint16_t decoder_bits_ = program_memory->get_decoder_bits();
-    uint16_t data_bits_    = program_memory->get_data_bits();
-    uint16_t data_start    = decoder_bits_;
-    for (uint16_t b = 0; b < 4 * data_bits_; ++b)
+    _connect_pm_for_run();
+    mark_netlist_dirty();
+    program_memory->evaluate();
+    is_running = true;
+    execution_count = 0;
+}
+
+void Computer::_connect_pm_for_run()
+{
+    // Nothing rewires PM after this, so the wiring (and any netlist built on it) stays valid
+    if (pm_run_wired)
+        return;
+    invalidate_netlist();
+
+    // PM data inputs tied to permanent zeros so nothing can be written while running
+    uint16_t data_start = program_memory->get_decoder_bits();
+    for (uint16_t b = 0; b < 4 * program_memory->get_data_bits(); ++b)
     {
         program_memory->connect_input(&(*pm_zero_sigs)[b].get_outputs()[0],
                                       static_cast<uint16_t>(data_start + b));
     }
     
-    // Reconnect PC to PM address inputs
+    // PC drives the PM address inputs
     bool* pc_outputs = cpu->get_pc_outputs();
     for (uint16_t i = 0; i < pc_bits; ++i)
     {
         program_memory->connect_input(&pc_outputs[i], i);
     }
-    program_memory->evaluate();
-    is_running = true;
-    execution_count = 0;
+    pm_run_wired = true;
+    verify_connections();
 }
 
 void Computer::_create_namestring(const std::string& name)
 {
-    // Create a unique component name string with memory address and optional name
-    std::ostringstream oss;
-    oss << "Computer 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    // get_component_name() formats "Computer 0x<address> - name" on demand
+    class_name = "Computer";
+    set_component_name(name);
 }
 
 void Computer::_print_architecture_details() const
 {
     // Print success message with architecture details
-    std::cout << "\nComputer initialized" << std::endl;
+    Console::out() << "\nComputer initialized" << std::endl;
     if (!computer_version.empty())
     {
-        std::cout << "  Version: " << computer_version << std::endl;
+        Console::out() << "  Version: " << computer_version << std::endl;
     }
     if (!ISA_version.empty())
     {
-        std::cout << "  ISA: " << ISA_version << std::endl;
+        Console::out() << "  ISA: " << ISA_version << std::endl;
     }
-    std::cout << "  Data width: " << num_bits << " bits" << std::endl;
-    std::cout << "  RAM addresses: " << num_ram_addresses << std::endl;
-    std::cout << "  PM addresses: " << num_pm_addresses << "\n" << std::endl;
+    Console::out() << "  Data width: " << num_bits << " bits" << std::endl;
+    Console::out() << "  RAM addresses: " << num_ram_addresses << std::endl;
+    Console::out() << "  PM addresses: " << num_pm_addresses << "\n" << std::endl;
 }
@@ -10,6 +10,8 @@
 #include "../components/OR_Gate.hpp"
 #include "../components/AND_Gate.hpp"
 #include "../components/Inverter.hpp"
+#include "../utilities/signal_arena.hpp"
+#include "../utilities/worker_pool.hpp"
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -29,10 +31,25 @@
  *      (CPU opcode table, PM/RAM connections, jump conditions, mux logic,
  *      write-enable OR gate, read-flag gating, etc.).
  *   3. Override get_opcode_name() to return human-readable instruction names.
+ *   4. Open a Signal_Arena::Scope on signal_arena at the top of their
+ *      constructor body so every component they create stores its IO in
+ *      the computer's arena.
+ *
+ * Computer_Generic does all of this from an ISA_Def, so a new width of an
+ * existing instruction set needs no subclass of its own.
  */
 class Computer : public Part
 {
 public:
+    /// One Program Memory row, as stored by load_image().
+    struct Instruction
+    {
+        uint16_t opcode = 0;
+        uint16_t a = 0;
+        uint16_t b = 0;
+        uint16_t c = 0;
+    };
+
     /**
      * @param num_bits           Data-path width in bits.
      * @param num_ram_addr_bits  Total RAM address bits (e.g. 6 for [page:addr]).
@@ -53,6 +70,23 @@ public:
      */
     bool load_program(const std::string& filename);
 
+    /**
+     * @brief Replace the whole of Program Memory with an image in one pass.
+     *
+     * image[i] is stored at address i and every later address is zeroed.
+     * Stored bits are written directly (no per-instruction WE pulse), and PM
+     * is left wired to the PC exactly as prepare_run() expects. A compiled
+     * netlist is kept. Fails without writing anything if the image is too
+     * long or a field does not fit in num_bits.
+     */
+    bool load_image(const std::vector<Instruction>& image);
+
+    /**
+     * @brief Replace RAM contents in one pass: values[i] at address i,
+     *        every later address zeroed.
+     */
+    void load_ram(const std::vector<uint16_t>& values);
+
     /**
      * @brief Run the loaded program.
      *
@@ -61,6 +95,13 @@ public:
      */
     void run(bool interactive = true);
 
+    /**
+     * @brief Run the loaded program with no console output until HALT or
+     *        until `max_cycles` ticks have executed, whichever comes first.
+     * @return Number of ticks executed by this call.
+     */
+    uint64_t run_headless(uint64_t max_cycles);
+
     /**
      * @brief Advance one clock cycle.
      * @return true while running, false once halted.
@@ -97,10 +138,180 @@ public:
 
     void evaluate() override;
 
+    // ── Compiled evaluation ───────────────────────────────────────────────────
+
+    /**
+     * @brief Append one evaluate() worth of gate ops to a netlist.
+     *
+     * Mirrors evaluate() step by step, including both RAM passes and the
+     * two-phase ram_read_flag toggle.
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
+    void for_each_child(const std::function<void(Component&)>& visit) override;
+
+    /**
+     * @brief Flatten the wired computer into a levelized Netlist.
+     *
+     * Called automatically by evaluate() when compiled evaluation is enabled
+     * and no netlist exists yet. Rewiring helpers (load_program,
+     * write_pm_instruction, prepare_run) discard the netlist so it is rebuilt
+     * against the current wiring.
+     */
+    void compile_netlist();
+
+    /**
+     * @brief Prove every input of every component this computer owns is connected.
+     *
+     * Walks the whole component tree with Component::for_each_child(), so
+     * parts a compiled netlist leaves out (the RAM read decoders and read
+     * selects) are checked too. Each component gets the check Netlist::Scope
+     * does: it is marked verified, which switches the primitive gates to
+     * their unchecked evaluate(), and each unconnected input is reported to
+     * Console::err() by hierarchical name (but not the inputs inside a
+     * component already missing one). Runs automatically once PM is wired
+     * for running (prepare_run, load_program, write_pm_instruction).
+     *
+     * @return true if no input is unconnected
+     */
+    bool verify_connections();
+
+    /**
+     * @brief Switch evaluate() between walking the component tree (default)
+     *        and running the compiled netlist.
+     */
+    void set_compiled_evaluation(bool enabled) { compiled_evaluation = enabled; }
+
+    /** @brief Return whether evaluate() runs the compiled netlist. */
+    bool get_compiled_evaluation() const { return compiled_evaluation; }
+
+    /**
+     * @brief Run the compiled netlist event-driven: each tick only evaluates
+     *        gates downstream of a net that changed (Netlist::evaluate_event_driven).
+     *        Enabling this also enables compiled evaluation.
+     */
+    void set_event_driven_evaluation(bool enabled);
+
+    /** @brief Return whether evaluate() runs the netlist event-driven. */
+    bool get_event_driven_evaluation() const { return event_driven_evaluation; }
+
+    /**
+     * @brief Fraction of nets that toggled during the last event-driven tick
+     *        (0 if no event-driven tick has run since the netlist was built).
+     */
+    double get_activity_factor() const;
+
+    /** @brief Return the compiled netlist, or nullptr if none is built. */
+    const Netlist* get_netlist() const { return netlist; }
+
+    /** @brief Return the arena holding this computer's components and their IO signals. */
+    const Signal_Arena& get_signal_arena() const { return signal_arena; }
+
+    // ── Checkpoints ───────────────────────────────────────────────────────────
+
+    /**
+     * @brief Raw copy of every component signal plus the run/halt bookkeeping.
+     *
+     * Every flip-flop, register, PC and flag output lives in signal_arena, so
+     * copying the arena captures the whole machine between two ticks. The
+     * storage of a WORD_LEVEL or CROSS_CHECK Main_Memory is not signals and
+     * is copied beside them (ram_words). Only valid for the computer (and
+     * wiring) it was saved from. The pages of a SPARSE Program_Memory
+     * (Computer_Generic for 8bit_v1) are not captured: restoring rewinds the
+     * PC, not the program.
+     */
+    struct Checkpoint
+    {
+        std::vector<uint8_t> signals;
+        std::vector<uint16_t> ram_words;   ///< Main_Memory::get_words(); empty for GATE_LEVEL RAM
+        bool                 is_running = true;
+        uint64_t             execution_count = 0;
+    };
+
+    /** @brief Save the machine state between ticks into `checkpoint`. */
+    void save_checkpoint(Checkpoint& checkpoint) const;
+
+    /**
+     * @brief Return the machine to a state saved by save_checkpoint().
+     * @return false if the checkpoint was taken from a different computer
+     */
+    bool restore_checkpoint(const Checkpoint& checkpoint);
+
+    // ── Machine state ─────────────────────────────────────────────────────────
+
+    /**
+     * @brief Serialize the architectural state into a compact blob.
+     *
+     * One bit per Flip_Flop built in signal_arena (every gate-level PM and
+     * RAM bit, PC, flag register, run/halt latch, rampage, opcodepage, ...)
+     * in construction order, packed 8 per byte after the run flag, then the
+     * word-level RAM storage (Main_Memory::get_words(), 2 bytes per address;
+     * none for GATE_LEVEL RAM). A 20-byte header holds the version,
+     * flip-flop count, execution count and RAM word count. Only stored bits
+     * are kept, not gate outputs, so the blob is about num_flip_flops / 8
+     * bytes plus 2 per word-level RAM address.
+     *
+     * A blob can be restored into any computer of the same class, not only
+     * the one that saved it, which allows forking a machine.
+     */
+    std::vector<uint8_t> save_state() const;
+
+    /**
+     * @brief Load a save_state() blob: forces every flip-flop to its saved
+     *        value, restores the word-level RAM words, re-drives register
+     *        outputs, then refreshes the PM outputs for the restored PC.
+     *
+     * No rewiring and no signal-generator pulses; cost is linear in the
+     * number of flip-flops, register bits and RAM words. A compiled netlist
+     * is kept.
+     *
+     * @return false (nothing changed) if the blob is malformed or comes from
+     *         a computer with a different number of flip-flops or RAM words
+     */
+    bool restore_state(const std::vector<uint8_t>& state);
+
+    // ── Multi-threaded evaluation ─────────────────────────────────────────────
+
+    /**
+     * @brief Evaluate Program_Memory and Main_Memory in address banks on a
+     *        persistent pool of `num_workers` threads (the calling thread
+     *        included); 1 (default) evaluates everything on the calling thread.
+     *
+     * Each memory evaluate() is one parallel phase ending in a barrier, and
+     * outputs are identical to single-threaded evaluation. Only the
+     * component-tree path is split: the compiled netlist and PM ROM fetches
+     * run serially. Pays off for wide memories (thousands of addresses);
+     * for the 3-bit machine the wake-up cost outweighs the work.
+     */
+    void set_num_workers(uint16_t num_workers);
+
+    /** @brief Return the number of threads evaluating the memories (1 = serial). */
+    uint16_t get_num_workers() const { return worker_pool ? worker_pool->get_num_threads() : 1; }
+
+    // ── Profiling ─────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Turn per-class evaluate() profiling on or off (see Profiler).
+     *        Off by default; costs one branch per evaluate() while off.
+     */
+    void set_profiling(bool enabled);
+
+    /** @brief Discard all profile data recorded so far. */
+    void reset_profile();
+
+    /**
+     * @brief Print the profile to stdout: per-class totals sorted by self
+     *        time, then the owner tree (e.g. Program_Memory > Decoder > AND_Gate).
+     * @param max_rows Limit on per-class rows (0 = all)
+     * @param max_depth Limit on owner-tree depth (0 = all)
+     */
+    void print_profile(size_t max_rows = 20, size_t max_depth = 4) const;
+
     // ── State query helpers (used by Evaluator) ───────────────────────────────
 
     /** @brief Return the current program counter value. */
-    uint16_t get_pc() const;
+    uint32_t get_pc() const;
 
     /**
      * @brief Re-evaluate the Program Memory decoder so get_pc() reflects
@@ -108,7 +319,8 @@ public:
      *
      * Call this after clock_tick() when you need an up-to-date PC value.
      * (The PM decoder is normally updated only at the start of each
-     * clock_tick(); calling sync_pc() between ticks keeps it in sync.)
+     * clock_tick(), and the compiled netlist skips it while PM is not being
+     * written; calling sync_pc() between ticks keeps it in sync.)
      */
     void sync_pc();
 
@@ -126,6 +338,15 @@ public:
      */
     void write_ram(uint16_t address, uint16_t value);
 
+    /** @brief Return the PC register output signals (pc_bits wide). */
+    const bool* get_pc_signals() const;
+
+    /** @brief Return the output signals of one RAM register (num_bits wide). */
+    const bool* get_ram_signals(uint16_t address) const;
+
+    /** @brief Return the run/halt flag output signal (high while running). */
+    const bool* get_run_halt_signal() const;
+
     /** @brief Return data-path width in bits. */
     uint16_t get_num_bits() const { return num_bits; }
 
@@ -137,12 +358,15 @@ public:
 
     /** @brief Return whether the computer is still running (not halted). */
     bool get_is_running() const { return is_running; }
+
+    /** @brief Return the number of ticks executed since construction. */
+    uint64_t get_execution_count() const { return execution_count; }
     
     /** @brief Return the PC width in bits. */
     uint16_t get_pc_bits() const { return pc_bits; }
     
     /** @brief Return total number of PM addresses (2^pc_bits). */
-    uint16_t get_num_pm_addresses() const { return num_pm_addresses; }
+    uint32_t get_num_pm_addresses() const { return num_pm_addresses; }
     
     /** @brief Return the number of RAM address bits. */
     uint16_t get_num_ram_addr_bits() const { return num_ram_address_bits; }
@@ -161,8 +385,8 @@ public:
     /**
      * @brief Write an instruction to Program Memory at the given address.
      *
-     * Uses internal signal generators to temporarily set the address and
-     * data, pulse write-enable, then restores the PC connection.
+     * Stores the bits directly (Program_Memory::set_instruction) and leaves
+     * PM wired to the PC.
      */
     void write_pm_instruction(uint16_t address, uint16_t opcode,
                               uint16_t a, uint16_t b, uint16_t c);
@@ -202,7 +426,7 @@ protected:
     uint16_t num_ram_address_bits;
     uint16_t num_ram_addresses;
     uint16_t pc_bits;
-    uint16_t num_pm_addresses;
+    uint32_t num_pm_addresses;
 
     // ── Core components (created and wired by the subclass constructor) ───────
     CPU*             cpu;
@@ -248,9 +472,7 @@ protected:
     Multiplexer* ram_read2_addr_mux_high;  ///< selects 0 vs B for read-port-2 high address bits
 
     // ── PM loading signal generators (kept alive to avoid use-after-free) ─────
-    std::vector<Signal_Generator>*          pm_load_addr_sigs;
-    std::vector<Signal_Generator>*          pm_load_data_sigs;
-    std::vector<Signal_Generator>*          pm_zero_sigs;   ///< Permanent zeros to restore PM data inputs after writes
+    std::vector<Signal_Generator>*          pm_zero_sigs;   ///< Permanent zeros tied to PM data inputs while running
     mutable std::vector<Signal_Generator>*  ram_addr_sigs;
 
     // ── CPU data-input pointer arrays (lifetime matches the Computer) ─────────
@@ -260,6 +482,7 @@ protected:
 
     bool     is_running;
     uint64_t execution_count;
+    bool     pm_run_wired = false;   ///< PM wired PC -> address, zeros -> data
 
     // Human-readable version strings for the computer instance and ISA.
     // Subclasses or external code may set these to document the build/version
@@ -267,6 +490,19 @@ protected:
     std::string computer_version;
     std::string ISA_version;
 
+    // ── Signal storage ────────────────────────────────────────────────────────
+    // IO arrays of every component built inside a Scope on this arena. Destroyed
+    // after the destructor body has deleted those components.
+    Signal_Arena signal_arena;
+
+    // ── Memory bank threads (nullptr = serial) ────────────────────────────────
+    Worker_Pool* worker_pool = nullptr;
+
+    // ── Compiled evaluation state ─────────────────────────────────────────────
+    Netlist* netlist;               ///< Levelized netlist (nullptr until compiled)
+    bool     compiled_evaluation;   ///< evaluate() runs the netlist when true
+    bool     event_driven_evaluation; ///< netlist runs only ops whose inputs changed
+
     // ── Helpers ───────────────────────────────────────────────────────────────
     void toggle_ram_read_flag(bool flag_high);
 
@@ -277,17 +513,37 @@ protected:
     /// Must be overridden by each ISA subclass.
     virtual std::string get_opcode_name(uint16_t opcode) const = 0;
 
-    /// Create a unique component name string with memory address and optional name.
+    /// Set the class and given name that get_component_name() formats.
     void _create_namestring(const std::string& name);
     
     /// Print architecture details using computer_version and ISA_version.
     void _print_architecture_details() const;
 
     /**
-     * @brief Evaluate ISA-specific logic gates (called during phase 2 before
-     * write-address gates). Subclasses may override to evaluate gates like
-     * instruction-decode OR gates that control write addressing.
+     * @brief Evaluate ISA-specific logic gates (called after the CPU, before
+     * the write-data mux and write-address gates). Subclasses may override to
+     * evaluate gates like instruction-decode OR gates that control write
+     * addressing and write-data selection.
      * Default implementation is a no-op.
      */
     virtual void evaluate_isa_write_gates();
+
+    /**
+     * @brief Netlist counterpart of evaluate_isa_write_gates().
+     * Subclasses that override one must override the other.
+     * Default implementation emits nothing.
+     */
+    virtual void compile_isa_write_gates(Netlist& netlist);
+
+    /// Netlist counterpart of toggle_ram_read_flag().
+    void compile_ram_read_flag(Netlist& netlist, bool flag_high);
+
+    /// Discard the compiled netlist (call after any rewiring).
+    void invalidate_netlist();
+
+    /// Wire PM address inputs to the PC and data inputs to pm_zero_sigs (once).
+    void _connect_pm_for_run();
+
+    /// Tell the event-driven netlist that state was changed outside of it.
+    void mark_netlist_dirty();
 };
@@ -14,16 +14,19 @@ const std::string Computer_3bit_v1::ISA_V1_OPCODES =
     "110 JGT\n"
     "111 MOVOUT\n";
 
-Computer_3bit_v1::Computer_3bit_v1(const std::string& name)
+Computer_3bit_v1::Computer_3bit_v1(const std::string& name, Main_Memory::Engine ram_engine,
+                                   Program_Memory::Engine pm_engine)
         : Computer(NUM_BITS, NUM_RAM_ADDR_BITS, PC_BITS, name),
             movl_not(nullptr),
             movl_or_movout(nullptr)
 {
+    Signal_Arena::Scope arena_scope(signal_arena);
+
     // Set version strings for this computer variant
     computer_version = "3-bit v1";
     ISA_version = "ISA v1";
 
-    // create component name string with ISA suffix
+    // Class name and given name; get_component_name() formats the rest on demand
     _create_namestring(name);
     
     // === Instantiate CPU, Program Memory, and RAM ===
@@ -31,8 +34,8 @@ Computer_3bit_v1::Computer_3bit_v1(const std::string& name)
     cpu = new CPU(NUM_BITS, ISA_V1_OPCODES, "cpu_3bit_v1", PC_BITS);
     cpu->wire_halt_opcode(0);
     // Create Program Memory (9-bit address, 3-bit data) and RAM (6-bit address, 3-bit data)
-    program_memory = new Program_Memory(PC_BITS, NUM_BITS, "pm_3bit_v1");
-    ram = new Main_Memory(NUM_RAM_ADDR_BITS, NUM_BITS, "ram_3bit_v1");
+    program_memory = new Program_Memory(PC_BITS, NUM_BITS, "pm_3bit_v1", pm_engine);
+    ram = new Main_Memory(NUM_RAM_ADDR_BITS, NUM_BITS, "ram_3bit_v1", ram_engine);
     
     
     // Connect PM opcode outputs to CPU decoder
@@ -61,6 +64,15 @@ Computer_3bit_v1::~Computer_3bit_v1()
     delete movl_or_movout;
 }
 
+void Computer_3bit_v1::for_each_child(const std::function<void(Component&)>& visit)
+{
+    Computer::for_each_child(visit);
+    if (movl_not)
+        visit(*movl_not);
+    if (movl_or_movout)
+        visit(*movl_or_movout);
+}
+
 void Computer_3bit_v1::_connect_program_memory_to_CPU_decoder()
 {
     // Step 1: Extract opcode bits (bits 0-2) from program memory and pass to CPU
@@ -335,6 +347,14 @@ void Computer_3bit_v1::evaluate_isa_write_gates()
     }
 }
 
+void Computer_3bit_v1::compile_isa_write_gates(Netlist& netlist)
+{
+    if (movl_or_movout)
+    {
+        movl_or_movout->compile(netlist);
+    }
+}
+
 void Computer_3bit_v1::_connect_jump_logic()
 {
     // === Build 9-bit jump address from instruction fields ===
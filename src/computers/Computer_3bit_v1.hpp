@@ -31,9 +31,15 @@ public:
      * multiplexing, data paths and jump logic.
      *
      * @param name Optional name suffix used to create per-component names.
+     * @param ram_engine Main_Memory engine for RAM (gate-level by default).
+     * @param pm_engine Program_Memory engine (gate-level by default).
      */
-    Computer_3bit_v1(const std::string& name = "");
+    Computer_3bit_v1(const std::string& name = "",
+                     Main_Memory::Engine ram_engine = Main_Memory::Engine::GATE_LEVEL,
+                     Program_Memory::Engine pm_engine = Program_Memory::Engine::GATE_LEVEL);
     ~Computer_3bit_v1() override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
 
 protected:
     /**
@@ -44,6 +50,7 @@ protected:
      */
     std::string get_opcode_name(uint16_t opcode) const override;
     void evaluate_isa_write_gates() override;
+    void compile_isa_write_gates(Netlist& netlist) override;
 
 private:
     static constexpr uint16_t NUM_BITS = 3;
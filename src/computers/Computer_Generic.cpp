@@ -0,0 +1,325 @@
+#include "Computer_Generic.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+Computer_Generic::Computer_Generic(const ISA_Def& isa_, const std::string& name,
+                                   Main_Memory::Engine ram_engine, Program_Memory::Engine pm_engine)
+        : Computer(isa_.num_bits, _ram_bits_for(isa_), isa_.pc_bits, name),
+          isa(isa_)
+{
+    Signal_Arena::Scope arena_scope(signal_arena);
+    isa.num_ram_addr_bits = num_ram_address_bits;
+
+    computer_version = isa.display_name;
+    ISA_version = "ISA " + isa.key;
+    _create_namestring(name);
+
+    // === Instantiate CPU, Program Memory, and RAM ===
+    cpu = new CPU(num_bits, _cpu_opcode_string(), "cpu_" + isa.key, pc_bits);
+    if (const OpDef* halt = _find_op(Op_Semantics::HALT))
+        cpu->wire_halt_opcode(halt->opcode);
+    if (pc_bits > Program_Memory::max_gate_level_bits)
+        pm_engine = Program_Memory::Engine::SPARSE;
+    program_memory = new Program_Memory(pc_bits, num_bits, "pm_" + isa.key, pm_engine);
+    ram = new Main_Memory(num_ram_address_bits, num_bits, "ram_" + isa.key, ram_engine);
+
+    _connect_program_memory_to_CPU_decoder();
+
+    // === RAM setup (addressing + write-phase control + data mux) ===
+    _setup_ram_read_muxes();
+    _wire_ram_address_and_write_controls();
+    _phase_ram_write_enable();
+    _multiplex_RAM_data_inputs();
+    _connect_ram_outputs();
+
+    _connect_jump_logic();
+
+    _print_architecture_details();
+}
+
+Computer_Generic::~Computer_Generic()
+{
+    delete page_write_or;
+    delete page_write_not;
+}
+
+void Computer_Generic::for_each_child(const std::function<void(Component&)>& visit)
+{
+    Computer::for_each_child(visit);
+    if (page_write_or)
+        visit(*page_write_or);
+    if (page_write_not)
+        visit(*page_write_not);
+}
+
+size_t Computer_Generic::get_owned_bytes() const
+{
+    size_t bytes = Computer::get_owned_bytes();
+    bytes += isa.key.capacity() + isa.display_name.capacity();
+    bytes += isa.opcodes.capacity() * sizeof(OpDef);
+    for (const OpDef& op : isa.opcodes)
+        bytes += op.name.capacity() + op.description.capacity();
+    return bytes;
+}
+
+uint16_t Computer_Generic::_ram_bits_for(const ISA_Def& isa)
+{
+    const uint16_t low = isa.num_bits;
+    const uint16_t high = static_cast<uint16_t>(2 * isa.num_bits);
+    const uint16_t bits = std::min(std::max(isa.num_ram_addr_bits, low), high);
+    if (bits != isa.num_ram_addr_bits)
+    {
+        Console::err() << "Error: Computer_Generic - " << isa.key << " has " << isa.num_ram_addr_bits
+                       << " RAM address bits, expected " << low << " to " << high << "; using "
+                       << bits << std::endl;
+    }
+    return bits;
+}
+
+const OpDef* Computer_Generic::_find_op(Op_Semantics semantics) const
+{
+    for (const OpDef& op : isa.opcodes)
+    {
+        if (op.semantics == semantics)
+            return &op;
+    }
+    return nullptr;
+}
+
+const bool* Computer_Generic::_op_signal(const bool* decoder_outputs, Op_Semantics semantics) const
+{
+    const OpDef* op = _find_op(semantics);
+    if (!op || op->opcode >= (1u << num_bits))
+        return &read_addr_high_low->get_outputs()[0];
+    return &decoder_outputs[op->opcode];
+}
+
+std::string Computer_Generic::_cpu_opcode_string() const
+{
+    std::string table;
+    for (const OpDef& op : isa.opcodes)
+    {
+        // The CPU enables ALU functions by operation name
+        std::string operation = op.name;
+        if (op.semantics == Op_Semantics::ADD)
+            operation = "ADD";
+        else if (op.semantics == Op_Semantics::SUB)
+            operation = "SUB";
+        table += to_binary(op.opcode, num_bits) + " " + operation + "\n";
+    }
+    return table;
+}
+
+std::string Computer_Generic::get_opcode_name(uint16_t opcode) const
+{
+    for (const OpDef& op : isa.opcodes)
+    {
+        if (op.opcode == opcode)
+            return op.name;
+    }
+    return "UNKNOWN";
+}
+
+void Computer_Generic::_connect_program_memory_to_CPU_decoder()
+{
+    // Opcode field -> CPU decoder, PC -> PM address inputs
+    std::vector<const bool*> pm_opcode_ptrs(num_bits);
+    for (uint16_t i = 0; i < num_bits; ++i)
+        pm_opcode_ptrs[i] = &program_memory->get_outputs()[i];
+    std::vector<bool*> pm_address_inputs(pc_bits, nullptr);
+    cpu->connect_program_memory(pm_opcode_ptrs.data(), pm_address_inputs.data());
+    for (uint16_t i = 0; i < program_memory->get_decoder_bits(); ++i)
+    {
+        if (pm_address_inputs[i])
+            program_memory->connect_input(pm_address_inputs[i], i);
+    }
+
+    const uint16_t pm_we_index = static_cast<uint16_t>(program_memory->get_decoder_bits() + 4 * num_bits);
+    program_memory->connect_input(&pm_write_enable->get_outputs()[0], pm_we_index);
+    program_memory->connect_input(&pm_read_enable->get_outputs()[0], static_cast<uint16_t>(pm_we_index + 1));
+
+    // One-hot opcode straight from PM, valid before the CPU evaluates
+    pm_decoder = new Decoder(num_bits, "pm_opcode_decoder_" + isa.key);
+    for (uint16_t i = 0; i < num_bits; ++i)
+        pm_decoder->connect_input(&program_memory->get_outputs()[i], i);
+}
+
+void Computer_Generic::_setup_ram_read_muxes()
+{
+    // Read port 2: [0:B] normally, [B:C] for COMPARE
+    const bool* compare = _op_signal(pm_decoder->get_outputs(), Op_Semantics::COMPARE);
+    cmp_not = new Inverter(1, "cmp_not_in_" + isa.key);
+    cmp_not->connect_input(compare, 0);
+
+    const bool* pm_out = program_memory->get_outputs();
+    ram_read2_addr_mux_low = new Multiplexer(num_bits, 2, "ram_read2_low_addr_mux");
+    const bool* sources_low[2] = { &pm_out[2 * num_bits], &pm_out[3 * num_bits] };  // B, C
+    const bool* controls[2] = { &cmp_not->get_outputs()[0], compare };
+    ram_read2_addr_mux_low->connect_sources_from_values(sources_low, controls);
+
+    const uint16_t page_bits = static_cast<uint16_t>(num_ram_address_bits - num_bits);
+    if (page_bits == 0)
+        return;
+    ram_read2_addr_mux_high = new Multiplexer(page_bits, 2, "ram_read2_high_addr_mux");
+    std::vector<const bool*> zeros(page_bits, &read_addr_high_low->get_outputs()[0]);
+    std::vector<const bool*> b_field(page_bits);
+    for (uint16_t i = 0; i < page_bits; ++i)
+        b_field[i] = &pm_out[2 * num_bits + i];
+    const bool* const* sources_high[2] = { zeros.data(), b_field.data() };
+    ram_read2_addr_mux_high->connect_sources(sources_high, controls);
+}
+
+void Computer_Generic::_wire_ram_address_and_write_controls()
+{
+    cu_decoder = cpu->get_decoder_outputs();
+    const bool* move_literal = _op_signal(cu_decoder, Op_Semantics::MOVE_LITERAL);
+    const bool* move_paged = _op_signal(cu_decoder, Op_Semantics::MOVE_PAGED);
+
+    // MOVE_LITERAL and MOVE_PAGED write to the page in B; everything else to page 0
+    page_write_or = new OR_Gate(2, "page_write_or_in_" + isa.key);
+    page_write_or->connect_input(move_literal, 0);
+    page_write_or->connect_input(move_paged, 1);
+    page_write_or->evaluate();
+
+    const bool* pm_out = program_memory->get_outputs();
+    const uint16_t address_bits = num_ram_address_bits;
+    const uint16_t page_bits = static_cast<uint16_t>(address_bits - num_bits);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        // Read port 1: [0:A]
+        ram->connect_input(&pm_out[num_bits + i], i);
+        // Read port 2 low bits, write port low bits: [.:B or C], [.:C]
+        ram->connect_input(&ram_read2_addr_mux_low->get_outputs()[i], static_cast<uint16_t>(address_bits + i));
+        ram->connect_input(&pm_out[3 * num_bits + i], static_cast<uint16_t>(2 * address_bits + i));
+    }
+
+    ram_write_addr_high_mux = new AND_Gate*[num_bits]();
+    for (uint16_t i = 0; i < page_bits; ++i)
+    {
+        ram->connect_input(&read_addr_high_low->get_outputs()[0], static_cast<uint16_t>(num_bits + i));
+        ram->connect_input(&ram_read2_addr_mux_high->get_outputs()[i],
+                           static_cast<uint16_t>(address_bits + num_bits + i));
+
+        ram_write_addr_high_mux[i] = new AND_Gate(2, "ram_write_addr_high_" + std::to_string(i));
+        ram_write_addr_high_mux[i]->connect_input(&page_write_or->get_outputs()[0], 0);
+        ram_write_addr_high_mux[i]->connect_input(&pm_out[2 * num_bits + i], 1);
+        ram->connect_input(&ram_write_addr_high_mux[i]->get_outputs()[0],
+                           static_cast<uint16_t>(2 * address_bits + num_bits + i));
+    }
+
+    // Every op that stores a result enables the write port
+    const Op_Semantics writers[4] = { Op_Semantics::MOVE_LITERAL, Op_Semantics::ADD,
+                                      Op_Semantics::SUB, Op_Semantics::MOVE_PAGED };
+    ram_write_or = new OR_Gate(4, "ram_write_or_in_" + isa.key);
+    for (uint16_t i = 0; i < 4; ++i)
+        ram_write_or->connect_input(_op_signal(cu_decoder, writers[i]), i);
+    ram_write_or->evaluate();
+}
+
+void Computer_Generic::_phase_ram_write_enable()
+{
+    // High during the read phase, so writes only land in the second RAM pass
+    ram_read_flag = new Signal_Generator("ram_read_flag_in_" + isa.key);
+    ram_read_flag->go_high();
+    ram_read_flag->evaluate();
+
+    ram_read_flag_not = new Inverter(1, "ram_read_flag_not_in_" + isa.key);
+    ram_read_flag_not->connect_input(&ram_read_flag->get_outputs()[0], 0);
+    ram_read_flag_not->evaluate();
+
+    ram_we_gated = new AND_Gate(2, "ram_we_gated_in_" + isa.key);
+    ram_we_gated->connect_input(&ram_read_flag_not->get_outputs()[0], 0);
+    ram_we_gated->connect_input(&ram_write_or->get_outputs()[0], 1);
+    ram_we_gated->evaluate();
+
+    const uint16_t control_index = static_cast<uint16_t>(3 * num_ram_address_bits + num_bits);
+    ram->connect_input(&ram_we_gated->get_outputs()[0], control_index);
+    ram->connect_input(&ram_read_enable->get_outputs()[0], static_cast<uint16_t>(control_index + 1));
+    ram->connect_input(&ram_write_enable->get_outputs()[0], static_cast<uint16_t>(control_index + 2));
+}
+
+void Computer_Generic::_multiplex_RAM_data_inputs()
+{
+    // ALU result unless a page write is active; MOVE_LITERAL stores A, MOVE_PAGED read port 1
+    page_write_not = new Inverter(1, "page_write_not_in_" + isa.key);
+    page_write_not->connect_input(&page_write_or->get_outputs()[0], 0);
+    page_write_not->evaluate();
+
+    ram_data_mux = new Multiplexer(num_bits, 3, "ram_data_mux_in_" + isa.key);
+    const bool* sources[3] = {
+        cpu->get_result_outputs(),
+        &program_memory->get_outputs()[num_bits],
+        ram->get_outputs(),
+    };
+    const bool* controls[3] = {
+        &page_write_not->get_outputs()[0],
+        _op_signal(cu_decoder, Op_Semantics::MOVE_LITERAL),
+        _op_signal(cu_decoder, Op_Semantics::MOVE_PAGED),
+    };
+    ram_data_mux->connect_sources_from_values(sources, controls);
+    for (uint16_t i = 0; i < num_bits; ++i)
+        ram->connect_input(&ram_data_mux->get_outputs()[i], static_cast<uint16_t>(3 * num_ram_address_bits + i));
+}
+
+void Computer_Generic::_connect_ram_outputs()
+{
+    // ALU operands from the two read ports; the A field is the literal
+    data_a_ptrs = new const bool*[num_bits];
+    data_b_ptrs = new const bool*[num_bits];
+    data_c_ptrs = new const bool*[num_bits];
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        data_a_ptrs[i] = &ram->get_outputs()[i];
+        data_b_ptrs[i] = &ram->get_outputs()[num_bits + i];
+        data_c_ptrs[i] = &program_memory->get_outputs()[num_bits + i];
+    }
+    cpu->connect_data_inputs(data_a_ptrs, data_b_ptrs, data_c_ptrs);
+}
+
+void Computer_Generic::_connect_jump_logic()
+{
+    // Jump target: the low pc_bits of A:B:C (C is least significant), zero-extended
+    const bool* pm_out = program_memory->get_outputs();
+    std::vector<const bool*> jump_addr_ptrs(pc_bits);
+    for (uint16_t i = 0; i < pc_bits; ++i)
+    {
+        const uint16_t field = i / num_bits;  // 0 = C, 1 = B, 2 = A
+        const uint16_t bit = i % num_bits;
+        if (field < 3)
+            jump_addr_ptrs[i] = &pm_out[(3 - field) * num_bits + bit];
+        else
+            jump_addr_ptrs[i] = &read_addr_high_low->get_outputs()[0];
+    }
+    cpu->connect_jump_address(jump_addr_ptrs.data(), pc_bits);
+
+    // Flag indices follow the comparator: EQ = 0, GT_U = 3
+    std::vector<std::pair<std::string, uint16_t>> jump_conditions;
+    if (const OpDef* jeq = _find_op(Op_Semantics::JUMP_IF_EQUAL))
+        jump_conditions.push_back({ jeq->name, 0 });
+    if (const OpDef* jgt = _find_op(Op_Semantics::JUMP_IF_GREATER))
+        jump_conditions.push_back({ jgt->name, 3 });
+    if (!jump_conditions.empty())
+        cpu->connect_jump_conditions(jump_conditions);
+
+    // Flags only update on COMPARE
+    if (const OpDef* compare = _find_op(Op_Semantics::COMPARE))
+    {
+        if (compare->opcode < (1u << cpu->get_opcode_bits()))
+            cpu->wire_flag_write_enable(&cu_decoder[compare->opcode]);
+    }
+}
+
+void Computer_Generic::evaluate_isa_write_gates()
+{
+    page_write_or->evaluate();
+    page_write_not->evaluate();
+}
+
+void Computer_Generic::compile_isa_write_gates(Netlist& netlist)
+{
+    page_write_or->compile(netlist);
+    page_write_not->compile(netlist);
+}
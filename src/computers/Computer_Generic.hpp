@@ -0,0 +1,102 @@
+#pragma once
+#include "Computer.hpp"
+#include "../utilities/isa_registry.hpp"
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Computer wired from an ISA_Def instead of by hand.
+ *
+ * Every widths-and-opcodes decision a subclass like Computer_3bit_v1 makes
+ * in its constructor is derived here from the ISA_Def and the Op_Semantics
+ * of each opcode:
+ *   - CPU opcode table: one line per OpDef (ADD/SUB semantics are given the
+ *     ALU's operation names, everything else keeps its mnemonic)
+ *   - HALT semantics drive the control unit's halt signal
+ *   - RAM read port 1: [0:A]; read port 2: COMPARE ? [B:C] : [0:B]
+ *   - RAM write port: [0:C], page bits gated in by MOVE_LITERAL | MOVE_PAGED
+ *   - RAM write enable: MOVE_LITERAL | ADD | SUB | MOVE_PAGED, two-phase gated
+ *   - RAM write data: ALU result, the A literal (MOVE_LITERAL) or read port 1
+ *     (MOVE_PAGED)
+ *   - JUMP_IF_EQUAL / JUMP_IF_GREATER: EQ / GT_U flag, target A:B:C
+ *   - COMPARE: flag register write enable
+ * An opcode missing from the table is wired to a constant low, so any
+ * subset of the semantics can be built.
+ *
+ * Widths come from the ISA_Def: RAM address bits are clamped to
+ * [num_bits, 2 * num_bits] (the page is the low bits of B), the PC takes the
+ * low pc_bits of A:B:C, and Program Memory switches to the SPARSE engine when
+ * pc_bits is wider than the gate-level engine allows.
+ *
+ * Usage:
+ *   Computer_Generic computer(*get_isa("4bit_v1"), "computer");
+ *   computer.load_image(image);
+ *   computer.run_headless(1000);
+ */
+class Computer_Generic : public Computer
+{
+public:
+    /**
+     * @param isa        Architecture to build (copied).
+     * @param name       Optional name suffix used to create per-component names.
+     * @param ram_engine Main_Memory engine for RAM (gate-level by default).
+     * @param pm_engine  Program_Memory engine (gate-level by default, SPARSE
+     *                   when pc_bits exceeds Program_Memory::max_gate_level_bits).
+     */
+    Computer_Generic(const ISA_Def& isa, const std::string& name = "",
+                     Main_Memory::Engine ram_engine = Main_Memory::Engine::GATE_LEVEL,
+                     Program_Memory::Engine pm_engine = Program_Memory::Engine::GATE_LEVEL);
+    ~Computer_Generic() override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
+    void for_each_child(const std::function<void(Component&)>& visit) override;
+
+    /** @brief Return the ISA this computer was built from. */
+    const ISA_Def& get_isa_def() const { return isa; }
+
+protected:
+    std::string get_opcode_name(uint16_t opcode) const override;
+    void evaluate_isa_write_gates() override;
+    void compile_isa_write_gates(Netlist& netlist) override;
+
+private:
+    ISA_Def isa;
+
+    bool*     cu_decoder = nullptr;       ///< CPU decoder outputs (one per opcode)
+    OR_Gate*  page_write_or = nullptr;    ///< MOVE_LITERAL | MOVE_PAGED: write to page B
+    Inverter* page_write_not = nullptr;   ///< NOT(page_write_or): selects the ALU result
+
+    /// RAM address bits for `isa`, clamped to [num_bits, 2 * num_bits] with an error.
+    static uint16_t _ram_bits_for(const ISA_Def& isa);
+
+    /// First opcode with the given semantics, or nullptr if the ISA has none.
+    const OpDef* _find_op(Op_Semantics semantics) const;
+
+    /// decoder_outputs[opcode] of the op with `semantics`, or a constant low.
+    const bool* _op_signal(const bool* decoder_outputs, Op_Semantics semantics) const;
+
+    /// "010 ADD\n..." for the CPU, in num_bits-wide binary.
+    std::string _cpu_opcode_string() const;
+
+    // constructor helper functions
+    /// PM opcode field -> CPU decoder, PC -> PM address, PM enables, pm_decoder.
+    void _connect_program_memory_to_CPU_decoder();
+
+    /// CMP-controlled multiplexers choosing read port 2's [0:B] or [B:C].
+    void _setup_ram_read_muxes();
+
+    /// RAM address inputs, page-write gating and the RAM write-enable OR.
+    void _wire_ram_address_and_write_controls();
+
+    /// Two-phase read/write gating of the RAM write enable.
+    void _phase_ram_write_enable();
+
+    /// Write-data multiplexer: ALU result, PM literal or read port 1.
+    void _multiplex_RAM_data_inputs();
+
+    /// RAM read ports and the PM literal -> CPU data inputs.
+    void _connect_ram_outputs();
+
+    /// A:B:C jump target, conditional jumps and the CMP flag write enable.
+    void _connect_jump_logic();
+};
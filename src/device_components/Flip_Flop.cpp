@@ -1,21 +1,20 @@
 #include "Flip_Flop.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+#include "../utilities/signal_arena.hpp"
 
 Flip_Flop::Flip_Flop(const std::string& name)
         : Component(name),
-            inverter_set(1, name.empty() ? std::string("inverter_set_in_flip_flop") : name + "_inverter_set"),
-            inverter_reset(1, name.empty() ? std::string("inverter_reset_in_flip_flop") : name + "_inverter_reset"),
-      nand_gate_1(2, name.empty() ? std::string("nand_gate_1_in_flip_flop") : name + "_nand_gate_1"),
-      nand_gate_2(2, name.empty() ? std::string("nand_gate_2_in_flip_flop") : name + "_nand_gate_2")
+            inverter_set(1),
+            inverter_reset(1),
+      nand_gate_1(2),
+      nand_gate_2(2)
 {
-    std::ostringstream oss;
-    oss << "Flip_Flop 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Flip_Flop";
+    inverter_set.set_name_parent(this, INVERTER_SET);
+    inverter_reset.set_name_parent(this, INVERTER_RESET);
+    nand_gate_1.set_name_parent(this, NAND_GATE_1);
+    nand_gate_2.set_name_parent(this, NAND_GATE_2);
     num_inputs = 2;  // [Set, Reset]
     num_outputs = 1; // [Q (output)]
     
@@ -34,12 +33,25 @@ Flip_Flop::Flip_Flop(const std::string& name)
     nand_gate_1.get_outputs()[0] = false;  // Q = 0
     nand_gate_2.get_outputs()[0] = true;   // Q_not = 1
     outputs[0] = false;  // Output reflects Q
+
+    // Let the owning computer find every storage element (Computer::save_state)
+    if (Signal_Arena* arena = Signal_Arena::get_current())
+        arena->register_flip_flop(this);
 }
 
 Flip_Flop::~Flip_Flop()
 {
 }
 
+std::string Flip_Flop::child_name(uint32_t index) const
+{
+    static const char* const children[] = { "inverter_set", "inverter_reset", "nand_gate_1", "nand_gate_2" };
+    const std::string name = get_given_name();
+    if (name.empty())
+        return std::string(children[index]) + "_in_flip_flop";
+    return name + "_" + children[index];
+}
+
 bool Flip_Flop::connect_input(const bool* const upstream_output_p, uint16_t input_index)
 {
     // Call parent to set our inputs array
@@ -63,6 +75,7 @@ bool Flip_Flop::connect_input(const bool* const upstream_output_p, uint16_t inpu
 
 void Flip_Flop::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate in order: inverters → NAND gates → feedback settles
     inverter_set.evaluate();
     inverter_reset.evaluate();
@@ -75,6 +88,26 @@ void Flip_Flop::evaluate()
     outputs[0] = nand_gate_1.get_output(0);
 }
 
+void Flip_Flop::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    inverter_set.compile(netlist);
+    inverter_reset.compile(netlist);
+    nand_gate_1.compile(netlist);
+    nand_gate_2.compile(netlist);
+    nand_gate_1.compile(netlist);  // Second pass, as in evaluate()
+    nand_gate_2.compile(netlist);
+    netlist.emit_buffer(nand_gate_1.get_outputs(), &outputs[0]);
+}
+
+void Flip_Flop::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(inverter_set);
+    visit(inverter_reset);
+    visit(nand_gate_1);
+    visit(nand_gate_2);
+}
+
 void Flip_Flop::force_reset()
 {
     // Drive the NAND latch directly into a stable Q=0 state:
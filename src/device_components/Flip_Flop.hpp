@@ -18,6 +18,9 @@ public:
     ~Flip_Flop() override;
     bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
 
     /**
      * @brief Directly forces the latch into the stable Q=0 state.
@@ -28,7 +31,14 @@ public:
     /** Directly forces the latch into the stable Q=1 state. */
     void force_set();
 
+protected:
+    /** "<name>_nand_gate_1", or "nand_gate_1_in_flip_flop" when unnamed. */
+    std::string child_name(uint32_t index) const override;
+
 private:
+    /// Child indices for set_name_parent() / child_name()
+    enum Child : uint32_t { INVERTER_SET, INVERTER_RESET, NAND_GATE_1, NAND_GATE_2 };
+
     Inverter inverter_set;      // Inverts Set input for NAND latch
     Inverter inverter_reset;    // Inverts Reset input for NAND latch
     NAND_Gate nand_gate_1;      // Cross-coupled NAND gate 1
@@ -1,16 +1,10 @@
 #include "Full_Adder.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 Full_Adder::Full_Adder(const std::string& name) : Component(name)
 {
-    std::ostringstream oss;
-    oss << "Full_Adder 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Full_Adder";
     num_inputs = 3; // [A, B, Carry-In]
     num_outputs = 2; // [Sum, Carry]
     
@@ -54,6 +48,7 @@ bool Full_Adder::connect_input(const bool* const upstream_output_p, uint16_t inp
 
 void Full_Adder::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all internal components in topological order
     half_adder_1.evaluate();
     half_adder_2.evaluate();
@@ -64,3 +59,20 @@ void Full_Adder::evaluate()
     outputs[1] = or_gate_1.get_output(0);
 }
 
+void Full_Adder::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    half_adder_1.compile(netlist);
+    half_adder_2.compile(netlist);
+    or_gate_1.compile(netlist);
+    netlist.emit_buffer(&half_adder_2.get_outputs()[0], &outputs[0]);
+    netlist.emit_buffer(or_gate_1.get_outputs(), &outputs[1]);
+}
+
+void Full_Adder::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(half_adder_1);
+    visit(half_adder_2);
+    visit(or_gate_1);
+}
+
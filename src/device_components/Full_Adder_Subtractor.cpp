@@ -1,16 +1,11 @@
 #include "Full_Adder_Subtractor.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 Full_Adder_Subtractor::Full_Adder_Subtractor(const std::string& name)
     : Component(name), xor_gate_1(2)
 {
-    std::ostringstream oss;
-    oss << "Full_Adder_Subtractor 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Full_Adder_Subtractor";
     num_inputs = 4; // [A, B, Carry-In, Subtract]
     num_outputs = 2; // [Sum, Carry]
     
@@ -61,6 +56,7 @@ bool Full_Adder_Subtractor::connect_input(const bool* const upstream_output_p, u
 
 void Full_Adder_Subtractor::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all internal components in topological order
     xor_gate_1.evaluate();
     full_adder.evaluate();
@@ -70,3 +66,18 @@ void Full_Adder_Subtractor::evaluate()
     outputs[1] = full_adder.get_output(1);
 }
 
+void Full_Adder_Subtractor::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    xor_gate_1.compile(netlist);
+    full_adder.compile(netlist);
+    netlist.emit_buffer(&full_adder.get_outputs()[0], &outputs[0]);
+    netlist.emit_buffer(&full_adder.get_outputs()[1], &outputs[1]);
+}
+
+void Full_Adder_Subtractor::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(full_adder);
+    visit(xor_gate_1);
+}
+
@@ -1,16 +1,10 @@
 #include "Half_Adder.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 Half_Adder::Half_Adder(const std::string& name) : Component(name)
 {
-    std::ostringstream oss;
-    oss << "Half_Adder 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Half_Adder";
     num_inputs = 2;
     num_outputs = 2; // [0] is Sum, [1] is Carry
     
@@ -53,6 +47,7 @@ bool Half_Adder::connect_input(const bool* const upstream_output_p, uint16_t inp
 
 void Half_Adder::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all internal components in topological order
     nand_gate1.evaluate();
     nand_gate2.evaluate();
@@ -65,3 +60,24 @@ void Half_Adder::evaluate()
     outputs[1] = inverter1.get_output(0);
 }
 
+void Half_Adder::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    nand_gate1.compile(netlist);
+    nand_gate2.compile(netlist);
+    nand_gate3.compile(netlist);
+    nand_gate4.compile(netlist);
+    inverter1.compile(netlist);
+    netlist.emit_buffer(nand_gate4.get_outputs(), &outputs[0]);
+    netlist.emit_buffer(inverter1.get_outputs(), &outputs[1]);
+}
+
+void Half_Adder::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(nand_gate1);
+    visit(nand_gate2);
+    visit(nand_gate3);
+    visit(nand_gate4);
+    visit(inverter1);
+}
+
@@ -1,22 +1,21 @@
 #include "Memory_Bit.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 Memory_Bit::Memory_Bit(const std::string& name)
     : Component(name),
-    data_inverter(1, name.empty() ? std::string("data_inverter_in_memory_bit") : name + "_data_inverter"),
-      set_and(2, name.empty() ? std::string("set_and_in_memory_bit") : name + "_set_and"),
-      reset_and(2, name.empty() ? std::string("reset_and_in_memory_bit") : name + "_reset_and"),
-      output_and(2, name.empty() ? std::string("output_and_in_memory_bit") : name + "_output_and"),
-      flip_flop(name.empty() ? std::string("flip_flop_in_memory_bit") : name + "_flip_flop")
+    data_inverter(1),
+      set_and(2),
+      reset_and(2),
+      output_and(2),
+      flip_flop()
 {
-    std::ostringstream oss;
-    oss << "Memory_Bit 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Memory_Bit";
+    data_inverter.set_name_parent(this, DATA_INVERTER);
+    set_and.set_name_parent(this, SET_AND);
+    reset_and.set_name_parent(this, RESET_AND);
+    output_and.set_name_parent(this, OUTPUT_AND);
+    flip_flop.set_name_parent(this, FLIP_FLOP);
     num_inputs = 3;  // [Data, Write_Enable, Read_Enable]
     num_outputs = 1; // [Q (output)]
     
@@ -37,6 +36,15 @@ Memory_Bit::~Memory_Bit()
 {
 }
 
+std::string Memory_Bit::child_name(uint32_t index) const
+{
+    static const char* const children[] = { "data_inverter", "set_and", "reset_and", "output_and", "flip_flop" };
+    const std::string name = get_given_name();
+    if (name.empty())
+        return std::string(children[index]) + "_in_memory_bit";
+    return name + "_" + children[index];
+}
+
 bool Memory_Bit::connect_input(const bool* const upstream_output_p, uint16_t input_index)
 {
     // Call parent to set our inputs array
@@ -70,6 +78,11 @@ bool Memory_Bit::get_stored_bit() const
     return flip_flop.get_output(0);
 }
 
+const bool* Memory_Bit::get_stored_signal() const
+{
+    return flip_flop.get_outputs();
+}
+
 void Memory_Bit::force_reset()
 {
     flip_flop.force_reset();
@@ -86,6 +99,7 @@ void Memory_Bit::force_set()
 
 void Memory_Bit::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate in order: data_inverter → AND gates → flip_flop → output_and
     data_inverter.evaluate();
     set_and.evaluate();
@@ -96,3 +110,23 @@ void Memory_Bit::evaluate()
     // Output is from output_and
     outputs[0] = output_and.get_output(0);
 }
+
+void Memory_Bit::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    data_inverter.compile(netlist);
+    set_and.compile(netlist);
+    reset_and.compile(netlist);
+    flip_flop.compile(netlist);
+    output_and.compile(netlist);
+    netlist.emit_buffer(output_and.get_outputs(), &outputs[0]);
+}
+
+void Memory_Bit::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(data_inverter);
+    visit(set_and);
+    visit(reset_and);
+    visit(output_and);
+    visit(flip_flop);
+}
@@ -21,17 +21,30 @@ public:
     ~Memory_Bit() override;
     bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
 
     /** Returns the raw stored Q value, bypassing the read-enable gate. */
     bool get_stored_bit() const;
 
+    /** Returns the flip-flop's Q signal, for netlists that read the stored bit directly. */
+    const bool* get_stored_signal() const;
+
     /** Directly forces this memory cell to store 0. */
     void force_reset();
 
     /** Directly forces this memory cell to store 1. */
     void force_set();
 
+protected:
+    /** "<name>_set_and", or "set_and_in_memory_bit" when unnamed. */
+    std::string child_name(uint32_t index) const override;
+
 private:
+    /// Child indices for set_name_parent() / child_name()
+    enum Child : uint32_t { DATA_INVERTER, SET_AND, RESET_AND, OUTPUT_AND, FLIP_FLOP };
+
     Inverter data_inverter;     // Inverts data for reset path
     AND_Gate set_and;           // Data AND Write Enable → Set
     AND_Gate reset_and;         // NOT Data AND Write Enable → Reset
@@ -1,16 +1,11 @@
 #include "Adder.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 
 Adder::Adder(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Adder 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Adder";
     num_inputs = 2 * num_bits;  // A (num_bits) + B (num_bits)
     num_outputs = num_bits;      // Sum (num_bits)
     
@@ -71,6 +66,7 @@ bool Adder::connect_input(const bool* const upstream_output_p, uint16_t input_in
 
 void Adder::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all adders in sequence
     for (uint16_t i = 0; i < num_bits; ++i)
     {
@@ -84,4 +80,22 @@ void Adder::evaluate()
     }
 }
 
+void Adder::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        adders[i]->compile(netlist);
+    }
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        netlist.emit_buffer(&adders[i]->get_outputs()[0], &outputs[i]);
+    }
+}
 
+void Adder::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (uint16_t i = 0; i < num_bits; ++i)
+        visit(*adders[i]);
+    visit(*carry_in_signal);
+}
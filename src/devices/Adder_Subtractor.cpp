@@ -1,18 +1,13 @@
 #include "Adder_Subtractor.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <cstdlib>
 #include <sstream>
-#include <iomanip>
 #include <iostream>
 
 Adder_Subtractor::Adder_Subtractor(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Adder_Subtractor 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Adder_Subtractor";
     num_inputs = (2 * num_bits) + 2;  // data_input_A (num_bits) + data_input_B (num_bits) + subtract_enable (1) + output_enable (1)
     num_outputs = num_bits + 4;        // data_output (num_bits) + flags (Z, N, C, V)
     
@@ -33,7 +28,7 @@ Adder_Subtractor::Adder_Subtractor(uint16_t num_bits, const std::string& name) :
     output_enable = nullptr;
     
     // Allocate internal_output array (raw sum + carry, pre-output_enable)
-    internal_output = new bool[num_bits + 1];
+    internal_output = new bool[num_bits + 1]();
     
     // Initialize AND gates pointer
     output_AND_gates = nullptr;
@@ -47,6 +42,11 @@ Adder_Subtractor::Adder_Subtractor(uint16_t num_bits, const std::string& name) :
             zfn_name << "zero_flag_nor_in_adder_subtractor";
         zero_flag_nor = new NOR_Gate(num_bits, zfn_name.str());
     }
+    // Z flag reads the raw sum bits
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        zero_flag_nor->connect_input(&internal_output[i], i);
+    }
     
     // Array of single-bit Full_Adder_Subtractors
     adder_subtractors = new Full_Adder_Subtractor*[num_bits];
@@ -142,6 +142,7 @@ bool Adder_Subtractor::connect_input(const bool* const upstream_output_p, uint16
 
 void Adder_Subtractor::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all Full_Adder_Subtractor components in sequence
     for (uint16_t i = 0; i < num_bits; ++i)
     {
@@ -169,11 +170,6 @@ void Adder_Subtractor::evaluate()
     }
     
     // Compute flags at outputs[num_bits..num_bits+3]:
-    // Wire internal sum bits to zero_flag_nor
-    for (uint16_t i = 0; i < num_bits; ++i)
-    {
-        zero_flag_nor->connect_input(&internal_output[i], i);
-    }
     zero_flag_nor->evaluate();
     
     // Z flag (zero): NOR of all sum bits
@@ -205,5 +201,50 @@ void Adder_Subtractor::evaluate()
     }
 }
 
+void Adder_Subtractor::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        adder_subtractors[i]->compile(netlist);
+    }
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        output_AND_gates[i]->compile(netlist);
+    }
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        netlist.emit_buffer(&adder_subtractors[i]->get_outputs()[0], &internal_output[i]);
+    }
+    netlist.emit_buffer(&adder_subtractors[num_bits - 1]->get_outputs()[1], &internal_output[num_bits]);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        netlist.emit_buffer(output_AND_gates[i]->get_outputs(), &outputs[i]);
+    }
+
+    // Z, N, C flags
+    zero_flag_nor->compile(netlist);
+    netlist.emit_buffer(zero_flag_nor->get_outputs(), &outputs[num_bits + 0]);
+    netlist.emit_buffer(&internal_output[num_bits - 1], &outputs[num_bits + 1]);
+    netlist.emit_buffer(&internal_output[num_bits], &outputs[num_bits + 2]);
 
+    // V flag: (A_MSB XOR B_MSB) == subtract  AND  A_MSB != Sum_MSB
+    const bool* a_msb = data_a_input[num_bits - 1];
+    const bool* b_msb = data_b_input[num_bits - 1];
+    const bool* sign_mismatch = netlist.scratch_signal();
+    netlist.emit(Netlist::Op_Type::XOR, { a_msb, b_msb, subtract_enable }, sign_mismatch);
+    const bool* sign_match = netlist.scratch_signal();
+    netlist.emit(Netlist::Op_Type::NOT, { sign_mismatch }, sign_match);
+    const bool* result_flipped = netlist.scratch_signal();
+    netlist.emit(Netlist::Op_Type::XOR, { a_msb, &internal_output[num_bits - 1] }, result_flipped);
+    netlist.emit(Netlist::Op_Type::AND, { sign_match, result_flipped }, &outputs[num_bits + 3]);
+}
 
+void Adder_Subtractor::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (uint16_t i = 0; i < num_bits; ++i)
+        visit(*adder_subtractors[i]);
+    for (uint16_t i = 0; i < num_bits; ++i)
+        visit(*output_AND_gates[i]);
+    visit(*zero_flag_nor);
+}
@@ -1,55 +1,153 @@
 #include "Bus.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
+#include <iostream>
 
-Bus::Bus(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
+Bus::Bus(uint16_t num_bits, const std::string& name, Mode mode) : Device(num_bits, name), mode(mode)
 {
-    num_inputs = num_bits;  // Bus accepts num_bits inputs
+    num_inputs = 0;  // sources come in through attach_input() / attach_driver(), not inputs[]
     num_outputs = num_bits;
-    std::ostringstream oss;
-    oss << "Bus 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Bus";
     allocate_IO_arrays();
 }
 
 Bus::~Bus() = default;
 
+size_t Bus::get_owned_bytes() const
+{
+    return Device::get_owned_bytes() + attached_inputs.capacity() * sizeof(bool*) +
+           drivers.capacity() * sizeof(Driver);
+}
+
 void Bus::evaluate()
 {
-    // If no inputs are connected, output is all zeros
-    if (inputs.empty()) {
-        for (uint16_t i = 0; i < num_bits; ++i) {
-            outputs[i] = false;
-        }
-        return;
-    }
-    
-    // Bitwise OR all inputs together for each bit position
+    Profiler::Scope profile_scope(this);
+    // Bitwise OR all always-on inputs together for each bit position
     for (uint16_t i = 0; i < num_bits; ++i) {
         outputs[i] = false;
-        for (bool* input : inputs) {
+        for (bool* input : attached_inputs) {
             outputs[i] = outputs[i] || input[i];
         }
     }
+
+    if (mode == Mode::ONE_HOT)
+    {
+        const uint32_t driver = _find_one_hot_driver();
+        if (driver == NO_DRIVER)
+        {
+            active_driver = NO_DRIVER;
+            return;
+        }
+        if (trusted_one_hot || !_others_enabled(driver))
+        {
+            active_driver = driver;
+            const bool* data = drivers[driver].data;
+            for (uint16_t i = 0; i < num_bits; ++i)
+                outputs[i] = outputs[i] || data[i];
+            return;
+        }
+    }
+    // WIRED_OR, or a ONE_HOT bus with several drivers enabled: read their OR
+    _evaluate_wired_or();
+}
+
+bool Bus::_others_enabled(uint32_t driver) const
+{
+    for (uint32_t d = 0; d < drivers.size(); ++d)
+    {
+        if (d != driver && *drivers[d].enable)
+            return true;
+    }
+    return false;
+}
+
+uint32_t Bus::_find_one_hot_driver() const
+{
+    const uint32_t num_drivers = static_cast<uint32_t>(drivers.size());
+    if (active_hint < num_drivers && *drivers[active_hint].enable)
+        return active_hint;
+    if (active_driver < num_drivers && *drivers[active_driver].enable)
+        return active_driver;
+    for (uint32_t d = 0; d < num_drivers; ++d)
+    {
+        if (*drivers[d].enable)
+            return d;
+    }
+    return NO_DRIVER;
+}
+
+void Bus::_evaluate_wired_or()
+{
+    uint32_t num_enabled = 0;
+    active_driver = NO_DRIVER;
+    for (uint32_t d = 0; d < drivers.size(); ++d)
+    {
+        if (!*drivers[d].enable)
+            continue;
+        if (num_enabled++ == 0)
+            active_driver = d;
+        for (uint16_t i = 0; i < num_bits; ++i)
+            outputs[i] = outputs[i] || drivers[d].data[i];
+    }
+    if (num_enabled <= 1)
+        return;
+
+    active_driver = NO_DRIVER;
+    ++contention_count;
+    if (contention_warnings)
+        Console::err() << "Warning: " << get_component_name() << " - " << num_enabled
+                       << " drivers enabled at once, reading their OR" << std::endl;
+}
+
+void Bus::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // A source that always drives pairs with itself: AND(x, x) = x
+    std::vector<const bool*> pairs;
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        pairs.clear();
+        for (bool* input : attached_inputs)
+        {
+            pairs.push_back(&input[i]);
+            pairs.push_back(&input[i]);
+        }
+        for (const Driver& driver : drivers)
+        {
+            pairs.push_back(driver.enable);
+            pairs.push_back(&driver.data[i]);
+        }
+        if (pairs.empty())
+            netlist.emit_const(&outputs[i], false);
+        else
+            netlist.emit(Netlist::Op_Type::AND_OR, pairs.data(), static_cast<uint16_t>(pairs.size()), &outputs[i]);
+    }
 }
 
 void Bus::attach_input(bool* input_signal)
 {
     if (input_signal != nullptr) {
-        inputs.push_back(input_signal);
+        attached_inputs.push_back(input_signal);
     }
 }
 
 void Bus::detach_input(bool* input_signal)
 {
-    auto it = std::find(inputs.begin(), inputs.end(), input_signal);
-    if (it != inputs.end()) {
-        inputs.erase(it);
+    auto it = std::find(attached_inputs.begin(), attached_inputs.end(), input_signal);
+    if (it != attached_inputs.end()) {
+        attached_inputs.erase(it);
     }
 }
 
+uint32_t Bus::attach_driver(const bool* data, const bool* enable)
+{
+    if (data == nullptr || enable == nullptr)
+    {
+        Console::err() << "Error: " << get_component_name() << " - attach_driver() needs data and enable signals" << std::endl;
+        return NO_DRIVER;
+    }
+    drivers.push_back({ data, enable });
+    return static_cast<uint32_t>(drivers.size() - 1);
+}
@@ -1,19 +1,115 @@
 #pragma once
 #include "Device.hpp"
+#include <cstdint>
 #include <vector>
 
+/**
+ * @brief num_bits-wide shared bus
+ *
+ * Two kinds of sources:
+ *   - attach_input()  : always drives; ORed into every evaluate()
+ *   - attach_driver() : tri-state driver, drives its data only while its
+ *                       enable signal is high
+ *
+ * Modes (chosen at construction) decide how the enabled driver is found:
+ *   - WIRED_OR : every evaluate() scans all enables and ORs the data of each
+ *                enabled driver (O(drivers + bits) for one enabled driver)
+ *   - ONE_HOT  : the drivers are expected to be one-hot (e.g. gated by a
+ *                Decoder). evaluate() finds an enabled driver, checking the
+ *                set_active_hint() driver, then the last active driver, then
+ *                scanning from driver 0, confirms no other enable is high
+ *                (one bool read per driver) and copies that one driver's
+ *                bits, without ORing every driver's data
+ *
+ * When several drivers are enabled both modes read their OR (the gate-level
+ * result, as compile() gives) and get_contention_count() counts the
+ * evaluate(). With contention warnings on, each contended evaluate() also
+ * prints a warning to Console::err().
+ *
+ * set_trusted_one_hot() drops the ONE_HOT check for other enabled drivers,
+ * for buses whose enables come straight from a Decoder (the Main_Memory and
+ * Program_Memory read buses). A read is then O(bits) when the hint or last
+ * driver is enabled. Contention is neither detected nor counted: a trusted
+ * bus with several drivers enabled reads one of them, so it only matches
+ * compile() while the enables really are one-hot.
+ *
+ * compile() emits one AND_OR op per bit over (enable, data) pairs, so the
+ * netlist has plain OR semantics whatever the mode.
+ */
 class Bus : public Device
 {
 public:
-    Bus(uint16_t num_bits, const std::string& name = "");
+    enum class Mode : uint8_t
+    {
+        WIRED_OR,
+        ONE_HOT
+    };
+
+    /// get_active_driver() when no driver (or more than one) is enabled
+    static constexpr uint32_t NO_DRIVER = UINT32_MAX;
+
+    Bus(uint16_t num_bits, const std::string& name = "", Mode mode = Mode::WIRED_OR);
     ~Bus() override;
-    
+
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
     void attach_input(bool* input_signal);
     void detach_input(bool* input_signal);
     const bool* get_outputs() const { return outputs; }
-    
+
+    /**
+     * @brief Attach a tri-state driver
+     *
+     * @param data   num_bits data signals (LSB first), read while enabled
+     * @param enable Signal that puts `data` on the bus while high
+     * @return Driver index, for set_active_hint()
+     */
+    uint32_t attach_driver(const bool* data, const bool* enable);
+
+    /** @brief Number of attached tri-state drivers. */
+    uint32_t get_num_drivers() const { return static_cast<uint32_t>(drivers.size()); }
+
+    /** @brief ONE_HOT: driver to check first on the next evaluate() (e.g. a decoded address). */
+    void set_active_hint(uint32_t driver) { active_hint = driver; }
+
+    /** @brief Driver read by the last evaluate(), or NO_DRIVER. */
+    uint32_t get_active_driver() const { return active_driver; }
+
+    /** @brief Print a warning to Console::err() for every evaluate() that finds several drivers enabled. */
+    void set_contention_warnings(bool enabled) { contention_warnings = enabled; }
+
+    /** @brief ONE_HOT: read the first enabled driver found without checking the others (see class comment). */
+    void set_trusted_one_hot(bool trusted) { trusted_one_hot = trusted; }
+
+    /** @brief Number of evaluate() calls that found several drivers enabled (not counted on a trusted one-hot bus). */
+    uint64_t get_contention_count() const { return contention_count; }
+
+    Mode get_mode() const { return mode; }
+
 private:
-    std::vector<bool*> inputs;
-};
+    struct Driver
+    {
+        const bool* data;
+        const bool* enable;
+    };
 
+    /// Scan every enable; OR the enabled drivers' data into outputs.
+    void _evaluate_wired_or();
+
+    /// A driver whose enable is high, checking the hint and last active driver first (ONE_HOT).
+    uint32_t _find_one_hot_driver() const;
+
+    /// Whether any driver other than `driver` is enabled.
+    bool _others_enabled(uint32_t driver) const;
+
+    Mode mode = Mode::WIRED_OR;
+    std::vector<bool*>  attached_inputs;  ///< always-driving sources
+    std::vector<Driver> drivers;          ///< tri-state sources
+    uint32_t active_hint = NO_DRIVER;
+    uint32_t active_driver = NO_DRIVER;
+    bool     contention_warnings = false;
+    bool     trusted_one_hot = false;
+    uint64_t contention_count = 0;
+};
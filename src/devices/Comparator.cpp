@@ -1,18 +1,12 @@
 #include "Comparator.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 Comparator::Comparator(uint16_t num_bits, const std::string& name)
 : Device(num_bits, name),
   subtractor(num_bits)
 {
-    std::ostringstream oss;
-    oss << "Comparator 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Comparator";
     
     // Inputs: A (num_bits) + B (num_bits)
     num_inputs = 2 * num_bits;
@@ -37,6 +31,17 @@ Comparator::Comparator(uint16_t num_bits, const std::string& name)
     not_n_xor_v = new Inverter(1, "not_n_xor_v_in_comparator");
     gt_u_and = new AND_Gate(2, "gt_u_and_in_comparator");
     gt_s_and = new AND_Gate(2, "gt_s_and_in_comparator");
+    
+    // Wire the flag decoding; A and B reach the subtractor through connect_input()
+    not_z->connect_input(&subtractor.get_outputs()[num_bits + 0], 0);          // NEQ = !Z
+    not_c->connect_input(&subtractor.get_outputs()[num_bits + 2], 0);          // LT_U = !C
+    n_xor_v->connect_input(&subtractor.get_outputs()[num_bits + 1], 0);        // LT_S = N XOR V
+    n_xor_v->connect_input(&subtractor.get_outputs()[num_bits + 3], 1);
+    not_n_xor_v->connect_input(&n_xor_v->get_outputs()[0], 0);                 // !(N XOR V)
+    gt_u_and->connect_input(&subtractor.get_outputs()[num_bits + 2], 0);       // GT_U = C && !Z
+    gt_u_and->connect_input(&not_z->get_outputs()[0], 1);
+    gt_s_and->connect_input(&not_n_xor_v->get_outputs()[0], 0);                // GT_S = !(N XOR V) && !Z
+    gt_s_and->connect_input(&not_z->get_outputs()[0], 1);
 }
 
 Comparator::~Comparator()
@@ -50,20 +55,17 @@ Comparator::~Comparator()
     delete gt_s_and;
 }
 
+bool Comparator::connect_input(const bool* const upstream_output_p, uint16_t input_index)
+{
+    if (!Component::connect_input(upstream_output_p, input_index))
+        return false;
+    // A and B have the same layout on the subtractor
+    return subtractor.connect_input(upstream_output_p, input_index);
+}
+
 void Comparator::evaluate()
 {
-    // Wire A inputs to subtractor
-    for (uint16_t i = 0; i < num_bits; ++i)
-    {
-        subtractor.connect_input(inputs[i], i);
-    }
-    
-    // Wire B inputs to subtractor
-    for (uint16_t i = 0; i < num_bits; ++i)
-    {
-        subtractor.connect_input(inputs[num_bits + i], num_bits + i);
-    }
-    
+    Profiler::Scope profile_scope(this);
     // Evaluate always_high signal and subtractor
     always_high->evaluate();
     subtractor.evaluate();
@@ -77,30 +79,21 @@ void Comparator::evaluate()
     // Decode flags into comparison results using gates
     
     // NEQ = !Z
-    not_z->connect_input(&subtractor.get_outputs()[num_bits + 0], 0);
     not_z->evaluate();
     
     // LT_U = !C
-    not_c->connect_input(&subtractor.get_outputs()[num_bits + 2], 0);
     not_c->evaluate();
     
     // LT_S = N XOR V
-    n_xor_v->connect_input(&subtractor.get_outputs()[num_bits + 1], 0);
-    n_xor_v->connect_input(&subtractor.get_outputs()[num_bits + 3], 1);
     n_xor_v->evaluate();
     
     // !(N XOR V) for GT_S
-    not_n_xor_v->connect_input(&n_xor_v->get_outputs()[0], 0);
     not_n_xor_v->evaluate();
     
     // GT_U = C && !Z
-    gt_u_and->connect_input(&subtractor.get_outputs()[num_bits + 2], 0);
-    gt_u_and->connect_input(&not_z->get_outputs()[0], 1);
     gt_u_and->evaluate();
     
     // GT_S = !(N XOR V) && !Z
-    gt_s_and->connect_input(&not_n_xor_v->get_outputs()[0], 0);
-    gt_s_and->connect_input(&not_z->get_outputs()[0], 1);
     gt_s_and->evaluate();
     
     // Assign outputs
@@ -111,3 +104,30 @@ void Comparator::evaluate()
     outputs[4] = n_xor_v->get_output(0);         // LT_S = N XOR V
     outputs[5] = gt_s_and->get_output(0);        // GT_S = !(N XOR V) && !Z
 }
+
+void Comparator::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    subtractor.compile(netlist);
+    not_z->compile(netlist);
+    not_c->compile(netlist);
+    n_xor_v->compile(netlist);
+    not_n_xor_v->compile(netlist);
+    gt_u_and->compile(netlist);
+    gt_s_and->compile(netlist);
+
+    netlist.emit_buffer(&subtractor.get_outputs()[num_bits + 0], &outputs[0]);
+    netlist.emit_buffer(not_z->get_outputs(), &outputs[1]);
+    netlist.emit_buffer(not_c->get_outputs(), &outputs[2]);
+    netlist.emit_buffer(gt_u_and->get_outputs(), &outputs[3]);
+    netlist.emit_buffer(n_xor_v->get_outputs(), &outputs[4]);
+    netlist.emit_buffer(gt_s_and->get_outputs(), &outputs[5]);
+}
+
+void Comparator::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(subtractor);
+    for (Component* child : std::initializer_list<Component*>{ always_high, not_z, not_c, n_xor_v,
+                                                                not_n_xor_v, gt_u_and, gt_s_and })
+        visit(*child);
+}
@@ -29,7 +29,11 @@ class Comparator : public Device
 public:
     Comparator(uint16_t num_bits, const std::string& name = "");
     ~Comparator() override;
+    bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
 private:
     Adder_Subtractor subtractor;  // Computes A-B for comparison
@@ -1,18 +1,12 @@
 #include "Decoder.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
 
-Decoder::Decoder(uint16_t num_bits, const std::string& name)
+Decoder::Decoder(uint16_t num_bits, const std::string& name, Structure structure)
     : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Decoder 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Decoder";
     
     // Set num_inputs from num_bits parameter
     num_inputs = num_bits;
@@ -21,37 +15,90 @@ Decoder::Decoder(uint16_t num_bits, const std::string& name)
     
     num_outputs = static_cast<uint16_t>(1u << num_inputs); // left-shift 1 by num_inputs to get 2^n outputs
     allocate_IO_arrays();
+
+    if (structure == Structure::PREDECODED && num_inputs >= 2)
+    {
+        _build_predecoded();
+        return;
+    }
     
     input_inverters = new Inverter*[num_inputs];
     for (uint16_t i = 0; i < num_inputs; ++i)
     {
-        std::string inv_name_str;
-        if (!name.empty())
-            inv_name_str = name + "_inverter_" + std::to_string(i);
-        else
-            inv_name_str = "inverter_" + std::to_string(i) + "_in_decoder";
-        input_inverters[i] = new Inverter(1, inv_name_str);
+        input_inverters[i] = new Inverter(1);
+        input_inverters[i]->set_name_parent(this, i);
     }
     
+    // Child indices: inverters first, then output ANDs (see child_name())
+    output_ands = new AND_Gate*[num_outputs];
+    for (uint16_t i = 0; i < num_outputs; ++i)
+    {
+        output_ands[i] = new AND_Gate(num_inputs);
+        output_ands[i]->set_name_parent(this, num_inputs + i);
+    }
+}
+
+void Decoder::_build_predecoded()
+{
+    structure = Structure::PREDECODED;
+    low_bits = static_cast<uint16_t>(num_inputs / 2);
+
+    // Child indices: low and high predecoders first, then output ANDs (see child_name())
+    predecoders[0] = new Decoder(low_bits);
+    predecoders[1] = new Decoder(static_cast<uint16_t>(num_inputs - low_bits));
+    predecoders[0]->set_name_parent(this, 0);
+    predecoders[1]->set_name_parent(this, 1);
+
+    // Each output ANDs one line of each predecoder; these connections never change
+    const uint16_t low_mask = static_cast<uint16_t>((1u << low_bits) - 1);
     output_ands = new AND_Gate*[num_outputs];
     for (uint16_t i = 0; i < num_outputs; ++i)
     {
-        std::string and_name_str;
-        if (!name.empty())
-            and_name_str = name + "_output_and_" + std::to_string(i);
+        output_ands[i] = new AND_Gate(2);
+        output_ands[i]->set_name_parent(this, 2 + i);
+        output_ands[i]->connect_input(&predecoders[0]->get_outputs()[i & low_mask], 0);
+        output_ands[i]->connect_input(&predecoders[1]->get_outputs()[i >> low_bits], 1);
+    }
+}
+
+std::string Decoder::child_name(uint32_t index) const
+{
+    std::string child;
+    std::string position;
+    if (structure == Structure::PREDECODED)
+    {
+        if (index < 2)
+            child = index == 0 ? "predecoder_low" : "predecoder_high";
         else
-            and_name_str = "output_and_" + std::to_string(i) + "_in_decoder";
-        output_ands[i] = new AND_Gate(num_inputs, and_name_str);
+        {
+            child = "output_and_";
+            position = std::to_string(index - 2);
+        }
     }
+    else
+    {
+        const bool is_inverter = index < num_inputs;
+        child = is_inverter ? "inverter_" : "output_and_";
+        position = std::to_string(is_inverter ? index : index - num_inputs);
+    }
+    const std::string name = get_given_name();
+    if (name.empty())
+        return child + position + "_in_decoder";
+    return name + "_" + child + position;
 }
 
 Decoder::~Decoder()
 {
-    for (uint16_t i = 0; i < num_inputs; ++i)
+    if (input_inverters)
     {
-        delete input_inverters[i];
+        for (uint16_t i = 0; i < num_inputs; ++i)
+        {
+            delete input_inverters[i];
+        }
+        delete[] input_inverters;
     }
-    delete[] input_inverters;
+    delete predecoders[0];
+    delete predecoders[1];
     if (output_ands)
     {
         for (uint16_t i = 0; i < num_outputs; ++i)
@@ -62,6 +109,12 @@ Decoder::~Decoder()
     }
 }
 
+size_t Decoder::get_owned_bytes() const
+{
+    const size_t num_children = structure == Structure::PREDECODED ? 2u + num_outputs : num_inputs + num_outputs;
+    return Device::get_owned_bytes() + num_children * sizeof(Component*);
+}
+
 bool Decoder::connect_input(const bool* const upstream_output_p, uint16_t input_index)
 {
     if (!Component::connect_input(upstream_output_p, input_index))
@@ -69,6 +122,14 @@ bool Decoder::connect_input(const bool* const upstream_output_p, uint16_t input_
     
     if (input_index >= num_inputs)
         return false;
+
+    // Predecoded: the input only feeds its predecoder
+    if (structure == Structure::PREDECODED)
+    {
+        if (input_index < low_bits)
+            return predecoders[0]->connect_input(inputs[input_index], input_index);
+        return predecoders[1]->connect_input(inputs[input_index], static_cast<uint16_t>(input_index - low_bits));
+    }
     
     // Wire input to its inverter
     input_inverters[input_index]->connect_input(inputs[input_index], 0);
@@ -98,9 +159,18 @@ bool Decoder::connect_input(const bool* const upstream_output_p, uint16_t input_
 
 void Decoder::evaluate()
 {
-    for (uint16_t i = 0; i < num_inputs; ++i)
+    Profiler::Scope profile_scope(this);
+    if (structure == Structure::PREDECODED)
     {
-        input_inverters[i]->evaluate();
+        predecoders[0]->evaluate();
+        predecoders[1]->evaluate();
+    }
+    else
+    {
+        for (uint16_t i = 0; i < num_inputs; ++i)
+        {
+            input_inverters[i]->evaluate();
+        }
     }
     for (uint16_t i = 0; i < num_outputs; ++i)
     {
@@ -109,4 +179,43 @@ void Decoder::evaluate()
     }
 }
 
+void Decoder::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    if (structure == Structure::PREDECODED)
+    {
+        predecoders[0]->compile(netlist);
+        predecoders[1]->compile(netlist);
+    }
+    else
+    {
+        for (uint16_t i = 0; i < num_inputs; ++i)
+        {
+            input_inverters[i]->compile(netlist);
+        }
+    }
+    for (uint16_t i = 0; i < num_outputs; ++i)
+    {
+        output_ands[i]->compile(netlist);
+        netlist.emit_buffer(output_ands[i]->get_outputs(), &outputs[i]);
+    }
+}
 
+void Decoder::for_each_child(const std::function<void(Component&)>& visit)
+{
+    if (input_inverters)
+    {
+        for (uint16_t i = 0; i < num_inputs; ++i)
+            visit(*input_inverters[i]);
+    }
+    for (Decoder* predecoder : predecoders)
+    {
+        if (predecoder)
+            visit(*predecoder);
+    }
+    if (output_ands)
+    {
+        for (uint16_t i = 0; i < num_outputs; ++i)
+            visit(*output_ands[i]);
+    }
+}
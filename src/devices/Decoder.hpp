@@ -20,17 +20,46 @@
  *   inputs: 01 → outputs[1]=1
  *   inputs: 10 → outputs[2]=1
  *   inputs: 11 → outputs[3]=1
+ * 
+ * Structures (chosen at construction, same inputs and outputs either way):
+ *   - FLAT       : num_inputs inverters and 2^n AND gates of n inputs each
+ *   - PREDECODED : the low n/2 and high n - n/2 selector bits each drive a
+ *                  FLAT predecoder, and output i ANDs low line (i mod 2^(n/2))
+ *                  with high line (i >> n/2), as in an SRAM row decoder.
+ *                  2^n 2-input ANDs plus two small predecoders: 9 bits read
+ *                  1,248 gate inputs per evaluate() instead of 4,608.
  */
 class Decoder : public Device
 {
 public:
+    enum class Structure : uint8_t
+    {
+        FLAT,
+        PREDECODED
+    };
+
+    /// Narrowest decoder wide_structure() predecodes.
+    static constexpr uint16_t predecode_min_bits = 9;
+
     /**
      * @brief Constructs a decoder with num_inputs selector bits
      * 
      * @param num_bits Number of selector inputs (outputs = 2^num_bits)
      * @param name Optional name identifier for this component
+     * @param structure FLAT or PREDECODED (PREDECODED needs at least 2 bits,
+     *                  narrower decoders are built FLAT)
+     */
+    Decoder(uint16_t num_bits, const std::string& name = "", Structure structure = Structure::FLAT);
+
+    /**
+     * @brief Structure for an address decoder of num_bits: PREDECODED from
+     *        predecode_min_bits up, FLAT below (where it keeps the gate count
+     *        and depth of the small decoders unchanged).
      */
-    Decoder(uint16_t num_bits, const std::string& name = "");
+    static Structure wide_structure(uint16_t num_bits)
+    {
+        return num_bits >= predecode_min_bits ? Structure::PREDECODED : Structure::FLAT;
+    }
     
     ~Decoder() override;
     
@@ -47,8 +76,29 @@ public:
      * @brief Evaluates the decoder (propagates through inverters and AND gates)
      */
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
+    void for_each_child(const std::function<void(Component&)>& visit) override;
+
+    Structure get_structure() const { return structure; }
     
+protected:
+    /**
+     * "<name>_inverter_<i>" / "<name>_output_and_<k>" (FLAT) or
+     * "<name>_predecoder_low" / "<name>_predecoder_high" / "<name>_output_and_<k>"
+     * (PREDECODED), or "..._in_decoder" when unnamed.
+     */
+    std::string child_name(uint32_t index) const override;
+
 private:
-    Inverter** input_inverters; // one per input
-    AND_Gate** output_ands; // array of pointers to AND_Gate objects (one per output)
+    /// PREDECODED constructor body: predecoders and 2-input output ANDs.
+    void _build_predecoded();
+
+    Structure structure = Structure::FLAT;
+    uint16_t  low_bits = 0;               ///< PREDECODED: selector bits in the low predecoder
+
+    Inverter** input_inverters = nullptr; // one per input (FLAT)
+    Decoder*   predecoders[2] = {};       // low and high selector bits (PREDECODED)
+    AND_Gate** output_ands = nullptr; // array of pointers to AND_Gate objects (one per output)
 };
@@ -19,6 +19,7 @@ class Device : public Component
 public:
     Device(uint16_t num_bits, const std::string& name = "");
     virtual ~Device();
+    size_t get_object_size() const override { return sizeof(*this); }
     
 protected:
     uint16_t num_bits;
@@ -1,16 +1,10 @@
 #include "Divider_Sequential.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 
 Divider_Sequential::Divider_Sequential(uint16_t num_bits, const std::string& name) : Device(num_bits, name), cycle_count(0)
 {
-    std::ostringstream oss;
-    oss << "Divider_Sequential 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Divider_Sequential";
     
     num_inputs = 2 * num_bits + 2;  // dividend (num_bits) + divisor (num_bits) + start + output_enable
     num_outputs = 2 * num_bits + 1; // quotient (num_bits) + remainder (num_bits) + busy
@@ -67,7 +61,7 @@ Divider_Sequential::Divider_Sequential(uint16_t num_bits, const std::string& nam
     }
     
     // Allocate dividend bit storage
-    dividend_bits = new bool[num_bits];
+    dividend_bits = new bool[num_bits]();
     
     // Connect read enables (always high for combinational access)
     quotient->connect_input(&read_enable->get_outputs()[0], num_bits + 1);
@@ -102,6 +96,16 @@ Divider_Sequential::~Divider_Sequential()
     delete[] dividend_bits;
 }
 
+void Divider_Sequential::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (Component* child : std::initializer_list<Component*>{ quotient, remainder, divisor, busy_flag,
+                                                                subtractor, shift_left_rem, shift_left_quot,
+                                                                write_enable, read_enable, zero_signal, one_signal })
+        visit(*child);
+    for (uint16_t i = 0; i < 2 * num_bits; ++i)
+        visit(*output_AND_gates[i]);
+}
+
 bool Divider_Sequential::connect_input(const bool* const upstream_output_p, uint16_t input_index)
 {
     if (!Component::connect_input(upstream_output_p, input_index))
@@ -177,6 +181,7 @@ bool Divider_Sequential::is_busy() const
 
 void Divider_Sequential::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     if (is_busy())
     {
     
@@ -0,0 +1,67 @@
+#pragma once
+#include "Device.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+
+/**
+ * @brief Ripple-carry adder with its width fixed at compile time
+ *
+ * Same layout as Adder: inputs are A[0..N-1] then B[0..N-1] (LSB first),
+ * outputs are the N sum bits; carry-in is 0 and the carry out is dropped.
+ * evaluate() ripples the carry through one unrolled loop instead of N
+ * Full_Adders of gates.
+ */
+template <uint16_t N>
+class Fixed_Adder final : public Device
+{
+    static_assert(N > 0, "Fixed_Adder needs at least one bit");
+
+public:
+    /**
+     * @brief Constructs an N-bit adder
+     *
+     * @param name Optional name identifier for this component
+     */
+    explicit Fixed_Adder(const std::string& name = "") : Device(N, name)
+    {
+        class_name = "Fixed_Adder";
+
+        num_inputs = 2 * N;  // A (N) + B (N)
+        num_outputs = N;     // Sum (N)
+        initialize_IO_arrays();
+    }
+
+    void evaluate() override
+    {
+        Profiler::Scope profile_scope(this);
+        if (!inputs_verified && !verify_inputs())
+            return;
+        bool carry = false;
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            const bool a = *inputs[i];
+            const bool b = *inputs[N + i];
+            const bool half = a != b;
+            outputs[i] = half != carry;
+            carry = (a && b) || (half && carry);
+        }
+    }
+
+    void compile(Netlist& netlist) override
+    {
+        Netlist::Scope netlist_scope(netlist, this);
+        const bool* carry = nullptr;  // nullptr is constant low
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            const bool* half = netlist.scratch_signal();
+            netlist.emit(Netlist::Op_Type::XOR, { inputs[i], inputs[N + i] }, half);
+            netlist.emit(Netlist::Op_Type::XOR, { half, carry }, &outputs[i]);
+            if (i + 1 < N)
+            {
+                const bool* carry_out = netlist.scratch_signal();
+                netlist.emit(Netlist::Op_Type::AND_OR, { inputs[i], inputs[N + i], half, carry }, carry_out);
+                carry = carry_out;
+            }
+        }
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include "Device.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+
+/**
+ * @brief Comparator with its width fixed at compile time
+ *
+ * Same layout as Comparator: inputs are A[0..N-1] then B[0..N-1] (LSB
+ * first); outputs are EQ, NEQ, LT_U, GT_U, LT_S, GT_S. evaluate() compares
+ * the packed operands as integers instead of running an Adder_Subtractor
+ * and decoding its flags. compile() emits the subtraction A + !B + 1 and
+ * the same flag decoding (Z, N, C, V) as gates.
+ */
+template <uint16_t N>
+class Fixed_Comparator final : public Device
+{
+    static_assert(N > 0 && N <= 16, "Fixed_Comparator needs 1 to 16 bits");
+
+public:
+    /**
+     * @brief Constructs an N-bit comparator
+     *
+     * @param name Optional name identifier for this component
+     */
+    explicit Fixed_Comparator(const std::string& name = "") : Device(N, name)
+    {
+        class_name = "Fixed_Comparator";
+
+        num_inputs = 2 * N;  // A (N) + B (N)
+        num_outputs = 6;     // EQ, NEQ, LT_U, GT_U, LT_S, GT_S
+        initialize_IO_arrays();
+    }
+
+    void evaluate() override
+    {
+        Profiler::Scope profile_scope(this);
+        if (!inputs_verified && !verify_inputs())
+            return;
+        uint32_t a = 0;
+        uint32_t b = 0;
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            a |= static_cast<uint32_t>(*inputs[i]) << i;
+            b |= static_cast<uint32_t>(*inputs[N + i]) << i;
+        }
+        // Flipping the sign bit maps two's complement order onto unsigned order
+        const uint32_t sign = 1u << (N - 1);
+        outputs[0] = a == b;                       // EQ
+        outputs[1] = a != b;                       // NEQ
+        outputs[2] = a < b;                        // LT_U
+        outputs[3] = a > b;                        // GT_U
+        outputs[4] = (a ^ sign) < (b ^ sign);      // LT_S
+        outputs[5] = (a ^ sign) > (b ^ sign);      // GT_S
+    }
+
+    void compile(Netlist& netlist) override
+    {
+        Netlist::Scope netlist_scope(netlist, this);
+        using Op = Netlist::Op_Type;
+
+        // A - B = A + !B + 1, LSB first
+        const bool* carry = netlist.scratch_signal();
+        netlist.emit_const(carry, true);
+        const bool* carry_into_msb = carry;
+        const bool* sum[N];
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            const bool* not_b = netlist.scratch_signal();
+            netlist.emit(Op::NOT, { inputs[N + i] }, not_b);
+            const bool* half = netlist.scratch_signal();
+            netlist.emit(Op::XOR, { inputs[i], not_b }, half);
+            sum[i] = netlist.scratch_signal();
+            netlist.emit(Op::XOR, { half, carry }, sum[i]);
+            const bool* carry_out = netlist.scratch_signal();
+            netlist.emit(Op::AND_OR, { inputs[i], not_b, half, carry }, carry_out);
+            carry_into_msb = carry;
+            carry = carry_out;
+        }
+
+        // Z = NOR(sum), N = sum MSB, C = carry out, V = carry into MSB XOR carry out
+        const bool* z_flag = &outputs[0];
+        netlist.emit(Op::NOR, sum, N, z_flag);
+        const bool* n_xor_v = &outputs[4];
+        netlist.emit(Op::XOR, { sum[N - 1], carry_into_msb, carry }, n_xor_v);
+        netlist.emit(Op::NOT, { z_flag }, &outputs[1]);
+        netlist.emit(Op::NOT, { carry }, &outputs[2]);
+        netlist.emit(Op::AND, { carry, &outputs[1] }, &outputs[3]);
+        const bool* not_n_xor_v = netlist.scratch_signal();
+        netlist.emit(Op::NOT, { n_xor_v }, not_n_xor_v);
+        netlist.emit(Op::AND, { not_n_xor_v, &outputs[1] }, &outputs[5]);
+    }
+};
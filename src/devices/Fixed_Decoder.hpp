@@ -0,0 +1,66 @@
+#pragma once
+#include "Device.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+
+/**
+ * @brief N-to-2^N one-hot decoder with its width fixed at compile time
+ *
+ * Same layout as Decoder: inputs[0] is the least significant select bit
+ * and outputs[k] is high when the inputs spell k. evaluate() packs the
+ * select bits into an index and writes the outputs in one unrolled loop
+ * instead of evaluating N inverters and 2^N AND gates. compile() emits
+ * the same gates Decoder does.
+ */
+template <uint16_t N>
+class Fixed_Decoder final : public Device
+{
+    static_assert(N > 0 && N <= 15, "Fixed_Decoder needs 1 to 15 select bits");
+
+public:
+    static constexpr uint16_t NUM_OUTPUTS = static_cast<uint16_t>(1u << N);
+
+    /**
+     * @brief Constructs a decoder with N select inputs and 2^N outputs
+     *
+     * @param name Optional name identifier for this component
+     */
+    explicit Fixed_Decoder(const std::string& name = "") : Device(N, name)
+    {
+        class_name = "Fixed_Decoder";
+
+        num_inputs = N;
+        num_outputs = NUM_OUTPUTS;
+        initialize_IO_arrays();
+    }
+
+    void evaluate() override
+    {
+        Profiler::Scope profile_scope(this);
+        if (!inputs_verified && !verify_inputs())
+            return;
+        uint32_t selected = 0;
+        for (uint16_t i = 0; i < N; ++i)
+            selected |= static_cast<uint32_t>(*inputs[i]) << i;
+        for (uint32_t k = 0; k < NUM_OUTPUTS; ++k)
+            outputs[k] = (k == selected);
+    }
+
+    void compile(Netlist& netlist) override
+    {
+        Netlist::Scope netlist_scope(netlist, this);
+        const bool* inverted[N];
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            inverted[i] = netlist.scratch_signal();
+            netlist.emit(Netlist::Op_Type::NOT, { inputs[i] }, inverted[i]);
+        }
+        const bool* terms[N];
+        for (uint32_t k = 0; k < NUM_OUTPUTS; ++k)
+        {
+            for (uint16_t i = 0; i < N; ++i)
+                terms[i] = ((k >> i) & 1u) ? inputs[i] : inverted[i];
+            netlist.emit(Netlist::Op_Type::AND, terms, N, &outputs[k]);
+        }
+    }
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include "Device.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+
+/**
+ * @brief AND-OR multiplexer with width and source count fixed at compile time
+ *
+ * output[bit] = OR over sources of (source[s][bit] AND control[s]), as in
+ * Multiplexer, and wired through the same connect_sources* helpers. Unlike
+ * Multiplexer, the data and control signals are ordinary inputs, so
+ * connect_input() works as well:
+ *   - inputs[s * N + bit]: data bit `bit` of source `s`
+ *   - inputs[SOURCES * N + s]: control signal of source `s`
+ *
+ * evaluate() is one unrolled loop over SOURCES x N instead of SOURCES x N
+ * AND gates and N OR gates.
+ */
+template <uint16_t N, uint16_t SOURCES>
+class Fixed_Multiplexer final : public Device
+{
+    static_assert(N > 0 && SOURCES > 0, "Fixed_Multiplexer needs at least one bit and one source");
+
+public:
+    static constexpr uint16_t CONTROL_BASE = SOURCES * N;
+
+    /**
+     * @brief Constructs an N-bit multiplexer over SOURCES sources
+     *
+     * @param name Optional name identifier for this component
+     */
+    explicit Fixed_Multiplexer(const std::string& name = "") : Device(N, name)
+    {
+        class_name = "Fixed_Multiplexer";
+
+        num_inputs = CONTROL_BASE + SOURCES;
+        num_outputs = N;
+        initialize_IO_arrays();
+    }
+
+    // sources: SOURCES arrays of N data pointers; control_sigs: SOURCES control pointers
+    void connect_sources(const bool* const* const* sources, const bool* const* control_sigs)
+    {
+        for (uint16_t source = 0; source < SOURCES; ++source)
+        {
+            for (uint16_t bit = 0; bit < N; ++bit)
+                connect_source_data_bit(source, bit, sources[source][bit]);
+            connect_source_control(source, control_sigs[source]);
+        }
+    }
+
+    // sources_values: SOURCES arrays of N bool values
+    void connect_sources_from_values(const bool* const* sources_values, const bool* const* control_sigs)
+    {
+        for (uint16_t source = 0; source < SOURCES; ++source)
+        {
+            for (uint16_t bit = 0; bit < N; ++bit)
+                connect_source_data_bit(source, bit, &sources_values[source][bit]);
+            connect_source_control(source, control_sigs[source]);
+        }
+    }
+
+    void connect_source_data_bit(uint16_t source_idx, uint16_t bit_idx, const bool* data_signal)
+    {
+        connect_input(data_signal, static_cast<uint16_t>(source_idx * N + bit_idx));
+    }
+
+    void connect_source_control(uint16_t source_idx, const bool* control_signal)
+    {
+        connect_input(control_signal, static_cast<uint16_t>(CONTROL_BASE + source_idx));
+    }
+
+    void evaluate() override
+    {
+        Profiler::Scope profile_scope(this);
+        if (!inputs_verified && !verify_inputs())
+            return;
+        for (uint16_t bit = 0; bit < N; ++bit)
+        {
+            bool result = false;
+            for (uint16_t source = 0; source < SOURCES; ++source)
+                result |= *inputs[source * N + bit] && *inputs[CONTROL_BASE + source];
+            outputs[bit] = result;
+        }
+    }
+
+    void compile(Netlist& netlist) override
+    {
+        Netlist::Scope netlist_scope(netlist, this);
+        const bool* pairs[2 * SOURCES];
+        for (uint16_t bit = 0; bit < N; ++bit)
+        {
+            for (uint16_t source = 0; source < SOURCES; ++source)
+            {
+                pairs[2 * source] = inputs[source * N + bit];
+                pairs[2 * source + 1] = inputs[CONTROL_BASE + source];
+            }
+            netlist.emit(Netlist::Op_Type::AND_OR, pairs, 2 * SOURCES, &outputs[bit]);
+        }
+    }
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include "Device.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+#include "../utilities/signal_arena.hpp"
+#include <array>
+
+/**
+ * @brief Register with its width fixed at compile time
+ *
+ * Same input/output layout and helpers as Register, so either can be wired
+ * into the same place. Instead of N Memory_Bit cells (each a flip-flop and
+ * five gates, evaluated through virtual calls), the stored bits are a flat
+ * array and evaluate() is one inline loop over N, which the compiler
+ * unrolls. The class is final, so calls through a Fixed_Register (or a
+ * Part that holds one by value) are dispatched statically.
+ *
+ * The stored bits come from the active Signal_Arena when there is one, so
+ * arena snapshots (Evaluator checkpoints) include them. They are not
+ * Flip_Flops, so Computer::save_state() does not.
+ *
+ * Input layout (N + 2 total):
+ *   - inputs[0] to inputs[N-1]: data inputs for each bit
+ *   - inputs[N]: write_enable (shared)
+ *   - inputs[N+1]: read_enable (shared)
+ *
+ * Output layout (N total):
+ *   - outputs[0] to outputs[N-1]: stored data from each bit, gated by read_enable
+ */
+template <uint16_t N>
+class Fixed_Register final : public Device
+{
+    static_assert(N > 0, "Fixed_Register needs at least one bit");
+
+public:
+    /**
+     * @brief Constructs a register of N bits, all zero
+     *
+     * @param name Optional name identifier for this component
+     */
+    explicit Fixed_Register(const std::string& name = "") : Device(N, name)
+    {
+        class_name = "Fixed_Register";
+
+        num_inputs = N + 2;  // [data[0..N-1], write_enable, read_enable]
+        num_outputs = N;
+        initialize_IO_arrays();
+
+        stored = local_bits.data();
+        if (Signal_Arena* arena = Signal_Arena::get_current())
+        {
+            uint32_t first_net;
+            stored = arena->allocate_signals(N, first_net);
+        }
+        zero();
+    }
+
+    /**
+     * @brief Latches the data inputs while write_enable is high and drives
+     *        the outputs while read_enable is high
+     */
+    void evaluate() override
+    {
+        Profiler::Scope profile_scope(this);
+        if (!inputs_verified && !verify_inputs())
+            return;
+        const bool write_enable = *inputs[N];
+        const bool read_enable = *inputs[N + 1];
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            stored[i] = write_enable ? *inputs[i] : stored[i];
+            outputs[i] = stored[i] && read_enable;
+        }
+    }
+
+    void compile(Netlist& netlist) override
+    {
+        Netlist::Scope netlist_scope(netlist, this);
+        const bool* write_enable = inputs[N];
+        const bool* not_write_enable = netlist.scratch_signal();
+        netlist.emit(Netlist::Op_Type::NOT, { write_enable }, not_write_enable);
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            // Q = (WE AND D) OR (!WE AND Q)
+            netlist.emit(Netlist::Op_Type::AND_OR, { write_enable, inputs[i], not_write_enable, &stored[i] }, &stored[i]);
+            netlist.emit(Netlist::Op_Type::AND, { &stored[i], inputs[N + 1] }, &outputs[i]);
+        }
+    }
+
+    size_t get_object_size() const override { return sizeof(*this); }
+
+    /** Adds the stored bits when they came from the arena (local_bits is part of the object). */
+    size_t get_owned_bytes() const override
+    {
+        return Device::get_owned_bytes() + (stored == local_bits.data() ? 0 : N * sizeof(bool));
+    }
+
+    /** Returns the raw stored value for the given bit, bypassing the read-enable gate. */
+    bool get_stored_bit(uint16_t bit) const { return stored[bit]; }
+
+    /** Directly zeroes all stored bits without touching external connections. */
+    void zero()
+    {
+        for (uint16_t i = 0; i < N; ++i)
+        {
+            stored[i] = false;
+            outputs[i] = false;
+        }
+    }
+
+    /** Directly forces a single bit to the given value without touching external connections. */
+    void set_bit(uint16_t bit, bool value)
+    {
+        if (bit >= N)
+            return;
+        stored[bit] = value;
+        outputs[bit] = value;
+    }
+
+    /** Re-drives every output from the stored bit, as set_bit() does. */
+    void refresh_outputs()
+    {
+        for (uint16_t i = 0; i < N; ++i)
+            outputs[i] = stored[i];
+    }
+
+    /** Returns the number of data bits stored in this register. */
+    static constexpr uint16_t get_num_bits() { return N; }
+
+private:
+    std::array<bool, N> local_bits = {};  /**< Storage when no Signal_Arena is active */
+    bool* stored = nullptr;                /**< local_bits, or N signals from the arena */
+};
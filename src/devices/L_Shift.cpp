@@ -1,16 +1,9 @@
 #include "L_Shift.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/profiler.hpp"
 
 L_Shift::L_Shift(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "L_Shift 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "L_Shift";
     
     num_inputs = num_bits;
     num_outputs = num_bits;
@@ -21,6 +14,7 @@ L_Shift::~L_Shift() = default;
 
 void L_Shift::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Left shift: output[i] = input[i+1], output[num_bits-1] = 0
     // Since LSB is at index 0, this shifts left (towards lower indices)
     for (uint16_t i = 0; i < num_inputs - 1; ++i)
@@ -1,4 +1,7 @@
 #include "Multiplexer.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
 #include <iostream>
 
@@ -8,6 +11,8 @@ Multiplexer::Multiplexer(uint16_t num_bits_, uint16_t num_sources_, const std::s
       source_and_gates(nullptr),
       or_gates(nullptr)
 {
+    class_name = "Multiplexer";
+
     // Allocate source_and_gates[num_sources][num_bits]
     source_and_gates = new AND_Gate**[num_sources];
     for (uint16_t source = 0; source < num_sources; ++source)
@@ -75,6 +80,12 @@ Multiplexer::~Multiplexer()
     }
 }
 
+size_t Multiplexer::get_owned_bytes() const
+{
+    // source_and_gates[num_sources][num_bits] and or_gates[num_bits]
+    return Device::get_owned_bytes() + (num_sources + (num_sources + 1) * num_bits) * sizeof(Component*);
+}
+
 void Multiplexer::connect_sources(const bool* const* const* sources, const bool* const* control_sigs)
 {
     // For each source and each bit, connect the AND gate
@@ -122,7 +133,7 @@ bool Multiplexer::connect_input(const bool* const upstream_output_p, uint16_t in
 {
     // Not implementing generic input connection for now;
     // use connect_sources() instead to set up the data sources.
-    std::cerr << "Error: connect_input() not supported for Multiplexer '"
+    Console::err() << "Error: connect_input() not supported for Multiplexer '"
               << get_component_name() << "' (tried to connect input index "
               << input_index << "). Use connect_sources() instead." << std::endl;
               
@@ -135,6 +146,7 @@ bool Multiplexer::connect_input(const bool* const upstream_output_p, uint16_t in
 
 void Multiplexer::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate AND gates
     for (uint16_t source = 0; source < num_sources; ++source)
     {
@@ -151,3 +163,39 @@ void Multiplexer::evaluate()
         outputs[bit] = or_gates[bit]->get_output(0);
     }
 }
+
+void Multiplexer::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t source = 0; source < num_sources; ++source)
+    {
+        for (uint16_t bit = 0; bit < num_bits; ++bit)
+        {
+            source_and_gates[source][bit]->compile(netlist);
+        }
+    }
+    for (uint16_t bit = 0; bit < num_bits; ++bit)
+    {
+        or_gates[bit]->compile(netlist);
+        netlist.emit_buffer(or_gates[bit]->get_outputs(), &outputs[bit]);
+    }
+}
+
+void Multiplexer::for_each_child(const std::function<void(Component&)>& visit)
+{
+    if (source_and_gates)
+    {
+        for (uint16_t source = 0; source < num_sources; ++source)
+        {
+            if (!source_and_gates[source])
+                continue;
+            for (uint16_t bit = 0; bit < num_bits; ++bit)
+                visit(*source_and_gates[source][bit]);
+        }
+    }
+    if (or_gates)
+    {
+        for (uint16_t bit = 0; bit < num_bits; ++bit)
+            visit(*or_gates[bit]);
+    }
+}
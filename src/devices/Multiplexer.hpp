@@ -14,6 +14,10 @@ public:
 
     bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
+    void for_each_child(const std::function<void(Component&)>& visit) override;
 
     // Connect data sources and their control signals
     // sources: array of data source pointers (num_sources arrays, each with num_bits pointers)
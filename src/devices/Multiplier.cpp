@@ -1,16 +1,11 @@
 #include "Multiplier.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 
 Multiplier::Multiplier(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Multiplier 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Multiplier";
     
     num_inputs = 2 * num_bits + 1;      // A (num_bits) + B (num_bits) + output_enable
     num_outputs = 2 * num_bits;         // Product (2*num_bits)
@@ -119,6 +114,12 @@ Multiplier::Multiplier(uint16_t num_bits, const std::string& name) : Device(num_
             adder_array[stage]->connect_input(&zeros[stage]->get_outputs()[0], adder_width + num_bits + i);
         }
     }
+    
+    // Output gates: product bit AND output_enable (input 1 is wired by connect_input)
+    for (uint16_t i = 0; i < 2 * num_bits; ++i)
+    {
+        output_AND_gates[i]->connect_input(_product_bit(i), 0);
+    }
 }
 
 Multiplier::~Multiplier()
@@ -186,6 +187,7 @@ bool Multiplier::connect_input(const bool* const upstream_output_p, uint16_t inp
 
 void Multiplier::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all AND gates for partial products
     for (uint16_t row = 0; row < num_bits; ++row)
     {
@@ -201,42 +203,74 @@ void Multiplier::evaluate()
         adder_array[i]->evaluate();
     }
     
-    // Compute intermediate results
-    bool* intermediate = new bool[2 * num_bits];
-    
-    // Intermediate bit 0 comes from and_array[0][0]
-    intermediate[0] = and_array[0][0]->get_output(0);
-    
-    // Intermediate bits 1 through num_bits-1 come from first adder's LSB
-    for (uint16_t i = 0; i < num_bits - 1; ++i)
-    {
-        intermediate[i + 1] = adder_array[i]->get_output(0);
-    }
-    
-    // Final intermediate bits from last adder
-    uint16_t last_adder = num_bits - 2;
-    for (uint16_t i = 0; i < num_bits; ++i)
-    {
-        if (i + 1 < adder_array[last_adder]->get_num_outputs())
-            intermediate[num_bits + i] = adder_array[last_adder]->get_output(i + 1);
-    }
-    
     // Gate outputs through AND gates with output_enable
     for (uint16_t i = 0; i < 2 * num_bits; ++i)
     {
-        // If output_enable is connected, connect intermediate to AND gate input 0
         if (output_enable != nullptr)
         {
-            output_AND_gates[i]->connect_input(&intermediate[i], 0);
             output_AND_gates[i]->evaluate();
             outputs[i] = output_AND_gates[i]->get_output(0);
         }
         else
         {
             // If output_enable not connected, pass through directly
-            outputs[i] = intermediate[i];
+            outputs[i] = *_product_bit(i);
         }
     }
-    
-    delete[] intermediate;
-}
\ No newline at end of file
+}
+
+void Multiplier::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t row = 0; row < num_bits; ++row)
+    {
+        for (uint16_t col = 0; col < num_bits; ++col)
+        {
+            and_array[row][col]->compile(netlist);
+        }
+    }
+    for (uint16_t i = 0; i < num_bits - 1; ++i)
+    {
+        adder_array[i]->compile(netlist);
+    }
+
+    for (uint16_t i = 0; i < 2 * num_bits; ++i)
+    {
+        if (output_enable != nullptr)
+        {
+            netlist.emit(Netlist::Op_Type::AND, { _product_bit(i), output_enable }, output_AND_gates[i]->get_outputs());
+            netlist.emit_buffer(output_AND_gates[i]->get_outputs(), &outputs[i]);
+        }
+        else
+        {
+            netlist.emit_buffer(_product_bit(i), &outputs[i]);
+        }
+    }
+}
+
+void Multiplier::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        for (uint16_t j = 0; j < num_bits; ++j)
+            visit(*and_array[i][j]);
+    }
+    for (uint16_t i = 0; i + 1 < num_bits; ++i)
+        visit(*adder_array[i]);
+    for (uint16_t i = 0; i < num_bits; ++i)
+        visit(*zeros[i]);
+    for (uint16_t i = 0; i < 2 * num_bits; ++i)
+        visit(*output_AND_gates[i]);
+}
+
+const bool* Multiplier::_product_bit(uint16_t bit) const
+{
+    // Bit 0 is a partial product, bits 1..num_bits-1 each adder's LSB, the rest the last adder's upper bits
+    if (bit == 0)
+        return and_array[0][0]->get_outputs();
+    if (bit < num_bits)
+        return &adder_array[bit - 1]->get_outputs()[0];
+    const Adder* last_adder = adder_array[num_bits - 2];
+    const uint16_t index = static_cast<uint16_t>(bit - num_bits + 1);
+    return index < last_adder->get_num_outputs() ? &last_adder->get_outputs()[index] : zeros[0]->get_outputs();
+}
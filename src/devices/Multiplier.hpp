@@ -63,8 +63,14 @@ public:
      * Pure combinational operation - no state changes.
      */
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
 private:
+    /// Signal carrying product bit `bit` before output gating.
+    const bool* _product_bit(uint16_t bit) const;
+
     AND_Gate*** and_array;        // [num_bits][num_bits] AND gates for partial products
     Adder** adder_array;         // [num_bits-1] adders of increasing width
     Signal_Generator** zeros;    // Constant zero signals for shifting
@@ -1,16 +1,10 @@
 #include "Multiplier_Sequential.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 
 Multiplier_Sequential::Multiplier_Sequential(uint16_t num_bits, const std::string& name) : Device(num_bits, name), cycle_count(0)
 {
-    std::ostringstream oss;
-    oss << "Multiplier_Sequential 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Multiplier_Sequential";
     
     num_inputs = 2 * num_bits + 2;  // A (num_bits) + B (num_bits) + start + output_enable
     num_outputs = 2 * num_bits + 1; // Product (2*num_bits) + busy
@@ -94,6 +88,16 @@ Multiplier_Sequential::~Multiplier_Sequential()
     delete one_signal;
 }
 
+void Multiplier_Sequential::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (Component* child : std::initializer_list<Component*>{ accumulator, multiplicand, multiplier_reg, busy_flag,
+                                                                adder, shift_left, shift_right,
+                                                                write_enable, read_enable, zero_signal, one_signal })
+        visit(*child);
+    for (uint16_t i = 0; i < 2 * num_bits; ++i)
+        visit(*output_AND_gates[i]);
+}
+
 bool Multiplier_Sequential::connect_input(const bool* const upstream_output_p, uint16_t input_index)
 {
     if (!Component::connect_input(upstream_output_p, input_index))
@@ -167,6 +171,7 @@ bool Multiplier_Sequential::is_busy() const
 
 void Multiplier_Sequential::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     if (is_busy())
     {
     
@@ -199,7 +204,6 @@ void Multiplier_Sequential::evaluate()
     {
         shift_left->connect_input(&multiplicand->get_outputs()[i], i);
     }
-    shift_left->connect_input(&write_enable->get_outputs()[0], 2 * num_bits);  // Enable
     shift_left->evaluate();
     
     for (uint16_t i = 0; i < 2 * num_bits; ++i)
@@ -214,7 +218,6 @@ void Multiplier_Sequential::evaluate()
     {
         shift_right->connect_input(&multiplier_reg->get_outputs()[i], i);
     }
-    shift_right->connect_input(&write_enable->get_outputs()[0], num_bits);  // Enable
     shift_right->evaluate();
     
     for (uint16_t i = 0; i < num_bits; ++i)
@@ -85,6 +85,8 @@ public:
      *   - Clears busy flag when num_bits cycles completed
      */
     void evaluate() override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
     // Sequential control
     
@@ -1,16 +1,9 @@
 #include "R_Shift.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/profiler.hpp"
 
 R_Shift::R_Shift(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "R_Shift 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "R_Shift";
     
     num_inputs = num_bits;
     num_outputs = num_bits;
@@ -21,6 +14,7 @@ R_Shift::~R_Shift() = default;
 
 void R_Shift::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Right shift: output[i] = input[i-1], output[0] = 0
     // Since LSB is at index 0, this shifts right (towards higher indices)
     outputs[0] = 0;  // LSB becomes 0
@@ -1,16 +1,11 @@
 #include "Register.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+#include "../utilities/signal_arena.hpp"
 
 Register::Register(uint16_t num_bits, const std::string& name) : Device(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Register 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Register";
     
     // Set up I/O: num_bits data inputs + 2 control inputs, num_bits outputs
     num_inputs = num_bits + 2;  // [data[0..num_bits-1], write_enable, read_enable]
@@ -19,21 +14,25 @@ Register::Register(uint16_t num_bits, const std::string& name) : Device(num_bits
     allocate_IO_arrays();
     
     // Create Memory_Bit for each bit position
+    // One contiguous array, so the bits of a register sit next to each other
+    memory_bits = new Memory_Bit[num_bits];
     for (uint16_t i = 0; i < num_bits; i++)
     {
-        std::ostringstream mb_name;
-        mb_name << "memory_bit_" << i << "_in_register";
-        memory_bits.push_back(new Memory_Bit(mb_name.str()));
+        memory_bits[i].set_name_parent(this, i);
     }
+
+    if (Signal_Arena* arena = Signal_Arena::get_current())
+        arena->register_register(this);
 }
 
 Register::~Register()
 {
-    for (Memory_Bit* bit : memory_bits)
-    {
-        delete bit;
-    }
-    memory_bits.clear();
+    delete[] memory_bits;
+}
+
+std::string Register::child_name(uint32_t index) const
+{
+    return "memory_bit_" + std::to_string(index) + "_in_register";
 }
 
 bool Register::connect_input(const bool* const upstream_output_p, uint16_t input_index)
@@ -45,23 +44,23 @@ bool Register::connect_input(const bool* const upstream_output_p, uint16_t input
     if (input_index < num_bits)
     {
         // input[0..num_bits-1]: data inputs to respective memory bits
-        return memory_bits[input_index]->connect_input(inputs[input_index], 0);
+        return memory_bits[input_index].connect_input(inputs[input_index], 0);
     }
     else if (input_index == num_bits)
     {
         // input[num_bits]: write_enable to all memory bits
-        for (Memory_Bit* bit : memory_bits)
+        for (uint16_t i = 0; i < num_bits; ++i)
         {
-            bit->connect_input(inputs[num_bits], 1);
+            memory_bits[i].connect_input(inputs[num_bits], 1);
         }
         return true;
     }
     else if (input_index == num_bits + 1)
     {
         // input[num_bits+1]: read_enable to all memory bits
-        for (Memory_Bit* bit : memory_bits)
+        for (uint16_t i = 0; i < num_bits; ++i)
         {
-            bit->connect_input(inputs[num_bits + 1], 2);
+            memory_bits[i].connect_input(inputs[num_bits + 1], 2);
         }
         return true;
     }
@@ -71,56 +70,84 @@ bool Register::connect_input(const bool* const upstream_output_p, uint16_t input
 
 bool Register::get_stored_bit(uint16_t bit) const
 {
-    return memory_bits[bit]->get_stored_bit();
+    return memory_bits[bit].get_stored_bit();
+}
+
+const bool* Register::get_stored_signal(uint16_t bit) const
+{
+    return memory_bits[bit].get_stored_signal();
 }
 
 void Register::zero()
 {
-    for (size_t i = 0; i < memory_bits.size(); ++i)
+    for (uint16_t i = 0; i < num_bits; ++i)
     {
-        memory_bits[i]->force_reset();
+        memory_bits[i].force_reset();
         outputs[i] = false;
     }
 }
 
 void Register::set_bit(uint16_t bit, bool value)
 {
-    if (bit >= memory_bits.size())
+    if (bit >= num_bits)
         return;
     if (value)
     {
-        memory_bits[bit]->force_set();
+        memory_bits[bit].force_set();
         outputs[bit] = true;
     }
     else
     {
-        memory_bits[bit]->force_reset();
+        memory_bits[bit].force_reset();
         outputs[bit] = false;
     }
 }
 
+void Register::refresh_outputs()
+{
+    for (uint16_t i = 0; i < num_bits; ++i)
+        set_bit(i, memory_bits[i].get_stored_bit());
+}
+
 void Register::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate all memory bits and gather outputs
-    for (uint16_t i = 0; i < memory_bits.size(); i++)
+    for (uint16_t i = 0; i < num_bits; i++)
+    {
+        memory_bits[i].evaluate();
+        outputs[i] = memory_bits[i].get_output(0);
+    }
+}
+
+void Register::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    for (uint16_t i = 0; i < num_bits; i++)
     {
-        memory_bits[i]->evaluate();
-        outputs[i] = memory_bits[i]->get_output(0);
+        memory_bits[i].compile(netlist);
+        netlist.emit_buffer(memory_bits[i].get_outputs(), &outputs[i]);
     }
 }
 
+void Register::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (uint16_t i = 0; i < num_bits; ++i)
+        visit(memory_bits[i]);
+}
+
 // void Register::update()
 // {
 //     // Phase 2: update memory bits so stored values are latched
-//     for (uint16_t i = 0; i < memory_bits.size(); i++)
+//     for (uint16_t i = 0; i < num_bits; i++)
 //     {
-//         memory_bits[i]->update();
+//         memory_bits[i].update();
 //     }
 
 //     // Refresh outputs from memory bits after update
-//     for (uint16_t i = 0; i < memory_bits.size(); i++)
+//     for (uint16_t i = 0; i < num_bits; i++)
 //     {
-//         outputs[i] = memory_bits[i]->get_output(0);
+//         outputs[i] = memory_bits[i].get_output(0);
 //     }
 
 //     // Do not propagate updates from Register; higher-level components handle downstream updates.
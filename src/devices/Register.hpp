@@ -43,25 +43,41 @@ public:
      * @brief Evaluates all memory bits and updates outputs
      */
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
 
     /** Returns the raw stored Q value for the given bit, bypassing the read-enable gate. */
     bool get_stored_bit(uint16_t bit) const;
 
+    /** Returns the flip-flop Q signal behind the given bit (see Memory_Bit::get_stored_signal). */
+    const bool* get_stored_signal(uint16_t bit) const;
+
     /** Directly zeroes all stored bits without touching external connections. */
     void zero();
 
     /** Directly forces a single bit to the given value without touching external connections. */
     void set_bit(uint16_t bit, bool value);
 
+    /**
+     * Re-drives every output from the stored bit, as set_bit() does. Used
+     * after the underlying flip-flops were forced directly (Computer::restore_state).
+     */
+    void refresh_outputs();
+
     /** Returns the number of data bits stored in this register. */
-    uint16_t get_num_bits() const { return static_cast<uint16_t>(memory_bits.size()); }
+    uint16_t get_num_bits() const { return num_bits; }
 
     /**
      * @brief Performs update cycle: evaluates all memory bits and signals downstream
      */
     // void update() override;
 
+protected:
+    /** "memory_bit_<index>_in_register" */
+    std::string child_name(uint32_t index) const override;
+
 private:
-    std::vector<Memory_Bit*> memory_bits;  /**< Array of Memory_Bit cells */
+    Memory_Bit* memory_bits;  /**< Array of num_bits Memory_Bit cells */
 };
 
@@ -1,16 +1,11 @@
 #include "ALU.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 ALU::ALU(uint16_t num_bits, const std::string& name) : Part(num_bits, name)
 {
     // generate component name string
-    std::ostringstream oss;
-    oss << "ALU 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "ALU";
     
     // Inputs: data_a (num_bits) + data_b (num_bits) + 11 enables
     num_inputs = (2 * num_bits) + 11;
@@ -145,6 +140,7 @@ bool ALU::connect_input(const bool* const upstream_output_p, uint16_t input_inde
 
 void ALU::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Always evaluate comparator (for comparison flags)
     comparator->evaluate();
     //Check which unit's operation is enabled and evaluate it
@@ -198,6 +194,42 @@ void ALU::evaluate()
     }
 }
 
+void ALU::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // Every unit is emitted unconditionally; the enables only pick which result reaches the outputs
+    comparator->compile(netlist);
+    arithmetic_unit->compile(netlist);
+    logic_unit->compile(netlist);
+
+    const bool* arithmetic_any = netlist.scratch_signal();
+    netlist.emit(Netlist::Op_Type::OR, { add_enable, sub_enable, inc_enable, dec_enable, mul_enable }, arithmetic_any);
+    const bool* logic_any = netlist.scratch_signal();
+    netlist.emit(Netlist::Op_Type::OR, { and_enable, or_enable, xor_enable, not_enable, r_shift_enable, l_shift_enable }, logic_any);
+
+    std::vector<const bool*> arithmetic_result(num_bits);
+    std::vector<const bool*> logic_result(num_bits);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        arithmetic_result[i] = &arithmetic_unit->get_outputs()[i];
+        logic_result[i] = &logic_unit->get_outputs()[i];
+    }
+    netlist.emit_priority_select({ arithmetic_any, logic_any }, { arithmetic_result, logic_result },
+                                 outputs, num_bits);
+
+    for (uint16_t i = 0; i < 6; ++i)
+    {
+        netlist.emit_buffer(&comparator->get_outputs()[i], &outputs[num_bits + i]);
+    }
+}
+
+void ALU::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(*arithmetic_unit);
+    visit(*logic_unit);
+    visit(*comparator);
+}
+
 void ALU::print_comparator_io() const
 {
     if (comparator)
@@ -71,6 +71,16 @@ public:
      */
     void evaluate() override;
 
+    /**
+     * @brief Appends ALU gate ops to a netlist
+     *
+     * The enable checks in evaluate() become a priority select over the
+     * arithmetic and logic unit outputs.
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
+
     /**
      * @brief Debug helper: print the comparator IO inside the ALU
      */
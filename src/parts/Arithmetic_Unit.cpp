@@ -1,6 +1,6 @@
 #include "Arithmetic_Unit.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <iostream>
 
 Arithmetic_Unit::Arithmetic_Unit(uint16_t num_bits, const std::string& name) 
@@ -16,13 +16,8 @@ Arithmetic_Unit::Arithmetic_Unit(uint16_t num_bits, const std::string& name)
     constant_one_gates(nullptr),
     b_input_or_gates(nullptr)
 {
-    // create component name string
-    std::ostringstream oss;
-    oss << "Arithmetic_Unit 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    // get_component_name() formats "Arithmetic_Unit 0x<address> - name" on demand
+    class_name = "Arithmetic_Unit";
     
     // Inputs: data_a (num_bits) + data_b (num_bits) + add_enable (1) + sub_enable (1) + 
     // increment_enable (1) + decrement_enable (1) + mul_enable (1)
@@ -169,6 +164,7 @@ bool Arithmetic_Unit::connect_input(const bool* const upstream_output_p, uint16_
 
 void Arithmetic_Unit::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate the operation enable OR gates
     adder_output_enable_or->evaluate();
     adder_subtract_enable_or->evaluate();
@@ -238,6 +234,50 @@ void Arithmetic_Unit::evaluate()
     }
 }
 
+void Arithmetic_Unit::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    adder_output_enable_or->compile(netlist);
+    adder_subtract_enable_or->compile(netlist);
+    add_or_sub_or->compile(netlist);
+    inc_or_dec_or->compile(netlist);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        data_b_gates[i].compile(netlist);
+        constant_one_gates[i].compile(netlist);
+        b_input_or_gates[i].compile(netlist);
+    }
+    adder_subtractor.compile(netlist);
+    multiplier.compile(netlist);
+
+    std::vector<const bool*> sum(num_bits);
+    std::vector<const bool*> product(num_bits);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        sum[i] = &adder_subtractor.get_outputs()[i];
+        product[i] = &multiplier.get_outputs()[i];
+    }
+    netlist.emit_priority_select({ add_enable, sub_enable, inc_enable, dec_enable, mul_enable },
+                                 { sum, sum, sum, sum, product }, outputs, num_bits);
+}
+
+void Arithmetic_Unit::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(adder_subtractor);
+    visit(multiplier);
+    visit(*adder_output_enable_or);
+    visit(*adder_subtract_enable_or);
+    visit(*add_or_sub_or);
+    visit(*inc_or_dec_or);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        visit(constant_bits[i]);
+        visit(data_b_gates[i]);
+        visit(constant_one_gates[i]);
+        visit(b_input_or_gates[i]);
+    }
+}
+
 void Arithmetic_Unit::print_adder_inputs() const
 {
     std::cout << "Adder_Subtractor inputs: ";
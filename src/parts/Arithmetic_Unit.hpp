@@ -71,6 +71,16 @@ public:
      * Checks enable signals and evaluates only the selected operation.
      */
     void evaluate() override;
+
+    /**
+     * @brief Appends arithmetic unit gate ops to a netlist
+     *
+     * The multiplier is emitted unconditionally and the enable checks in
+     * evaluate() become a priority select.
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
     /**
      * @brief Debug: Print adder_subtractor inputs
@@ -1,18 +1,14 @@
 #include "CPU.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 #include <iostream>
 
 CPU::CPU(uint16_t num_bits, const std::string& opcode_string, const std::string& name, uint16_t pc_bits_param) 
     : Part(num_bits, name), low_signal(nullptr)
 {
-    std::ostringstream oss;
-    oss << "CPU 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty())
-    {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "CPU";
     
     // Parse the opcode specification first to determine opcode_bits
     parse_opcodes(opcode_string);
@@ -82,7 +78,7 @@ void CPU::parse_opcodes(const std::string& opcode_string)
         
         if (!(line_stream >> opcode_str >> operation_name))
         {
-            std::cerr << "Warning: Could not parse opcode line: " << line << std::endl;
+            Console::err() << "Warning: Could not parse opcode line: " << line << std::endl;
             continue;
         }
         
@@ -192,6 +188,11 @@ bool CPU::get_run_halt_flag() const
     return control_unit->get_run_halt_flag();
 }
 
+const bool* CPU::get_run_halt_flag_output() const
+{
+    return control_unit->get_run_halt_flag_output();
+}
+
 void CPU::set_run_halt_flag(bool state)
 {
     control_unit->set_run_halt_flag(state);
@@ -243,7 +244,7 @@ bool CPU::connect_jump_conditions(const std::vector<std::pair<std::string, uint1
         auto it = operation_to_opcode.find(operation_name);
         if (it == operation_to_opcode.end())
         {
-            std::cerr << "Warning: Jump operation '" << operation_name << "' not found in opcode mapping" << std::endl;
+            Console::err() << "Warning: Jump operation '" << operation_name << "' not found in opcode mapping" << std::endl;
             continue;  // Skip unknown operations
         }
         
@@ -290,6 +291,7 @@ void CPU::clock_tick()
 
 void CPU::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate in dependency order
     control_unit->evaluate();  // decodes opcode, computes PC, sets write-enable for flags
     alu->evaluate();            // runs comparator to produce fresh flag outputs
@@ -297,3 +299,17 @@ void CPU::evaluate()
     control_unit->evaluate_flag_register();
 }
 
+void CPU::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    control_unit->compile(netlist);
+    alu->compile(netlist);
+    control_unit->compile_flag_register(netlist);
+}
+
+void CPU::for_each_child(const std::function<void(Component&)>& visit)
+{
+    visit(*control_unit);
+    visit(*alu);
+    visit(*low_signal);
+}
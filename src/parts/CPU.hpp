@@ -45,6 +45,13 @@ public:
      * @brief Evaluates CPU internal components
      */
     void evaluate() override;
+
+    /**
+     * @brief Appends CPU gate ops to a netlist, in evaluate() order
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
     // === External Connection Methods ===
     
@@ -94,6 +101,11 @@ public:
      */
     bool get_run_halt_flag() const;
 
+    /**
+     * @brief Get pointer to the run/halt flag output in the control unit
+     */
+    const bool* get_run_halt_flag_output() const;
+
     /**
      * @brief Set the run/halt flag in the control unit.
      * @param state true = running, false = halted
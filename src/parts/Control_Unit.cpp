@@ -1,6 +1,7 @@
 #include "Control_Unit.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 #include <sstream>
-#include <iomanip>
 #include <iostream>
 
 // Delegating constructor: allow callers that omit explicit pc_bits to
@@ -14,12 +15,7 @@ Control_Unit::Control_Unit(uint16_t num_bits, uint16_t opcode_bits_param, const
 Control_Unit::Control_Unit(uint16_t num_bits, uint16_t opcode_bits_param, uint16_t pc_bits_param, const std::string& name) : Part(num_bits, name)
 {
     // === Create component name string ===
-    std::ostringstream oss;
-    oss << "Control_Unit 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Control_Unit";
     
     // === Jump Instruction Conditions === (initialized in connect_jump_instructions)
     jump_instruction_and_gates = nullptr;
@@ -293,6 +289,7 @@ Control_Unit::~Control_Unit()
 
 void Control_Unit::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Evaluate in dependency order
     
     // 0. Decode opcode early so decoder outputs are current for ALL downstream logic
@@ -349,6 +346,73 @@ void Control_Unit::evaluate()
     //return_address->evaluate();  // DISABLED: inputs not connected
 }
 
+void Control_Unit::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    // Same order as evaluate()
+    opcode_decoder->compile(netlist);
+
+    halt_or_gate->compile(netlist);
+    halt_inverter->compile(netlist);
+    run_halt_flag->compile(netlist);
+
+    for (uint16_t i = 0; i < pc_bits; ++i)
+    {
+        increment_signals[i]->compile(netlist);
+    }
+    pc_incrementer->compile(netlist);
+
+    if (jump_instruction_and_gates && num_jump_conditions > 0)
+    {
+        for (uint16_t i = 0; i < num_jump_conditions; ++i)
+        {
+            jump_instruction_and_gates[i]->compile(netlist);
+        }
+        if (jump_instructions_or_gate)
+        {
+            jump_instructions_or_gate->compile(netlist);
+        }
+    }
+
+    jump_enable_inverter->compile(netlist);
+    for (uint16_t i = 0; i < pc_bits; ++i)
+    {
+        pc_halt_and_gates[i]->compile(netlist);
+    }
+    pc_write_mux->compile(netlist);
+
+    pc->compile(netlist);
+
+    ram_page_read_enable->compile(netlist);
+    ram_page_register->compile(netlist);
+}
+
+void Control_Unit::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (Component* child : std::initializer_list<Component*>{ pc, pc_incrementer, jump_enable_inverter, pc_write_mux,
+                                                                pc_write_enable, pc_read_enable, opcode_decoder,
+                                                                flag_register, flag_write_enable, flag_read_enable,
+                                                                flag_clear_counter, clear_set, clear_reset,
+                                                                ram_page_register, ram_page_read_enable,
+                                                                default_low_signal, run_halt_flag, halt_set_signal,
+                                                                halt_or_gate, halt_inverter, default_no_halt })
+        visit(*child);
+    for (uint16_t i = 0; i < pc_bits; ++i)
+    {
+        visit(*increment_signals[i]);
+        visit(*pc_halt_and_gates[i]);
+    }
+    for (Signal_Generator& signal : *pc_set_addr_sigs)
+        visit(signal);
+    if (jump_instruction_and_gates)
+    {
+        for (uint16_t i = 0; i < num_jump_conditions; ++i)
+            visit(*jump_instruction_and_gates[i]);
+    }
+    if (jump_instructions_or_gate)
+        visit(*jump_instructions_or_gate);
+}
+
 // void Control_Unit::update()
 // {
 //     /* intentionally skips recomputing combinational logic and instead only latches sequential/storage elements 
@@ -463,6 +527,13 @@ void Control_Unit::evaluate_flag_register()
     flag_register->evaluate();
 }
 
+void Control_Unit::compile_flag_register(Netlist& netlist)
+{
+    flag_write_enable->compile(netlist);
+    flag_read_enable->compile(netlist);
+    flag_register->compile(netlist);
+}
+
 bool Control_Unit::connect_flag_write_enable(const bool* signal_ptr)
 {
     if (!signal_ptr)
@@ -514,6 +585,11 @@ bool Control_Unit::get_run_halt_flag() const
     return run_halt_flag->get_outputs()[0];  // Q output
 }
 
+const bool* Control_Unit::get_run_halt_flag_output() const
+{
+    return &run_halt_flag->get_outputs()[0];
+}
+
 void Control_Unit::set_run_halt_flag(bool state)
 {
     if (state)
@@ -526,6 +602,10 @@ void Control_Unit::set_run_halt_flag(bool state)
         run_halt_flag->evaluate();
         halt_set_signal->go_low();
         halt_set_signal->evaluate();
+        // After a HALT the Reset input still holds the last decoded halt, so
+        // the pulse above met S=1,R=1 and left both latch outputs high; the
+        // next evaluate() would then fall back to Q=0. Leave a stable Q=1.
+        run_halt_flag->force_set();
     }
     else
     {
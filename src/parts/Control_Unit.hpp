@@ -61,6 +61,13 @@ public:
      * @brief Evaluates internal components
      */
     void evaluate() override;
+
+    /**
+     * @brief Appends control unit gate ops to a netlist, in evaluate() order
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
     /**
      * @brief Intentionally overriding. Updates the control unit and propagates to downstream
@@ -146,6 +153,11 @@ public:
      */
     void evaluate_flag_register();
 
+    /**
+     * @brief Netlist counterpart of evaluate_flag_register()
+     */
+    void compile_flag_register(Netlist& netlist);
+
     /**
      * @brief Connect flag write-enable to an external signal (e.g., CMP decoder output)
      *
@@ -202,10 +214,18 @@ public:
      * @return true if CPU should run, false if halted
      */
     bool get_run_halt_flag() const;
+
+    /**
+     * @brief Get pointer to the run/halt flag output (Q)
+     */
+    const bool* get_run_halt_flag_output() const;
     
     /**
      * @brief Set the run/halt flag (true=run, false=halt)
      * 
+     * Setting it to run also clears a halt latched by a HALT instruction,
+     * so the next evaluate() runs whatever instruction PC points at.
+     * 
      * @param state The desired run state
      */
     void set_run_halt_flag(bool state);
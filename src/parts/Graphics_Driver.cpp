@@ -1,19 +1,14 @@
 #include "Graphics_Driver.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/profiler.hpp"
 
 Graphics_Driver::Graphics_Driver(uint16_t num_bits, const std::string& name) : Part(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Graphics_Driver 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Graphics_Driver";
 }
 Graphics_Driver::~Graphics_Driver() = default;
 
 void Graphics_Driver::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // No combinational logic for graphics driver in this build; default no-op
 }
@@ -1,15 +1,10 @@
 #include "Logic_Unit.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
 
 Logic_Unit::Logic_Unit(uint16_t num_bits, const std::string& name) : Part(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Logic_Unit 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Logic_Unit";
     
     // Inputs: data_a (num_bits) + data_b (num_bits) + and_enable (1) + or_enable (1) + xor_enable (1) + not_enable (1) + r_shift_enable (1) + l_shift_enable (1)
     num_inputs = (2 * num_bits) + 6;
@@ -105,6 +100,7 @@ bool Logic_Unit::connect_input(const bool* const upstream_output_p, uint16_t inp
 
 void Logic_Unit::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Determine which operation is enabled and evaluate only those gates
     if (and_enable && *and_enable)
     {
@@ -167,3 +163,42 @@ void Logic_Unit::evaluate()
         }
     }
 }
+
+void Logic_Unit::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    std::vector<const bool*> and_result(num_bits), or_result(num_bits), xor_result(num_bits), not_result(num_bits);
+    std::vector<const bool*> r_shift_result(num_bits, nullptr), l_shift_result(num_bits, nullptr);
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        and_gates[i].compile(netlist);
+        or_gates[i].compile(netlist);
+        xor_gates[i].compile(netlist);
+        not_gates[i].compile(netlist);
+        and_result[i] = and_gates[i].get_outputs();
+        or_result[i] = or_gates[i].get_outputs();
+        xor_result[i] = xor_gates[i].get_outputs();
+        not_result[i] = not_gates[i].get_outputs();
+    }
+    // Shifts are plain rewiring; nullptr entries select constant low
+    for (uint16_t i = 0; i + 1 < num_bits; ++i)
+    {
+        r_shift_result[i] = data_a[i + 1];
+        l_shift_result[i + 1] = data_a[i];
+    }
+
+    netlist.emit_priority_select({ and_enable, or_enable, xor_enable, not_enable, r_shift_enable, l_shift_enable },
+                                 { and_result, or_result, xor_result, not_result, r_shift_result, l_shift_result },
+                                 outputs, num_bits);
+}
+
+void Logic_Unit::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (uint16_t i = 0; i < num_bits; ++i)
+    {
+        visit(and_gates[i]);
+        visit(or_gates[i]);
+        visit(xor_gates[i]);
+        visit(not_gates[i]);
+    }
+}
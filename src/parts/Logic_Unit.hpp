@@ -74,6 +74,16 @@ public:
      * Shift operations are performed directly; gate operations use components.
      */
     void evaluate() override;
+
+    /**
+     * @brief Appends logic unit gate ops to a netlist
+     *
+     * All four gate banks are emitted and the enable checks in evaluate()
+     * become a priority select.
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     
 private:
     AND_Gate* and_gates;
@@ -1,26 +1,30 @@
 #include "Main_Memory.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+#include "../utilities/worker_pool.hpp"
+#include <algorithm>
+#include <cstdlib>
 #include <sstream>
-#include <iomanip>
 #include <iostream>
 
-Main_Memory::Main_Memory(uint16_t address_bits, uint16_t data_bits, const std::string& name)
+Main_Memory::Main_Memory(uint16_t address_bits, uint16_t data_bits, const std::string& name, Engine engine)
     : Part(static_cast<uint16_t>(3 * address_bits + data_bits + 3), name),
-      decoder_a(address_bits),
-      decoder_b(address_bits),
-      decoder_c(address_bits)
+      engine(engine)
 {
     // make component name
-    std::ostringstream oss;
-    oss << "Main_Memory 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Main_Memory";
     
     if (address_bits == 0)
         address_bits = 1;
     if (data_bits == 0)
         data_bits = 1;
+    if (data_bits > 16 && engine != Engine::GATE_LEVEL)
+    {
+        Console::err() << "Error: " << get_component_name() << " - word-level engine supports at most 16 data bits, "
+                  << "using gate-level engine" << std::endl;
+        this->engine = Engine::GATE_LEVEL;
+    }
     
     this->address_bits = address_bits;
     this->data_bits = data_bits;
@@ -31,6 +35,20 @@ Main_Memory::Main_Memory(uint16_t address_bits, uint16_t data_bits, const std::s
     num_outputs = static_cast<uint16_t>(2 * data_bits); // 2 read outputs
     allocate_IO_arrays();
 
+    if (_has_gates())
+        _build_gate_level();
+    if (_has_words())
+        words.assign(num_addresses, 0);
+    if (this->engine == Engine::CROSS_CHECK)
+        word_outputs = new bool[num_outputs]();
+}
+
+void Main_Memory::_build_gate_level()
+{
+    decoder_a = new Decoder(address_bits, "", Decoder::wide_structure(address_bits));
+    decoder_b = new Decoder(address_bits, "", Decoder::wide_structure(address_bits));
+    decoder_c = new Decoder(address_bits, "", Decoder::wide_structure(address_bits));
+
     // Allocate register array and select-gates for each address
     registers = new Register*[num_addresses];
     write_selects = new AND_Gate*[num_addresses];
@@ -40,47 +58,82 @@ Main_Memory::Main_Memory(uint16_t address_bits, uint16_t data_bits, const std::s
     // for each address, create select gates and one memory register
     for (uint16_t addr = 0; addr < num_addresses; ++addr)
     {
-        std::ostringstream ws_name, rsa_name, rsb_name;
-        ws_name << "write_select_" << addr << "_in_main_memory";
-        rsa_name << "read_select_a_" << addr << "_in_main_memory";
-        rsb_name << "read_select_b_" << addr << "_in_main_memory";
-        write_selects[addr] = new AND_Gate(2, ws_name.str());
-        read_selects_a[addr] = new AND_Gate(2, rsa_name.str());
-        read_selects_b[addr] = new AND_Gate(2, rsb_name.str());
+        write_selects[addr] = new AND_Gate(2);
+        read_selects_a[addr] = new AND_Gate(2);
+        read_selects_b[addr] = new AND_Gate(2);
+        write_selects[addr]->set_name_parent(this, child_index(WRITE_SELECT, addr));
+        read_selects_a[addr]->set_name_parent(this, child_index(READ_SELECT_A, addr));
+        read_selects_b[addr]->set_name_parent(this, child_index(READ_SELECT_B, addr));
         
         // Connect decoder outputs to select gates (input 0)
-        write_selects[addr]->connect_input(&decoder_c.get_outputs()[addr], 0);
-        read_selects_a[addr]->connect_input(&decoder_a.get_outputs()[addr], 0);
-        read_selects_b[addr]->connect_input(&decoder_b.get_outputs()[addr], 0);
+        write_selects[addr]->connect_input(&decoder_c->get_outputs()[addr], 0);
+        read_selects_a[addr]->connect_input(&decoder_a->get_outputs()[addr], 0);
+        read_selects_b[addr]->connect_input(&decoder_b->get_outputs()[addr], 0);
         
-        // create register for this address (with hierarchical name)
-        {
-            std::ostringstream reg_name;
-            reg_name << "register_addr_" << addr << "_in_main_memory";
-            registers[addr] = new Register(data_bits, reg_name.str());
-        }
+        // create register for this address (named by child_name())
+        registers[addr] = new Register(data_bits);
+        registers[addr]->set_name_parent(this, child_index(REGISTER, addr));
+    }
+
+    // Read ports: the decoder selects exactly one driver per port
+    read_buses[0] = new Bus(data_bits, "", Bus::Mode::ONE_HOT);
+    read_buses[1] = new Bus(data_bits, "", Bus::Mode::ONE_HOT);
+    for (uint16_t port = 0; port < 2; ++port)
+    {
+        read_buses[port]->set_name_parent(this, child_index(READ_BUS, port));
+        read_buses[port]->set_trusted_one_hot(true);
+        AND_Gate** read_selects = (port == 0) ? read_selects_a : read_selects_b;
+        for (uint16_t addr = 0; addr < num_addresses; ++addr)
+            read_buses[port]->attach_driver(registers[addr]->get_outputs(), read_selects[addr]->get_outputs());
     }
 }
 
+std::string Main_Memory::child_name(uint32_t index) const
+{
+    static const char* const kinds[] = { "write_select_", "read_select_a_", "read_select_b_", "register_addr_",
+                                         "read_bus_" };
+    return kinds[index >> 16] + std::to_string(index & 0xFFFF) + "_in_main_memory";
+}
+
 Main_Memory::~Main_Memory()
 {
-    // Delete all registers
-    for (uint16_t i = 0; i < num_addresses; ++i)
-    {
-        delete registers[i];
-    }
-    delete[] registers;
-    
-    // Delete all select gates
-    for (uint16_t i = 0; i < num_addresses; ++i)
+    if (registers)
     {
-        delete write_selects[i];
-        delete read_selects_a[i];
-        delete read_selects_b[i];
+        // Delete all registers
+        for (uint16_t i = 0; i < num_addresses; ++i)
+        {
+            delete registers[i];
+        }
+        delete[] registers;
+        
+        // Delete all select gates
+        for (uint16_t i = 0; i < num_addresses; ++i)
+        {
+            delete write_selects[i];
+            delete read_selects_a[i];
+            delete read_selects_b[i];
+        }
+        delete[] write_selects;
+        delete[] read_selects_a;
+        delete[] read_selects_b;
     }
-    delete[] write_selects;
-    delete[] read_selects_a;
-    delete[] read_selects_b;
+    delete decoder_a;
+    delete decoder_b;
+    delete decoder_c;
+    delete read_buses[0];
+    delete read_buses[1];
+    delete[] word_outputs;
+}
+
+size_t Main_Memory::get_owned_bytes() const
+{
+    size_t bytes = Part::get_owned_bytes();
+    if (registers)
+        bytes += 4 * num_addresses * sizeof(Component*);  // registers, select gates
+    bytes += words.capacity() * sizeof(uint16_t);
+    if (word_outputs)
+        bytes += num_outputs * sizeof(bool);
+    return bytes;
 }
 
 bool Main_Memory::connect_input(const bool* const upstream_output_p, uint16_t input_index)
@@ -89,23 +142,31 @@ bool Main_Memory::connect_input(const bool* const upstream_output_p, uint16_t in
     if (!Component::connect_input(upstream_output_p, input_index))
         return false;
     
+    // The word-level engine reads inputs[] directly
+    if (!_has_gates())
+        return true;
+    return _connect_gate_level(input_index);
+}
+
+bool Main_Memory::_connect_gate_level(uint16_t input_index)
+{
     // Internal Connections:
     // Connect address A bits to decoder_a
     if (input_index < address_bits)
     {
-        return decoder_a.connect_input(inputs[input_index], input_index);
+        return decoder_a->connect_input(inputs[input_index], input_index);
     }
     // Connect address B bits to decoder_b
     else if (input_index < static_cast<uint16_t>(2 * address_bits))
     {
         uint16_t b_bit_index = static_cast<uint16_t>(input_index - address_bits);
-        return decoder_b.connect_input(inputs[input_index], b_bit_index);
+        return decoder_b->connect_input(inputs[input_index], b_bit_index);
     }
     // Connect address C bits to decoder_c
     else if (input_index < static_cast<uint16_t>(3 * address_bits))
     {
         uint16_t c_bit_index = static_cast<uint16_t>(input_index - 2 * address_bits);
-        return decoder_c.connect_input(inputs[input_index], c_bit_index);
+        return decoder_c->connect_input(inputs[input_index], c_bit_index);
     }
     // Connect write data bits to ALL registers
     else if (input_index < static_cast<uint16_t>(3 * address_bits + data_bits))
@@ -160,16 +221,79 @@ bool Main_Memory::connect_input(const bool* const upstream_output_p, uint16_t in
 }
 
 void Main_Memory::evaluate()
+{
+    Profiler::Scope profile_scope(this);
+    switch (engine)
+    {
+        case Engine::GATE_LEVEL:
+            _evaluate_gate_level();
+            break;
+        case Engine::WORD_LEVEL:
+            _evaluate_word_level(outputs);
+            break;
+        case Engine::CROSS_CHECK:
+            _evaluate_gate_level();
+            _evaluate_word_level(word_outputs);
+            _cross_check();
+            break;
+    }
+}
+
+void Main_Memory::set_worker_pool(Worker_Pool* pool)
+{
+    worker_pool = pool;
+    num_banks = pool ? std::min(pool->get_num_threads(), num_addresses) : 1;
+}
+
+void Main_Memory::set_read_contention_warnings(bool enabled)
+{
+    for (Bus* bus : read_buses)
+    {
+        if (bus)
+        {
+            bus->set_trusted_one_hot(!enabled);
+            bus->set_contention_warnings(enabled);
+        }
+    }
+}
+
+void Main_Memory::_evaluate_gate_level()
 {
     // Evaluate all three decoders
-    decoder_a.evaluate();
-    decoder_b.evaluate();
-    decoder_c.evaluate();
-    
-    // (debug prints removed)
-    
+    decoder_a->evaluate();
+    decoder_b->evaluate();
+    decoder_c->evaluate();
+
+    if (num_banks <= 1 || Profiler::is_enabled())
+    {
+        _evaluate_addresses(0, num_addresses);
+    }
+    else
+    {
+        worker_pool->run(num_banks, [this](size_t bank) {
+            const uint16_t first = static_cast<uint16_t>(bank * num_addresses / num_banks);
+            const uint16_t last = static_cast<uint16_t>((bank + 1) * num_addresses / num_banks);
+            _evaluate_addresses(first, last);
+        });
+    }
+
+    // Each port reads only the register its decoder selected; the address
+    // inputs name that driver, so the bus does not scan the others
+    read_buses[0]->set_active_hint(_read_address(0));
+    read_buses[1]->set_active_hint(_read_address(address_bits));
+    for (uint16_t port = 0; port < 2; ++port)
+    {
+        read_buses[port]->evaluate();
+        const bool* port_bits = read_buses[port]->get_outputs();
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+            outputs[port * data_bits + bit] = port_bits[bit];
+    }
+}
+
+void Main_Memory::_evaluate_addresses(uint16_t first, uint16_t last)
+{
     // Evaluate all select gates
-    for (uint16_t i = 0; i < num_addresses; ++i)
+    for (uint16_t i = first; i < last; ++i)
     {
         write_selects[i]->evaluate();
         read_selects_a[i]->evaluate();
@@ -177,42 +301,193 @@ void Main_Memory::evaluate()
     }
 
     // Evaluate all registers
-    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    for (uint16_t addr = first; addr < last; ++addr)
     {
         registers[addr]->evaluate();
     }
-    
-    // Manually OR outputs for port A (bits 0..data_bits-1)
-    // Use read_select_a to gate which register's output appears on port A
-    for (uint16_t bit = 0; bit < data_bits; ++bit)
+}
+
+uint16_t Main_Memory::_read_address(uint16_t first) const
+{
+    uint16_t address = 0;
+    for (uint16_t i = 0; i < address_bits; ++i)
     {
-        outputs[bit] = false;
-        for (uint16_t addr = 0; addr < num_addresses; ++addr)
+        if (inputs[first + i] && *inputs[first + i])
+            address |= static_cast<uint16_t>(1u << i);
+    }
+    return address;
+}
+
+void Main_Memory::_evaluate_word_level(bool* port_outputs)
+{
+    const uint16_t data_index = static_cast<uint16_t>(3 * address_bits);
+    const uint16_t we_index = static_cast<uint16_t>(data_index + data_bits);
+    auto input_high = [&](uint16_t idx) { return inputs[idx] != nullptr && *inputs[idx]; };
+
+    const bool we = input_high(we_index);
+    const bool re_a = input_high(we_index + 1);
+    const bool re_b = input_high(we_index + 2);
+
+    // Write first: the gate-level registers latch before the read OR
+    if (we)
+    {
+        uint16_t value = 0;
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
         {
-            // read_select_a[addr] = decoder_a[addr] & RE_A (only one active)
-            if (read_selects_a[addr]->get_outputs()[0] && registers[addr]->get_output(bit))
-            {
-                outputs[bit] = true;
-                break;  // Only one address is selected, so we can break early
-            }
+            if (input_high(data_index + bit))
+                value |= static_cast<uint16_t>(1u << bit);
         }
+        words[_read_address(static_cast<uint16_t>(2 * address_bits))] = value;
     }
-    
-    // Manually OR outputs for port B (bits data_bits..2*data_bits-1)  
-    // Use read_select_b to gate which register's output appears on port B
+
+    // RE_A gates every register output, so port B needs both enables
+    const uint16_t value_a = re_a ? words[_read_address(0)] : 0;
+    const uint16_t value_b = (re_a && re_b) ? words[_read_address(address_bits)] : 0;
     for (uint16_t bit = 0; bit < data_bits; ++bit)
     {
-        outputs[data_bits + bit] = false;
+        port_outputs[bit] = (value_a >> bit) & 1;
+        port_outputs[data_bits + bit] = (value_b >> bit) & 1;
+    }
+}
+
+void Main_Memory::_cross_check()
+{
+    bool match = true;
+    for (uint16_t i = 0; i < num_outputs; ++i)
+    {
+        if (outputs[i] != word_outputs[i])
+            match = false;
+    }
+
+    // The written word must agree too (visible through the registers only while RE_A is high)
+    const uint16_t we_index = static_cast<uint16_t>(3 * address_bits + data_bits);
+    const bool we = inputs[we_index] && *inputs[we_index];
+    const bool re_a = inputs[we_index + 1] && *inputs[we_index + 1];
+    const uint16_t address_c = _read_address(static_cast<uint16_t>(2 * address_bits));
+    uint16_t gate_value = 0;
+    for (uint16_t bit = 0; bit < data_bits; ++bit)
+        gate_value |= (registers[address_c]->get_output(bit) ? 1 : 0) << bit;
+    if (we && re_a && gate_value != words[address_c])
+        match = false;
+
+    if (match)
+        return;
+
+    ++cross_check_mismatches;
+    std::ostringstream report;
+    report << "Error: " << get_component_name() << " - cross-check mismatch (A="
+           << _read_address(0) << " B=" << _read_address(address_bits)
+           << " C=" << address_c << " WE=" << we << "): gate-level ports ";
+    for (uint16_t i = 0; i < num_outputs; ++i) report << outputs[i];
+    report << " vs word-level ";
+    for (uint16_t i = 0; i < num_outputs; ++i) report << word_outputs[i];
+    report << ", word[C] gate=" << gate_value << " word=" << words[address_c];
+    Console::err() << report.str() << std::endl;
+    if (cross_check_fail_fast)
+        std::abort();
+}
+
+void Main_Memory::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    if (engine != Engine::GATE_LEVEL)
+    {
+        Component::compile(netlist);
+        return;
+    }
+    if (netlist.is_gate_faithful())
+    {
+        _compile_gates(netlist);
+        return;
+    }
+
+    const uint16_t we_index = static_cast<uint16_t>(3 * address_bits + data_bits);
+    const bool* re_a = inputs[we_index + 1];
+    const bool* re_b = inputs[we_index + 2];
+
+    // Writes: while WE is low no register changes, so the write decoder,
+    // select gates and registers are skipped; while it is high only the
+    // selected address's register runs
+    netlist.begin_guard(inputs[we_index]);
+    decoder_c->compile(netlist);
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+        write_selects[addr]->compile(netlist);
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    {
+        netlist.begin_guard(write_selects[addr]->get_outputs());
+        registers[addr]->compile(netlist);
+        netlist.end_guard();
+    }
+    netlist.end_guard();
+
+    // Reads: each port bit indexes the stored bits by address, O(1) per bit
+    // instead of an OR across all addresses. Same value as the read buses
+    // (decoder[address] AND RE_port AND the register's RE_A-gated output),
+    // so the read decoders and select gates, which only drive those buses,
+    // are not emitted.
+    std::vector<const bool*> stored(num_addresses);
+    for (uint16_t port = 0; port < 2; ++port)
+    {
+        std::vector<const bool*> address(inputs + port * address_bits, inputs + (port + 1) * address_bits);
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+        {
+            for (uint16_t addr = 0; addr < num_addresses; ++addr)
+                stored[addr] = registers[addr]->get_stored_signal(bit);
+            const bool* row_bit = netlist.scratch_signal();
+            netlist.emit_mux(address, stored, row_bit);
+            bool* output = &outputs[port * data_bits + bit];
+            if (port == 0)
+                netlist.emit(Netlist::Op_Type::AND, { re_a, row_bit }, output);
+            else
+                netlist.emit(Netlist::Op_Type::AND, { re_a, re_b, row_bit }, output);
+        }
+    }
+}
+
+void Main_Memory::for_each_child(const std::function<void(Component&)>& visit)
+{
+    for (Decoder* decoder : { decoder_a, decoder_b, decoder_c })
+    {
+        if (decoder)
+            visit(*decoder);
+    }
+    if (registers)
+    {
         for (uint16_t addr = 0; addr < num_addresses; ++addr)
         {
-            // read_select_b[addr] = decoder_b[addr] & RE_B (only one active)
-            if (read_selects_b[addr]->get_outputs()[0] && registers[addr]->get_output(bit))
-            {
-                outputs[data_bits + bit] = true;
-                break;  // Only one address is selected, so we can break early
-            }
+            visit(*write_selects[addr]);
+            visit(*read_selects_a[addr]);
+            visit(*read_selects_b[addr]);
+            visit(*registers[addr]);
         }
     }
+    for (Bus* bus : read_buses)
+    {
+        if (bus)
+            visit(*bus);
+    }
+}
+
+void Main_Memory::_compile_gates(Netlist& netlist)
+{
+    // Every gate _evaluate_gate_level() runs, in the same order
+    decoder_a->compile(netlist);
+    decoder_b->compile(netlist);
+    decoder_c->compile(netlist);
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    {
+        write_selects[addr]->compile(netlist);
+        read_selects_a[addr]->compile(netlist);
+        read_selects_b[addr]->compile(netlist);
+    }
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+        registers[addr]->compile(netlist);
+    for (uint16_t port = 0; port < 2; ++port)
+    {
+        read_buses[port]->compile(netlist);
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+            netlist.emit_buffer(&read_buses[port]->get_outputs()[bit], &outputs[port * data_bits + bit]);
+    }
 }
 
 // void Main_Memory::update()
@@ -238,6 +513,8 @@ uint16_t Main_Memory::get_register_value(uint16_t address) const
 {
     if (address >= num_addresses)
         return 0;
+    if (!_has_gates())
+        return words[address];
     
     uint16_t value = 0;
     for (uint16_t bit = 0; bit < data_bits; ++bit)
@@ -247,10 +524,21 @@ uint16_t Main_Memory::get_register_value(uint16_t address) const
     return value;
 }
 
+const bool* Main_Memory::get_register_outputs(uint16_t address) const
+{
+    if (address >= num_addresses || !_has_gates())
+        return nullptr;
+    return registers[address]->get_outputs();
+}
+
 void Main_Memory::set_register_value(uint16_t address, uint16_t value)
 {
     if (address >= num_addresses)
         return;
+    if (_has_words())
+        words[address] = static_cast<uint16_t>(value & ((1u << data_bits) - 1));
+    if (!_has_gates())
+        return;
     
     for (uint16_t bit = 0; bit < data_bits; ++bit)
     {
@@ -258,8 +546,20 @@ void Main_Memory::set_register_value(uint16_t address, uint16_t value)
     }
 }
 
+bool Main_Memory::set_words(const std::vector<uint16_t>& saved)
+{
+    if (saved.size() != words.size())
+        return false;
+    words = saved;
+    return true;
+}
+
 void Main_Memory::zero_all()
 {
+    if (_has_words())
+        words.assign(num_addresses, 0);
+    if (!_has_gates())
+        return;
     for (uint16_t addr = 0; addr < num_addresses; ++addr)
     {
         registers[addr]->zero();
@@ -303,11 +603,7 @@ void Main_Memory::print_all_registers() const
     std::cout << "\nRAM Contents:" << std::endl;
     for (uint16_t addr = 0; addr < num_addresses; ++addr)
     {
-        uint16_t value = 0;
-        for (uint16_t bit = 0; bit < data_bits; ++bit)
-        {
-            value |= (registers[addr]->get_output(bit) ? 1 : 0) << bit;
-        }
+        uint16_t value = get_register_value(addr);
         
         // Convert value to binary string
         std::string binary;
@@ -323,6 +619,11 @@ void Main_Memory::print_all_registers() const
 void Main_Memory::print_selects() const
 {
     std::cout << "\nRAM Select Gates (write/read):" << std::endl;
+    if (!_has_gates())
+    {
+        std::cout << "  (word-level engine has no select gates)" << std::endl;
+        return;
+    }
     for (uint16_t addr = 0; addr < num_addresses; ++addr)
     {
         bool ws = write_selects[addr] ? write_selects[addr]->get_outputs()[0] : false;
@@ -339,7 +640,7 @@ void Main_Memory::print_selects() const
 void Main_Memory::print_inputs() const
 {
     // Reuse the input-formatting from print_io
-    std::cout << component_name << " inputs: ";
+    std::cout << get_component_name() << " inputs: ";
 
     auto print_range = [&](uint16_t start, uint16_t len)
     {
@@ -377,7 +678,7 @@ void Main_Memory::print_inputs() const
 
 void Main_Memory::print_outputs() const
 {
-    std::cout << component_name << " outputs: ";
+    std::cout << get_component_name() << " outputs: ";
     // Port A
     std::string outA;
     for (int i = static_cast<int>(data_bits) - 1; i >= 0; --i)
@@ -1,10 +1,13 @@
 #pragma once
 #include "Part.hpp"
+#include "../devices/Bus.hpp"
 #include "../devices/Decoder.hpp"
 #include "../devices/Register.hpp"
 #include "../components/AND_Gate.hpp"
 #include <vector>
 
+class Worker_Pool;
+
 /**
  * @brief Triple-ported Main Memory (2 read ports + 1 write port)
  * 
@@ -22,19 +25,97 @@
  * Output layout (2*data_bits total):
  *   - outputs[0..data_bits-1]         : data A output (from port A)
  *   - outputs[data_bits..2*data_bits-1] : data B output (from port B)
+ * 
+ * Engines (chosen at construction):
+ *   - GATE_LEVEL  : three Decoders, 3*2^n select AND_Gates and one Register
+ *                   per address (the reference model); the decoders are
+ *                   PREDECODED from Decoder::predecode_min_bits bits up.
+ *                   Each read port is a ONE_HOT Bus with one driver per
+ *                   address (register outputs, enabled by the read select),
+ *                   hinted with the port's address and trusted one-hot,
+ *                   so a read costs O(data_bits) instead of an OR over
+ *                   every address
+ *   - WORD_LEVEL  : one packed word per address; each evaluate() decodes the
+ *                   three addresses as integers and does one write and two
+ *                   reads, O(1) in the number of addresses
+ *   - CROSS_CHECK : builds both, drives outputs from the gate-level engine and
+ *                   asserts the word-level engine agrees: the first
+ *                   difference is reported to Console::err() and aborts
+ *                   the process (see set_cross_check_fail_fast to count
+ *                   mismatches instead)
+ * 
+ * Port semantics shared by both engines (per evaluate()):
+ *   - if WE: word[C] = data (written before the reads, so A == C reads the new value)
+ *   - port A = RE_A ? word[A] : 0
+ *   - port B = (RE_A && RE_B) ? word[B] : 0   (RE_A also gates every register output)
+ * 
+ * Banked evaluation (gate-level engine, see set_worker_pool): the decoders
+ * run on the calling thread, then the address space is split into one
+ * contiguous bank per pool thread. Each bank evaluates its select gates and
+ * registers, then the read buses run on the calling thread. Every bank
+ * writes only its own components, so the result is identical to serial
+ * evaluation.
  */
 class Main_Memory : public Part
 {
 public:
-    Main_Memory(uint16_t address_bits = 8, uint16_t data_bits = 4, const std::string& name = "");
+    enum class Engine : uint8_t
+    {
+        GATE_LEVEL,
+        WORD_LEVEL,
+        CROSS_CHECK
+    };
+
+    Main_Memory(uint16_t address_bits = 8, uint16_t data_bits = 4, const std::string& name = "",
+                Engine engine = Engine::GATE_LEVEL);
     ~Main_Memory() override;
     bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    
+    /**
+     * @brief Emit gate ops for the gate-level engine; the word-level and
+     *        cross-check engines compile to a single opaque op
+     *
+     * The write path is guarded on WE, each register on its write select;
+     * the read ports are MUX ops over the stored bits (no read decoders).
+     * A gate-faithful netlist (Netlist::set_gate_faithful) gets the gates
+     * evaluate() runs instead: all three decoders, the select gates and
+     * the read buses, unguarded.
+     */
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     // void update() override;
     
     uint16_t get_address_bits() const { return address_bits; }
     uint16_t get_data_bits() const { return data_bits; }
     uint16_t get_num_addresses() const { return num_addresses; }
+    Engine get_engine() const { return engine; }
+
+    /**
+     * @brief Evaluate the gate-level engine in banks on `pool` (not owned),
+     *        one bank per pool thread; nullptr returns to serial evaluation.
+     *        Banks run serially while the Profiler is recording.
+     */
+    void set_worker_pool(Worker_Pool* pool);
+
+    /**
+     * @brief Make the read buses check for, count and warn to Console::err()
+     *        whenever several addresses drive them at once (gate-level
+     *        engine). Off by default: the buses are trusted one-hot
+     *        (Bus::set_trusted_one_hot()), as the decoder drives them.
+     */
+    void set_read_contention_warnings(bool enabled);
+
+    /** @brief Number of evaluate() calls on which the cross-check engines disagreed. */
+    uint64_t get_cross_check_mismatches() const { return cross_check_mismatches; }
+
+    /**
+     * @brief Cross-check engine: abort on the first mismatch (the default),
+     *        or report and count every mismatch and keep running
+     */
+    void set_cross_check_fail_fast(bool enabled) { cross_check_fail_fast = enabled; }
 
     /** Directly zeroes every stored register without touching external connections. */
     void zero_all();
@@ -46,12 +127,34 @@ public:
      */
     uint16_t get_register_value(uint16_t address) const;
 
+    /**
+     * @brief Get the output signals of the register at the given address
+     * @param address The address of the register (0 to num_addresses-1)
+     * @return Pointer to data_bits output signals, or nullptr if out of range
+     *         or if there are no registers (word-level engine)
+     */
+    const bool* get_register_outputs(uint16_t address) const;
+
     /**
      * @brief Directly write a value into a register at the given address
      * @param address The address of the register (0 to num_addresses-1)
      * @param value   The value to store
      */
     void set_register_value(uint16_t address, uint16_t value);
+
+    /**
+     * @brief Word-level storage, one value per address; empty for the
+     *        gate-level engine, whose bits live in flip-flops
+     */
+    const std::vector<uint16_t>& get_words() const { return words; }
+
+    /**
+     * @brief Overwrite the word-level storage with a get_words() copy; the
+     *        registers of the cross-check engine are not touched
+     * @return false (nothing changed) if `saved` does not hold one word per
+     *         address of this engine
+     */
+    bool set_words(const std::vector<uint16_t>& saved);
     
     /**
      * @brief Print RAM contents organized by pages in a grid format
@@ -77,17 +180,66 @@ public:
     void print_inputs() const override;
     void print_outputs() const override;
 
+protected:
+    /** "write_select_<addr>_in_main_memory", "register_addr_<addr>_in_main_memory", ... */
+    std::string child_name(uint32_t index) const override;
+
 private:
+    /// Kinds of per-address children, named by child_name()
+    enum Child_Kind : uint32_t { WRITE_SELECT, READ_SELECT_A, READ_SELECT_B, REGISTER, READ_BUS };
+
+    /// Child index of the `kind` child at `addr`, for set_name_parent()
+    static uint32_t child_index(uint32_t kind, uint16_t addr) { return (kind << 16) | addr; }
+
+    /// Build decoders, select gates and registers (gate-level and cross-check engines).
+    void _build_gate_level();
+
+    /// Connect one external input to the gate-level internals.
+    bool _connect_gate_level(uint16_t input_index);
+
+    void _evaluate_gate_level();
+
+    /// Select gates and registers for addresses [first, last).
+    void _evaluate_addresses(uint16_t first, uint16_t last);
+
+    /// Gate-faithful compile(): decoders, select gates, registers and read buses.
+    void _compile_gates(Netlist& netlist);
+
+    /// Word-level evaluate; writes the port values to `port_outputs` (2*data_bits).
+    void _evaluate_word_level(bool* port_outputs);
+
+    /// Read `address_bits` inputs starting at `first` as an unsigned integer.
+    uint16_t _read_address(uint16_t first) const;
+
+    /// Compare the two engines after an evaluate() (cross-check engine only).
+    void _cross_check();
+
+    bool _has_gates() const { return engine != Engine::WORD_LEVEL; }
+    bool _has_words() const { return engine != Engine::GATE_LEVEL; }
+
     uint16_t address_bits = 0;
     uint16_t num_addresses = 0;
     uint16_t data_bits = 0;
+    Engine   engine = Engine::GATE_LEVEL;
+
+    // ── Gate-level engine ─────────────────────────────────────────────────────
+    Decoder* decoder_a = nullptr;  // Decoder for read port A
+    Decoder* decoder_b = nullptr;  // Decoder for read port B
+    Decoder* decoder_c = nullptr;  // Decoder for write port C
+    AND_Gate** write_selects = nullptr;
+    AND_Gate** read_selects_a = nullptr;
+    AND_Gate** read_selects_b = nullptr;
+    Register** registers = nullptr;  // Array of Register pointers
+    Bus* read_buses[2] = {};         // Port A and port B outputs (compiled only gate-faithful)
+
+    // ── Banked evaluation ─────────────────────────────────────────────────────
+    Worker_Pool* worker_pool = nullptr;
+    uint16_t     num_banks = 1;
 
-    Decoder decoder_a;  // Decoder for read port A
-    Decoder decoder_b;  // Decoder for read port B
-    Decoder decoder_c;  // Decoder for write port C
-    AND_Gate** write_selects;
-    AND_Gate** read_selects_a;
-    AND_Gate** read_selects_b;
-    Register** registers;  // Array of Register pointers
+    // ── Word-level engine ─────────────────────────────────────────────────────
+    std::vector<uint16_t> words;          ///< Stored value per address (bit i = data bit i)
+    bool*    word_outputs = nullptr;      ///< Cross-check only: word-level port outputs
+    uint64_t cross_check_mismatches = 0;
+    bool     cross_check_fail_fast = true;
 };
 
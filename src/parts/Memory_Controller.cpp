@@ -1,20 +1,15 @@
 #include "Memory_Controller.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../utilities/profiler.hpp"
 
 Memory_Controller::Memory_Controller(uint16_t num_bits, const std::string& name) : Part(num_bits, name)
 {
-    std::ostringstream oss;
-    oss << "Memory_Controller 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Memory_Controller";
 }
 Memory_Controller::~Memory_Controller() = default;
 
 void Memory_Controller::evaluate()
 {
+    Profiler::Scope profile_scope(this);
     // Default no-op evaluate for Memory_Controller; specialized logic may be added later
 }
 
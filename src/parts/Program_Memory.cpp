@@ -1,34 +1,47 @@
 #include "Program_Memory.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/profiler.hpp"
+#include "../utilities/worker_pool.hpp"
+#include <algorithm>
 #include <sstream>
-#include <iomanip>
 #include <iostream>
 
-Program_Memory::Program_Memory(uint16_t decoder_bits, uint16_t data_bits, const std::string& name)
+Program_Memory::Program_Memory(uint16_t decoder_bits, uint16_t data_bits, const std::string& name, Engine engine)
     : Part(static_cast<uint16_t>(decoder_bits + 4 * data_bits + 2), name),
-      decoder(decoder_bits)
+      engine(engine)
 {
     // make component name
-    std::ostringstream oss;
-    oss << "Program_Memory 0x" << std::hex << reinterpret_cast<uintptr_t>(this);
-    if (!name.empty()) {
-        oss << " - " << name;
-    }
-    component_name = oss.str();
+    class_name = "Program_Memory";
     
     if (decoder_bits == 0)
         decoder_bits = 1;
     if (data_bits == 0)
         data_bits = 1;
+    const uint16_t max_bits = (engine == Engine::SPARSE) ? max_sparse_bits : max_gate_level_bits;
+    if (decoder_bits > max_bits)
+    {
+        Console::err() << "Error: Program_Memory - " << decoder_bits << " address bits is more than the "
+                  << (engine == Engine::SPARSE ? "sparse" : "gate-level") << " engine supports ("
+                  << max_bits << "), using " << max_bits << std::endl;
+        decoder_bits = max_bits;
+    }
     
     this->decoder_bits = decoder_bits;
     this->data_bits = data_bits;
     
-    num_addresses = static_cast<uint16_t>(1u << decoder_bits); // 2^decoder_bits
+    num_addresses = 1u << decoder_bits; // 2^decoder_bits
     
     num_inputs = static_cast<uint16_t>(decoder_bits + 4 * data_bits + 2); // addr select, opcode, C, A, B, WE, RE
     num_outputs = static_cast<uint16_t>(4 * data_bits);
     allocate_IO_arrays();
 
+    // Sparse pages are allocated by the first write to them
+    if (engine == Engine::SPARSE)
+        return;
+
+    decoder = new Decoder(decoder_bits, "", Decoder::wide_structure(decoder_bits));
+
     // Allocate register arrays and select-gates for each address
     for (uint16_t i = 0; i < 4; ++i)
     {
@@ -40,29 +53,54 @@ Program_Memory::Program_Memory(uint16_t decoder_bits, uint16_t data_bits, const
     // for each address, create select gates and 4 memory registers (opcode, C, A, B)
     for (uint16_t addr = 0; addr < num_addresses; ++addr)
     {
-        std::ostringstream ws_name, rs_name;
-        ws_name << "write_select_" << addr << "_in_program_memory";
-        rs_name << "read_select_" << addr << "_in_program_memory";
-        write_selects[addr] = new AND_Gate(2, ws_name.str());
-        read_selects[addr] = new AND_Gate(2, rs_name.str());
+        write_selects[addr] = new AND_Gate(2);
+        read_selects[addr] = new AND_Gate(2);
+        write_selects[addr]->set_name_parent(this, child_index(WRITE_SELECT, addr));
+        read_selects[addr]->set_name_parent(this, child_index(READ_SELECT, addr));
         
         // Connect decoder output to select gates (input 0)
-        write_selects[addr]->connect_input(&decoder.get_outputs()[addr], 0);
-        read_selects[addr]->connect_input(&decoder.get_outputs()[addr], 0);
+        write_selects[addr]->connect_input(&decoder->get_outputs()[addr], 0);
+        read_selects[addr]->connect_input(&decoder->get_outputs()[addr], 0);
         
         // create 4 registers (opcode, C, A, B) for each address
         for (uint16_t reg_index = 0; reg_index < registers_per_address; ++reg_index)
         {
-            std::ostringstream reg_name;
-            reg_name << "register_" << reg_index << "_addr_" << addr << "_in_program_memory";
-            Register* reg = new Register(data_bits, reg_name.str());
+            Register* reg = new Register(data_bits);
+            reg->set_name_parent(this, child_index(REGISTER_0 + reg_index, addr));
             registers[reg_index][addr] = reg;
         }
     }
+
+    // One ONE_HOT bus per field: the decoder enables one address's registers
+    for (uint16_t reg_index = 0; reg_index < registers_per_address; ++reg_index)
+    {
+        read_buses[reg_index] = new Bus(data_bits, "", Bus::Mode::ONE_HOT);
+        read_buses[reg_index]->set_name_parent(this, child_index(READ_BUS, reg_index));
+        read_buses[reg_index]->set_trusted_one_hot(true);
+        for (uint16_t addr = 0; addr < num_addresses; ++addr)
+            read_buses[reg_index]->attach_driver(registers[reg_index][addr]->get_outputs(),
+                                                 read_selects[addr]->get_outputs());
+    }
+}
+
+std::string Program_Memory::child_name(uint32_t index) const
+{
+    const uint32_t kind = index >> 16;
+    const std::string addr = std::to_string(index & 0xFFFF);
+    if (kind == WRITE_SELECT)
+        return "write_select_" + addr + "_in_program_memory";
+    if (kind == READ_SELECT)
+        return "read_select_" + addr + "_in_program_memory";
+    if (kind == READ_BUS)
+        return "read_bus_" + addr + "_in_program_memory";
+    return "register_" + std::to_string(kind - REGISTER_0) + "_addr_" + addr + "_in_program_memory";
 }
 
 Program_Memory::~Program_Memory()
 {
+    if (engine == Engine::SPARSE)
+        return;
+
     // Delete all registers
     for (uint16_t i = 0; i < 4; ++i)
     {
@@ -81,6 +119,25 @@ Program_Memory::~Program_Memory()
     }
     delete[] write_selects;
     delete[] read_selects;
+    delete decoder;
+    for (Bus* bus : read_buses)
+        delete bus;
+}
+
+size_t Program_Memory::get_owned_bytes() const
+{
+    size_t bytes = Part::get_owned_bytes();
+    if (engine == Engine::SPARSE)
+    {
+        // Page storage plus the hash table's buckets and one node per page
+        bytes += pages.bucket_count() * sizeof(void*);
+        for (const auto& page : pages)
+            bytes += sizeof(page) + sizeof(void*) + page.second.capacity() * sizeof(uint16_t);
+        return bytes;
+    }
+    bytes += (registers_per_address + 2) * num_addresses * sizeof(Component*);  // registers, select gates
+    bytes += rom_image.capacity() * sizeof(uint16_t);
+    return bytes;
 }
 
 bool Program_Memory::connect_input(const bool* const upstream_output_p, uint16_t input_index)
@@ -88,13 +145,16 @@ bool Program_Memory::connect_input(const bool* const upstream_output_p, uint16_t
     // Connect incoming output to this device's input array
     if (!Component::connect_input(upstream_output_p, input_index))
         return false;
+    // The sparse engine reads its inputs directly
+    if (engine == Engine::SPARSE)
+        return true;
     
     // Internal Connections:
     // Connect address bits to decoder
     if (input_index < decoder_bits)
     {
         // Address bits -> decoder inputs
-        return decoder.connect_input(inputs[input_index], input_index);
+        return decoder->connect_input(inputs[input_index], input_index);
     }
     // Connect data bits to ALL registers
     else if (input_index < static_cast<uint16_t>(decoder_bits + 4 * data_bits))
@@ -104,7 +164,7 @@ bool Program_Memory::connect_input(const bool* const upstream_output_p, uint16_t
         uint16_t bit_within_reg = data_bit_index % data_bits;  // which bit within that register
         
         // Connect this input to all copies of this register across all addresses
-        for (uint16_t addr = 0; addr < num_addresses; ++addr)
+        for (uint32_t addr = 0; addr < num_addresses; ++addr)
         {
             registers[reg_index][addr]->connect_input(inputs[input_index], bit_within_reg);
         }
@@ -114,7 +174,7 @@ bool Program_Memory::connect_input(const bool* const upstream_output_p, uint16_t
     else if (input_index == static_cast<uint16_t>(decoder_bits + 4 * data_bits))
     {
         // Write Enable -> all write select gates (input 1)
-        for (uint16_t i = 0; i < num_addresses; ++i)
+        for (uint32_t i = 0; i < num_addresses; ++i)
         {
             write_selects[i]->connect_input(inputs[input_index], 1);
             
@@ -130,7 +190,7 @@ bool Program_Memory::connect_input(const bool* const upstream_output_p, uint16_t
     else if (input_index == static_cast<uint16_t>(decoder_bits + 4 * data_bits + 1))
     {
         // Read Enable -> all read select gates (input 1)
-        for (uint16_t i = 0; i < num_addresses; ++i)
+        for (uint32_t i = 0; i < num_addresses; ++i)
         {
             read_selects[i]->connect_input(inputs[input_index], 1);
             
@@ -148,34 +208,279 @@ bool Program_Memory::connect_input(const bool* const upstream_output_p, uint16_t
 
 void Program_Memory::evaluate()
 {
-    decoder.evaluate();
-    
-    for (uint16_t i = 0; i < num_addresses; ++i)
+    Profiler::Scope profile_scope(this);
+    if (engine == Engine::SPARSE)
+    {
+        _evaluate_sparse();
+        return;
+    }
+    if (rom_fetch_enabled && _fetch_from_rom())
+        return;
+    last_fetch_from_rom = false;
+
+    // Registers may be written below; the ROM image must be rebuilt
+    const uint16_t we_index = static_cast<uint16_t>(decoder_bits + 4 * data_bits);
+    if (inputs[we_index] == nullptr || *inputs[we_index])
+        rom_image_valid = false;
+
+    decoder->evaluate();
+
+    if (num_banks <= 1 || Profiler::is_enabled())
+    {
+        _evaluate_addresses(0, static_cast<uint16_t>(num_addresses));
+    }
+    else
+    {
+        worker_pool->run(num_banks, [this](size_t bank) {
+            const uint16_t first = static_cast<uint16_t>(bank * num_addresses / num_banks);
+            const uint16_t last = static_cast<uint16_t>((bank + 1) * num_addresses / num_banks);
+            _evaluate_addresses(first, last);
+        });
+    }
+
+    // Read only the selected address's registers: the address inputs name it
+    uint32_t address = 0;
+    for (uint16_t i = 0; i < decoder_bits; ++i)
+    {
+        if (inputs[i] && *inputs[i])
+            address |= 1u << i;
+    }
+    for (uint16_t reg_index = 0; reg_index < registers_per_address; ++reg_index)
+    {
+        read_buses[reg_index]->set_active_hint(address);
+        read_buses[reg_index]->evaluate();
+        const bool* field = read_buses[reg_index]->get_outputs();
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+            outputs[reg_index * data_bits + bit] = field[bit];
+    }
+}
+
+void Program_Memory::set_worker_pool(Worker_Pool* pool)
+{
+    worker_pool = pool;
+    // The sparse engine is O(1) per fetch and always runs serially
+    num_banks = (pool && engine == Engine::GATE_LEVEL)
+        ? static_cast<uint16_t>(std::min<uint32_t>(pool->get_num_threads(), num_addresses)) : 1;
+}
+
+void Program_Memory::set_read_contention_warnings(bool enabled)
+{
+    for (Bus* bus : read_buses)
+    {
+        if (bus)
+        {
+            bus->set_trusted_one_hot(!enabled);
+            bus->set_contention_warnings(enabled);
+        }
+    }
+}
+
+void Program_Memory::_evaluate_addresses(uint16_t first, uint16_t last)
+{
+    for (uint16_t i = first; i < last; ++i)
     {
         write_selects[i]->evaluate();
         read_selects[i]->evaluate();
     }
 
-    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    for (uint16_t addr = first; addr < last; ++addr)
     {
         for (uint16_t i = 0; i < 4; ++i)
         {
             registers[i][addr]->evaluate();
         }
     }
-    
-    // Manually OR outputs from all addresses
-    // For each bit position in output (16 bits = 4 registers × 4 bits)
+}
+
+bool Program_Memory::_fetch_from_rom()
+{
+    const uint16_t we_index = static_cast<uint16_t>(decoder_bits + 4 * data_bits);
+    const uint16_t re_index = static_cast<uint16_t>(we_index + 1);
+    if (inputs[we_index] == nullptr || *inputs[we_index] || inputs[re_index] == nullptr)
+        return false;
+
+    uint16_t address = 0;
+    for (uint16_t i = 0; i < decoder_bits; ++i)
+    {
+        if (inputs[i] == nullptr)
+            return false;  // let the decoder report the unconnected input
+        if (*inputs[i])
+            address |= static_cast<uint16_t>(1u << i);
+    }
+
+    if (!rom_image_valid)
+        _build_rom_image();
+
+    // Register outputs are gated by read_select = decoder[address] AND RE
+    const bool read_enable = *inputs[re_index];
+    const uint16_t* row = &rom_image[static_cast<size_t>(address) * registers_per_address];
+    for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+    {
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+        {
+            outputs[reg * data_bits + bit] = read_enable && ((row[reg] >> bit) & 1);
+        }
+    }
+    rom_address = address;
+    last_fetch_from_rom = true;
+    return true;
+}
+
+void Program_Memory::_evaluate_sparse()
+{
+    if (!inputs_verified && !verify_inputs())
+        return;
+
+    uint32_t address = 0;
+    for (uint16_t i = 0; i < decoder_bits; ++i)
+        address |= static_cast<uint32_t>(*inputs[i]) << i;
+
+    const uint16_t we_index = static_cast<uint16_t>(decoder_bits + 4 * data_bits);
+    if (*inputs[we_index])
+    {
+        uint16_t values[registers_per_address] = {};
+        for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+        {
+            for (uint16_t bit = 0; bit < data_bits; ++bit)
+                values[reg] |= static_cast<uint16_t>(*inputs[decoder_bits + reg * data_bits + bit]) << bit;
+        }
+        set_instruction(address, values[0], values[1], values[2], values[3]);
+    }
+
+    // Unwritten pages read as all zeros (HALT)
+    const bool read_enable = *inputs[we_index + 1];
+    const uint16_t* row = _sparse_row(address);
+    for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+    {
+        const uint16_t value = (row && read_enable) ? row[reg] : 0;
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+            outputs[reg * data_bits + bit] = (value >> bit) & 1;
+    }
+    rom_address = address;
+}
+
+const uint16_t* Program_Memory::_sparse_row(uint32_t address) const
+{
+    auto page = pages.find(address >> page_bits);
+    if (page == pages.end())
+        return nullptr;
+    const uint32_t offset = address & ((1u << page_bits) - 1);
+    return &page->second[static_cast<size_t>(offset) * registers_per_address];
+}
+
+uint16_t* Program_Memory::_sparse_row_for_write(uint32_t address)
+{
+    std::vector<uint16_t>& page = pages[address >> page_bits];
+    if (page.empty())
+        page.assign(static_cast<size_t>(registers_per_address) << page_bits, 0);
+    const uint32_t offset = address & ((1u << page_bits) - 1);
+    return &page[static_cast<size_t>(offset) * registers_per_address];
+}
+
+void Program_Memory::_build_rom_image()
+{
+    rom_image.assign(static_cast<size_t>(num_addresses) * registers_per_address, 0);
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    {
+        uint16_t* row = &rom_image[static_cast<size_t>(addr) * registers_per_address];
+        get_instruction(addr, row[0], row[1], row[2], row[3]);
+    }
+    rom_image_valid = true;
+}
+
+void Program_Memory::compile(Netlist& netlist)
+{
+    Netlist::Scope netlist_scope(netlist, this);
+    if (engine == Engine::SPARSE)
+    {
+        Component::compile(netlist);
+        return;
+    }
+    if (netlist.is_gate_faithful())
+    {
+        _compile_gates(netlist);
+        return;
+    }
+    const uint16_t we_index = static_cast<uint16_t>(decoder_bits + 4 * data_bits);
+    const uint16_t re_index = static_cast<uint16_t>(we_index + 1);
+
+    // ROM fetch: while WE is low nothing is written and the outputs below
+    // read the flip-flops and address inputs directly, so the write path
+    // (decoder included) can be skipped. get_selected_address() then lags
+    // until sync_pc() re-evaluates the component tree.
+    const bool guarded = rom_fetch_enabled && inputs[we_index] != nullptr;
+    if (guarded)
+        netlist.begin_guard(inputs[we_index]);
+    decoder->compile(netlist);
+    for (uint16_t i = 0; i < num_addresses; ++i)
+    {
+        write_selects[i]->compile(netlist);
+        read_selects[i]->compile(netlist);
+    }
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    {
+        for (uint16_t i = 0; i < 4; ++i)
+        {
+            registers[i][addr]->compile(netlist);
+        }
+    }
+    if (guarded)
+        netlist.end_guard();
+
+    // Each output bit indexes the stored bits by address (the read buses'
+    // decoder[address] AND RE AND stored bit), O(1) per bit instead of an OR
+    // across all addresses
+    std::vector<const bool*> address(inputs, inputs + decoder_bits);
+    std::vector<const bool*> stored(num_addresses);
     for (uint16_t bit = 0; bit < static_cast<uint16_t>(4 * data_bits); ++bit)
     {
-        uint16_t reg_index = bit / data_bits;  // Which register (0-3)
-        uint16_t bit_in_reg = bit % data_bits; // Which bit in that register (0-3)
-        
-        outputs[bit] = false;
+        uint16_t reg_index = bit / data_bits;
+        uint16_t bit_in_reg = bit % data_bits;
         for (uint16_t addr = 0; addr < num_addresses; ++addr)
         {
-            outputs[bit] = outputs[bit] || registers[reg_index][addr]->get_output(bit_in_reg);
+            stored[addr] = registers[reg_index][addr]->get_stored_signal(bit_in_reg);
         }
+        const bool* row_bit = netlist.scratch_signal();
+        netlist.emit_mux(address, stored, row_bit);
+        netlist.emit(Netlist::Op_Type::AND, { inputs[re_index], row_bit }, &outputs[bit]);
+    }
+}
+
+void Program_Memory::for_each_child(const std::function<void(Component&)>& visit)
+{
+    if (engine == Engine::SPARSE)
+        return;
+    visit(*decoder);
+    for (uint32_t addr = 0; addr < num_addresses; ++addr)
+    {
+        visit(*write_selects[addr]);
+        visit(*read_selects[addr]);
+        for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+            visit(*registers[reg][addr]);
+    }
+    for (Bus* bus : read_buses)
+        visit(*bus);
+}
+
+void Program_Memory::_compile_gates(Netlist& netlist)
+{
+    // Every gate the gate-level evaluate() runs, in the same order (no ROM fetch)
+    decoder->compile(netlist);
+    for (uint16_t i = 0; i < num_addresses; ++i)
+    {
+        write_selects[i]->compile(netlist);
+        read_selects[i]->compile(netlist);
+    }
+    for (uint16_t addr = 0; addr < num_addresses; ++addr)
+    {
+        for (uint16_t i = 0; i < registers_per_address; ++i)
+            registers[i][addr]->compile(netlist);
+    }
+    for (uint16_t reg_index = 0; reg_index < registers_per_address; ++reg_index)
+    {
+        read_buses[reg_index]->compile(netlist);
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+            netlist.emit_buffer(&read_buses[reg_index]->get_outputs()[bit], &outputs[reg_index * data_bits + bit]);
     }
 }
 
@@ -201,9 +506,12 @@ void Program_Memory::evaluate()
 //     }
 // }
 
-uint16_t Program_Memory::get_selected_address() const
+uint32_t Program_Memory::get_selected_address() const
 {
-    bool* dec_outs = decoder.get_outputs();
+    if (engine == Engine::SPARSE || last_fetch_from_rom)
+        return rom_address;
+
+    bool* dec_outs = decoder->get_outputs();
     for (uint16_t addr = 0; addr < num_addresses; ++addr)
     {
         if (dec_outs[addr])
@@ -212,7 +520,7 @@ uint16_t Program_Memory::get_selected_address() const
     return 0;
 }
 
-void Program_Memory::get_instruction(uint16_t address, uint16_t& opcode,
+void Program_Memory::get_instruction(uint32_t address, uint16_t& opcode,
                                      uint16_t& a, uint16_t& b, uint16_t& c) const
 {
     if (address >= num_addresses)
@@ -220,6 +528,15 @@ void Program_Memory::get_instruction(uint16_t address, uint16_t& opcode,
         opcode = a = b = c = 0;
         return;
     }
+    if (engine == Engine::SPARSE)
+    {
+        const uint16_t* row = _sparse_row(address);
+        opcode = row ? row[0] : 0;
+        a      = row ? row[1] : 0;
+        b      = row ? row[2] : 0;
+        c      = row ? row[3] : 0;
+        return;
+    }
     
     // reg_index 0 = opcode, 1 = A, 2 = B, 3 = C
     opcode = 0;
@@ -234,3 +551,54 @@ void Program_Memory::get_instruction(uint16_t address, uint16_t& opcode,
         c      |= (registers[3][address]->get_stored_bit(bit) ? 1 : 0) << bit;
     }
 }
+
+void Program_Memory::set_instruction(uint32_t address, uint16_t opcode,
+                                     uint16_t a, uint16_t b, uint16_t c)
+{
+    if (address >= num_addresses)
+        return;
+    if (engine == Engine::SPARSE)
+    {
+        const uint16_t mask = static_cast<uint16_t>((1u << data_bits) - 1);
+        const uint16_t values[registers_per_address] = { opcode, a, b, c };
+        // Zeros are what an unwritten page reads anyway; do not allocate one for them
+        if (!_sparse_row(address) && ((opcode | a | b | c) & mask) == 0)
+            return;
+        uint16_t* row = _sparse_row_for_write(address);
+        for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+            row[reg] = values[reg] & mask;
+        return;
+    }
+
+    const uint16_t values[registers_per_address] = { opcode, a, b, c };
+    for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+    {
+        for (uint16_t bit = 0; bit < data_bits; ++bit)
+        {
+            registers[reg][address]->set_bit(bit, (values[reg] >> bit) & 1);
+        }
+        if (rom_image_valid)
+        {
+            const uint16_t mask = static_cast<uint16_t>((1u << data_bits) - 1);
+            rom_image[static_cast<size_t>(address) * registers_per_address + reg] = values[reg] & mask;
+        }
+    }
+}
+
+void Program_Memory::zero_all()
+{
+    if (engine == Engine::SPARSE)
+    {
+        pages.clear();
+        return;
+    }
+    for (uint16_t reg = 0; reg < registers_per_address; ++reg)
+    {
+        for (uint16_t addr = 0; addr < num_addresses; ++addr)
+        {
+            registers[reg][addr]->zero();
+        }
+    }
+    rom_image.assign(static_cast<size_t>(num_addresses) * registers_per_address, 0);
+    rom_image_valid = true;
+}
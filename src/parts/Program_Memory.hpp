@@ -4,14 +4,33 @@
 #include "../devices/Register.hpp"
 #include "../devices/Bus.hpp"
 #include "../components/AND_Gate.hpp"
+#include <unordered_map>
 #include <vector>
 
+class Worker_Pool;
+
 /**
  * @brief Program memory built from registers and a decoder
  * 
  * Addressed by decoder_bits selector inputs. Each address stores 4 registers:
  *   - opcode, A, B, C (each width = data_bits)
  * 
+ * Engines (chosen at construction):
+ *   - GATE_LEVEL : a Decoder, two select AND_Gates and four Registers per
+ *                  address, all built up front (at most 15 address bits;
+ *                  the Decoder is PREDECODED from 9 address bits up).
+ *                  Each field is read through a trusted ONE_HOT Bus
+ *                  hinted with the address inputs, O(data_bits) per read
+ *   - SPARSE     : packed instruction words in pages of 2^page_bits
+ *                  addresses, allocated the first time something non-zero
+ *                  is written to the page. Unwritten addresses read as 0
+ *                  (HALT). Each evaluate() reads the address inputs as an
+ *                  integer and does one page lookup, so construction, memory
+ *                  and fetch cost follow the program, not 2^decoder_bits
+ *                  (up to 31 address bits). Compiles to one opaque op, and
+ *                  its contents are not Flip_Flops, so save_state() and
+ *                  arena checkpoints do not include them.
+ * 
  * Input layout (decoder_bits + 4*data_bits + 2 total):
  *   - inputs[0..decoder_bits-1]                      : address bits (LSB at index 0)
  *   - inputs[decoder_bits..decoder_bits+4*data_bits-1] : input bus (opcode, A, B, C)
@@ -23,21 +42,80 @@
  *   - outputs[data_bits..2*data_bits-1]    : A bus
  *   - outputs[2*data_bits..3*data_bits-1]  : B bus
  *   - outputs[3*data_bits..4*data_bits-1]  : C bus
+ * 
+ * ROM fetch mode (enabled by default): while WE is low nothing can be
+ * written, so evaluate() reads the address inputs as an integer and copies
+ * that row of a packed ROM image straight to the outputs instead of
+ * evaluating every register and ORing across all addresses. The image is
+ * built from the registers' stored bits on the first fetch after any
+ * evaluate() with WE high. In this mode the decoder, select gates and
+ * per-address register outputs are not refreshed; the next WE-high
+ * evaluate() brings them up to date. compile() does the same in the
+ * netlist: the select gates and registers are a Netlist guard on WE, and
+ * each output bit is a MUX op indexing the stored bits by address. A
+ * gate-faithful netlist (Netlist::set_gate_faithful) gets the gate-level
+ * read path instead: decoder, select gates and read buses, unguarded.
+ * 
+ * Banked evaluation (set_worker_pool) splits the gate-level path across a
+ * Worker_Pool the same way Main_Memory does: the decoder runs first, then
+ * one contiguous address bank per thread, then the read buses on the
+ * calling thread. ROM fetches are O(1) and always run serially.
  */
 class Program_Memory : public Part
 {
 public:
-    Program_Memory(uint16_t decoder_bits = 12, uint16_t data_bits = 4, const std::string& name = "");
+    enum class Engine : uint8_t
+    {
+        GATE_LEVEL,
+        SPARSE
+    };
+
+    /// Widest address each engine accepts; wider requests are clamped.
+    static constexpr uint16_t max_gate_level_bits = 15;
+    static constexpr uint16_t max_sparse_bits = 31;
+
+    Program_Memory(uint16_t decoder_bits = 12, uint16_t data_bits = 4, const std::string& name = "",
+                   Engine engine = Engine::GATE_LEVEL);
     ~Program_Memory() override;
     bool connect_input(const bool* const upstream_output_p, uint16_t input_index) override;
     void evaluate() override;
+    void compile(Netlist& netlist) override;
+    size_t get_object_size() const override { return sizeof(*this); }
+    size_t get_owned_bytes() const override;
+    void for_each_child(const std::function<void(Component&)>& visit) override;
     // void update() override;
     
     uint16_t get_decoder_bits() const { return decoder_bits; }
     uint16_t get_data_bits() const { return data_bits; }
+    uint32_t get_num_addresses() const { return num_addresses; }
+    Engine get_engine() const { return engine; }
     
     // Returns the currently-selected address (the decoder output that is high)
-    uint16_t get_selected_address() const;
+    uint32_t get_selected_address() const;
+
+    /** @brief Number of SPARSE pages holding instructions (0 for the gate-level engine). */
+    size_t get_num_pages() const { return pages.size(); }
+
+    /**
+     * @brief Make the gate-level read buses check for, count and warn to
+     *        Console::err() whenever several addresses drive them at once.
+     *        Off by default: the buses are trusted one-hot
+     *        (Bus::set_trusted_one_hot()), as the decoder drives them.
+     */
+    void set_read_contention_warnings(bool enabled);
+
+    /** @brief Enable or disable ROM fetch mode (see class comment). */
+    void set_rom_fetch_enabled(bool enabled) { rom_fetch_enabled = enabled; }
+
+    /** @brief Return whether evaluate() may fetch from the ROM image while WE is low. */
+    bool get_rom_fetch_enabled() const { return rom_fetch_enabled; }
+
+    /**
+     * @brief Evaluate the gate-level path in banks on `pool` (not owned),
+     *        one bank per pool thread; nullptr returns to serial evaluation.
+     *        Banks run serially while the Profiler is recording.
+     */
+    void set_worker_pool(Worker_Pool* pool);
     
     /**
      * @brief Read the stored instruction at a given address.
@@ -51,18 +129,92 @@ public:
      * @param b        Receives the B field.
      * @param c        Receives the C field.
      */
-    void get_instruction(uint16_t address, uint16_t& opcode,
+    void get_instruction(uint32_t address, uint16_t& opcode,
                          uint16_t& a, uint16_t& b, uint16_t& c) const;
 
+    /**
+     * @brief Directly store an instruction at a given address.
+     *
+     * Forces the registers' stored bits without going through the decoder,
+     * select gates or a WE pulse, so external connections are untouched.
+     * Register outputs are refreshed by the next evaluate().
+     *
+     * @param address  PM address (0 to num_addresses-1).
+     */
+    void set_instruction(uint32_t address, uint16_t opcode,
+                         uint16_t a, uint16_t b, uint16_t c);
+
+    /** Directly zeroes every stored instruction without touching external connections. */
+    void zero_all();
+
+    /**
+     * @brief Drop the ROM image after stored bits were changed behind PM's
+     *        back (e.g. Computer::restore_state forcing its flip-flops).
+     */
+    void invalidate_rom_image() { rom_image_valid = false; }
+
+protected:
+    /** "write_select_<addr>_in_program_memory", "register_<k>_addr_<addr>_in_program_memory", ... */
+    std::string child_name(uint32_t index) const override;
+
 private:
     static constexpr uint16_t registers_per_address = 4;
+    static constexpr uint16_t page_bits = 8;  ///< SPARSE: 256 addresses (2 KB) per page
+
+    /// Kinds of per-address children, named by child_name()
+    enum Child_Kind : uint32_t { WRITE_SELECT, READ_SELECT, READ_BUS, REGISTER_0 };
+
+    /// Child index of the `kind` child at `addr`, for set_name_parent()
+    static uint32_t child_index(uint32_t kind, uint16_t addr) { return (kind << 16) | addr; }
+
+    /**
+     * @brief ROM fetch: drive outputs from rom_image[address] if WE is low
+     * @return false if the gate-level path must run (WE high or an input unconnected)
+     */
+    bool _fetch_from_rom();
+
+    /// Rebuild rom_image from the registers' stored bits.
+    void _build_rom_image();
+
+    /// Select gates and registers for addresses [first, last).
+    void _evaluate_addresses(uint16_t first, uint16_t last);
+
+    /// Gate-faithful compile(): decoder, select gates, registers and read buses.
+    void _compile_gates(Netlist& netlist);
+
+    /// SPARSE evaluate(): write the input bus if WE, then drive the outputs from the selected row.
+    void _evaluate_sparse();
+
+    /// SPARSE: the 4 stored fields at `address`, or nullptr if its page was never written.
+    const uint16_t* _sparse_row(uint32_t address) const;
+
+    /// SPARSE: the 4 stored fields at `address`, allocating its page (zeroed) if needed.
+    uint16_t* _sparse_row_for_write(uint32_t address);
 
     uint16_t decoder_bits = 0;
-    uint16_t num_addresses = 0;
+    uint32_t num_addresses = 0;
     uint16_t data_bits = 0;
+    Engine   engine = Engine::GATE_LEVEL;
+
+    // ── Gate-level engine ─────────────────────────────────────────────────────
+    Decoder* decoder = nullptr;
+    AND_Gate** write_selects = nullptr;
+    AND_Gate** read_selects = nullptr;
+    Register** registers[4] = {}; // 4 arrays of Register* (opcode, C, A, B)
+    Bus* read_buses[4] = {};      // one per register field (compiled only gate-faithful)
+
+    // ── Banked evaluation ─────────────────────────────────────────────────────
+    Worker_Pool* worker_pool = nullptr;
+    uint16_t     num_banks = 1;
+
+    // ── ROM fetch mode ────────────────────────────────────────────────────────
+    bool     rom_fetch_enabled = true;
+    bool     rom_image_valid = false;       ///< false after any WE-high evaluate()
+    bool     last_fetch_from_rom = false;   ///< last evaluate() took the ROM path
+    uint32_t rom_address = 0;               ///< address used by the last ROM (or SPARSE) fetch
+    std::vector<uint16_t> rom_image;        ///< [address * 4 + register] stored values
 
-    Decoder decoder;
-    AND_Gate** write_selects;
-    AND_Gate** read_selects;
-    Register** registers[4]; // 4 arrays of Register* (opcode, C, A, B)
+    // ── Sparse engine ─────────────────────────────────────────────────────────
+    /// page number -> [offset * 4 + register] stored values for its 2^page_bits addresses
+    std::unordered_map<uint32_t, std::vector<uint16_t>> pages;
 };
@@ -0,0 +1,289 @@
+// Headless batch runner (built by `make runner` in build/).
+//
+// Runs each .mc file to HALT or a cycle budget with no per-tick output and
+// prints one JSON summary: cycles, wall time, ticks/s, final PC and RAM.
+// With --verify it instead checks every program against the ISA reference
+// model with the Evaluator, several programs at once, and prints the
+// combined pass/fail report.
+//
+// Usage:
+//   ../runner [options] program.mc|directory [...]
+//
+// A directory stands for every *.mc file directly inside it.
+//
+// Options:
+//   --max-cycles N    stop a program after N ticks (default 1000000)
+//   --mode M          tree | compiled | event | isa (default tree)
+//   --ram F           json | bin | none: RAM inline in the JSON, as a raw
+//                     <name>.ram file per program, or omitted (default json)
+//   --ram-dir DIR     directory for .ram files (default .)
+//   --out FILE        write the JSON summary to FILE instead of stdout
+//
+// Verification options:
+//   --verify          evaluate each program (Regression_Runner) instead of
+//                     running it; --max-cycles, --mode and --ram are ignored
+//   --jobs N          programs evaluated concurrently (default 1)
+//   --check-interval N  compare state hashes every N ticks instead of every
+//                     tick (Evaluator::evaluate_checkpointed)
+//   --junit FILE      also write a JUnit XML report to FILE
+//
+// Footprint options:
+//   --footprint       print the memory footprint of a freshly built computer
+//                     (Memory_Footprint: bytes, objects and gates per class and
+//                     per component) instead of running anything
+//   --depth N         hierarchy depth printed by --footprint (default 4, 0 = all)
+//
+// Timing options:
+//   --timing          print the static timing of a freshly built computer
+//                     (Timing_Analysis: critical path per clock phase, clock
+//                     period in gate delays, deepest components)
+//   --rows N          components listed by --timing (default 20)
+//   --gate-ps PS      gate delay used for the --timing frequency (default 100)
+//
+// Exit status: 0 if every program loaded and halted (--verify: passed),
+// 1 on bad usage, 2 if any program failed to load or ran out of cycles
+// (--verify: failed).
+
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../utilities/batch_runner.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/memory_footprint.hpp"
+#include "../utilities/regression_runner.hpp"
+#include "../utilities/timing_analysis.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static void print_usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0 << " [--max-cycles N] [--mode tree|compiled|event|isa]"
+              << " [--ram json|bin|none] [--ram-dir DIR] [--out FILE] program.mc|dir [...]" << std::endl
+              << "       " << argv0 << " --verify [--jobs N] [--check-interval N] [--junit FILE]"
+              << " [--out FILE] program.mc|dir [...]" << std::endl
+              << "       " << argv0 << " --footprint [--depth N] [--out FILE]" << std::endl
+              << "       " << argv0 << " --timing [--rows N] [--gate-ps PS] [--out FILE]" << std::endl;
+}
+
+/// "../programs/pong.mc" -> "pong"
+static std::string program_stem(const std::string& path)
+{
+    size_t start = path.find_last_of("/\\");
+    start = (start == std::string::npos) ? 0 : start + 1;
+    size_t end = path.find_last_of('.');
+    if (end == std::string::npos || end < start)
+        end = path.size();
+    return path.substr(start, end - start);
+}
+
+/// Writes a report to `path`, or to stdout when `path` is empty.
+template <typename Write>
+static bool write_report(const std::string& path, Write write)
+{
+    if (path.empty())
+    {
+        write(std::cout);
+        return true;
+    }
+    std::ofstream out(path);
+    if (!out)
+    {
+        std::cerr << "Error: runner - could not open " << path << std::endl;
+        return false;
+    }
+    write(out);
+    return true;
+}
+
+static int run_verify(const std::vector<std::string>& files, uint16_t num_jobs, uint32_t check_interval,
+                      const std::string& out_path, const std::string& junit_path)
+{
+    Regression_Runner runner(num_jobs, check_interval);
+    std::vector<Regression_Runner::Result> results = runner.run_all(files);
+
+    size_t programs_passed = 0;
+    for (const Regression_Runner::Result& result : results)
+        programs_passed += result.passed ? 1 : 0;
+    std::cerr << "Verified " << programs_passed << "/" << results.size() << " programs" << std::endl;
+
+    bool written = write_report(out_path, [&](std::ostream& out) { Regression_Runner::write_json(out, results); });
+    if (!junit_path.empty())
+        written = write_report(junit_path, [&](std::ostream& out) { Regression_Runner::write_junit(out, results); }) && written;
+    if (!written)
+        return 1;
+    return programs_passed == results.size() ? 0 : 2;
+}
+
+static int run_footprint(size_t max_depth, const std::string& out_path)
+{
+    // Keep the constructor banner out of the report
+    std::ostringstream banner;
+    Computer_3bit_v1* computer = nullptr;
+    {
+        Console::Scope quiet(banner, std::cerr);
+        computer = new Computer_3bit_v1("computer");
+    }
+    Memory_Footprint footprint(*computer);
+    bool written = write_report(out_path, [&](std::ostream& out) {
+        footprint.print(out, max_depth);
+        Console::Scope to_report(out, std::cerr);
+        computer->get_signal_arena().print_summary("computer");
+    });
+    delete computer;
+    return written ? 0 : 1;
+}
+
+static int run_timing(size_t max_rows, double gate_delay_ps, const std::string& out_path)
+{
+    std::ostringstream banner;
+    Computer_3bit_v1* computer = nullptr;
+    {
+        Console::Scope quiet(banner, std::cerr);
+        computer = new Computer_3bit_v1("computer");
+    }
+    Timing_Analysis timing(*computer);
+    bool written = write_report(out_path, [&](std::ostream& out) { timing.print(out, max_rows, gate_delay_ps); });
+    delete computer;
+    return written ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t max_cycles = 1000000;
+    Batch_Runner::Mode mode = Batch_Runner::Mode::TREE;
+    Batch_Runner::Ram_Format ram_format = Batch_Runner::Ram_Format::JSON;
+    std::string ram_dir = ".";
+    std::string out_path;
+    bool verify = false;
+    uint16_t num_jobs = 1;
+    uint32_t check_interval = 0;
+    std::string junit_path;
+    bool footprint = false;
+    size_t footprint_depth = 4;
+    bool timing = false;
+    size_t timing_rows = 20;
+    double gate_delay_ps = 100.0;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--max-cycles" && has_value)
+        {
+            max_cycles = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--mode" && has_value)
+        {
+            if (!Batch_Runner::parse_mode(argv[++i], mode))
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (arg == "--ram" && has_value)
+        {
+            std::string format = argv[++i];
+            if (format == "json")      ram_format = Batch_Runner::Ram_Format::JSON;
+            else if (format == "bin")  ram_format = Batch_Runner::Ram_Format::BINARY;
+            else if (format == "none") ram_format = Batch_Runner::Ram_Format::NONE;
+            else
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (arg == "--ram-dir" && has_value)
+        {
+            ram_dir = argv[++i];
+        }
+        else if (arg == "--out" && has_value)
+        {
+            out_path = argv[++i];
+        }
+        else if (arg == "--verify")
+        {
+            verify = true;
+        }
+        else if (arg == "--jobs" && has_value)
+        {
+            num_jobs = static_cast<uint16_t>(std::max(1ul, std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--check-interval" && has_value)
+        {
+            check_interval = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--junit" && has_value)
+        {
+            junit_path = argv[++i];
+        }
+        else if (arg == "--footprint")
+        {
+            footprint = true;
+        }
+        else if (arg == "--depth" && has_value)
+        {
+            footprint_depth = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--timing")
+        {
+            timing = true;
+        }
+        else if (arg == "--rows" && has_value)
+        {
+            timing_rows = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--gate-ps" && has_value)
+        {
+            gate_delay_ps = std::strtod(argv[++i], nullptr);
+        }
+        else if (!arg.empty() && arg[0] != '-')
+        {
+            if (std::filesystem::is_directory(arg))
+            {
+                for (const std::string& file : Regression_Runner::find_programs(arg))
+                    files.push_back(file);
+            }
+            else
+            {
+                files.push_back(arg);
+            }
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (footprint)
+        return run_footprint(footprint_depth, out_path);
+    if (timing)
+        return run_timing(timing_rows, gate_delay_ps, out_path);
+    if (files.empty())
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if (verify)
+        return run_verify(files, num_jobs, check_interval, out_path, junit_path);
+
+    Batch_Runner runner(max_cycles, mode);
+    std::vector<Batch_Runner::Result> results = runner.run_all(files);
+
+    bool all_ok = true;
+    for (Batch_Runner::Result& result : results)
+    {
+        all_ok = all_ok && result.loaded && result.halted;
+        if (result.loaded && ram_format == Batch_Runner::Ram_Format::BINARY)
+            Batch_Runner::write_ram_binary(result, ram_dir + "/" + program_stem(result.file) + ".ram");
+    }
+
+    if (!write_report(out_path, [&](std::ostream& out) { Batch_Runner::write_json(out, results, ram_format); }))
+        return 1;
+    return all_ok ? 0 : 2;
+}
@@ -1,7 +1,29 @@
 #include "component_tests.hpp"
 #include "../components/Signal_Generator.hpp"
+#include "../devices/Adder.hpp"
 #include "../devices/Adder_Subtractor.hpp"
+#include "../devices/Bus.hpp"
+#include "../devices/Comparator.hpp"
+#include "../devices/Decoder.hpp"
+#include "../devices/Multiplexer.hpp"
+#include "../devices/Register.hpp"
+#include "../devices/Fixed_Adder.hpp"
+#include "../devices/Fixed_Comparator.hpp"
+#include "../devices/Fixed_Decoder.hpp"
+#include "../devices/Fixed_Multiplexer.hpp"
+#include "../devices/Fixed_Register.hpp"
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/memory_footprint.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/signal_arena.hpp"
+#include "../utilities/timing_analysis.hpp"
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <unordered_set>
 #include <vector>
 
 void test_component(Component* device, const std::string& binary_input)
@@ -352,4 +374,700 @@ void test_all_components(uint16_t min_inputs, uint16_t max_inputs)
     test_component_type<XOR_Gate>(min_inputs, max_inputs);
     test_component_type<Buffer>(min_inputs, max_inputs);
     test_component_type<Inverter>(min_inputs, max_inputs);
-}
\ No newline at end of file
+}
+
+// ── Fixed-width devices ──────────────────────────────────────────────────────
+
+static void connect_levels(Component& device, bool* levels)
+{
+    for (uint16_t i = 0; i < device.get_num_inputs(); ++i)
+        device.connect_input(&levels[i], i);
+}
+
+static uint32_t read_bits(const Component& device, uint16_t first, uint16_t count)
+{
+    uint32_t value = 0;
+    for (uint16_t i = 0; i < count; ++i)
+        value |= static_cast<uint32_t>(device.get_output(first + i)) << i;
+    return value;
+}
+
+/**
+ * Applies num_vectors input vectors (set_vector(index, levels)) to all three
+ * devices, evaluating `compiled` through a netlist, and reports the vectors
+ * on which any output differs from `reference`. Returns the mismatch count.
+ */
+template <typename Set_Vector>
+static uint32_t compare_fixed_device(const std::string& label, Component& reference, Component& fixed,
+                                     Component& compiled, bool* levels, uint32_t num_vectors,
+                                     Set_Vector set_vector)
+{
+    Netlist netlist;
+    compiled.compile(netlist);
+
+    uint32_t mismatches = 0;
+    for (uint32_t v = 0; v < num_vectors; ++v)
+    {
+        set_vector(v, levels);
+        reference.evaluate();
+        fixed.evaluate();
+        netlist.evaluate();
+        for (uint16_t o = 0; o < reference.get_num_outputs(); ++o)
+        {
+            const bool expected = reference.get_output(o);
+            if (fixed.get_output(o) != expected || compiled.get_output(o) != expected)
+            {
+                if (mismatches < 5)
+                    std::cout << "  " << label << " vector " << v << " output[" << o << "]: expected " << expected
+                              << ", tree " << fixed.get_output(o) << ", netlist " << compiled.get_output(o) << "\n";
+                ++mismatches;
+                break;
+            }
+        }
+    }
+    std::cout << (mismatches == 0 ? "✓ " : "✗ ") << label << ": " << num_vectors << " vectors, "
+              << netlist.get_num_ops() << " netlist ops";
+    if (mismatches != 0)
+        std::cout << ", " << mismatches << " mismatched";
+    std::cout << "\n";
+    return mismatches;
+}
+
+/// Every input combination: bit i of the vector index drives input i.
+static void set_exhaustive(uint32_t vector, bool* levels, uint16_t num_levels)
+{
+    for (uint16_t i = 0; i < num_levels; ++i)
+        levels[i] = ((vector >> i) & 1u) != 0;
+}
+
+void test_fixed_width_devices(uint32_t num_register_vectors)
+{
+    std::cout << "\n=== Testing fixed-width devices against runtime-sized devices ===\n";
+    uint32_t failures = 0;
+
+    {
+        bool levels[3] = {};
+        Decoder reference(3);
+        Fixed_Decoder<3> fixed, compiled;
+        connect_levels(reference, levels);
+        connect_levels(fixed, levels);
+        connect_levels(compiled, levels);
+        failures += compare_fixed_device("Fixed_Decoder<3>", reference, fixed, compiled, levels, 1u << 3,
+                                         [](uint32_t v, bool* l) { set_exhaustive(v, l, 3); });
+    }
+    {
+        bool levels[8] = {};
+        Adder reference(4);
+        Fixed_Adder<4> fixed, compiled;
+        connect_levels(reference, levels);
+        connect_levels(fixed, levels);
+        connect_levels(compiled, levels);
+        failures += compare_fixed_device("Fixed_Adder<4>", reference, fixed, compiled, levels, 1u << 8,
+                                         [](uint32_t v, bool* l) { set_exhaustive(v, l, 8); });
+    }
+    {
+        bool levels[8] = {};
+        Comparator reference(4);
+        Fixed_Comparator<4> fixed, compiled;
+        connect_levels(reference, levels);
+        connect_levels(fixed, levels);
+        connect_levels(compiled, levels);
+        failures += compare_fixed_device("Fixed_Comparator<4>", reference, fixed, compiled, levels, 1u << 8,
+                                         [](uint32_t v, bool* l) { set_exhaustive(v, l, 8); });
+    }
+    {
+        // 3 sources x 3 bits of data, then 3 controls
+        bool levels[12] = {};
+        Multiplexer reference(3, 3, "reference");
+        Fixed_Multiplexer<3, 3> fixed, compiled;
+        const bool* sources[3] = { &levels[0], &levels[3], &levels[6] };
+        const bool* controls[3] = { &levels[9], &levels[10], &levels[11] };
+        reference.connect_sources_from_values(sources, controls);
+        fixed.connect_sources_from_values(sources, controls);
+        connect_levels(compiled, levels);
+        failures += compare_fixed_device("Fixed_Multiplexer<3,3>", reference, fixed, compiled, levels, 1u << 12,
+                                         [](uint32_t v, bool* l) { set_exhaustive(v, l, 12); });
+    }
+    {
+        // Stateful: a random sequence, biased towards keeping what is stored
+        bool levels[6] = {};
+        Register reference(4);
+        Fixed_Register<4> fixed, compiled;
+        connect_levels(reference, levels);
+        connect_levels(fixed, levels);
+        connect_levels(compiled, levels);
+        std::mt19937 rng(17);
+        failures += compare_fixed_device("Fixed_Register<4>", reference, fixed, compiled, levels, num_register_vectors,
+                                         [&rng](uint32_t, bool* l)
+                                         {
+                                             for (uint16_t i = 0; i < 4; ++i)
+                                                 l[i] = (rng() & 1u) != 0;
+                                             l[4] = (rng() % 4) == 0;  // write_enable
+                                             l[5] = (rng() % 4) != 0;  // read_enable
+                                         });
+    }
+
+    // Interop: accumulators mixing runtime and fixed devices, acc += 3 each tick
+    {
+        bool step[3] = { true, true, false };
+        bool high = true;
+        Register runtime_register(3);
+        Fixed_Adder<3> fixed_adder;
+        Fixed_Register<3> fixed_register;
+        Adder runtime_adder(3);
+
+        for (uint16_t i = 0; i < 3; ++i)
+        {
+            fixed_adder.connect_input(&runtime_register.get_outputs()[i], i);
+            fixed_adder.connect_input(&step[i], 3 + i);
+            runtime_register.connect_input(&fixed_adder.get_outputs()[i], i);
+            runtime_adder.connect_input(&fixed_register.get_outputs()[i], i);
+            runtime_adder.connect_input(&step[i], 3 + i);
+            fixed_register.connect_input(&runtime_adder.get_outputs()[i], i);
+        }
+        runtime_register.connect_input(&high, 3);
+        runtime_register.connect_input(&high, 4);
+        fixed_register.connect_input(&high, 3);
+        fixed_register.connect_input(&high, 4);
+
+        bool interop_ok = true;
+        for (uint32_t tick = 0; tick < 20; ++tick)
+        {
+            runtime_register.evaluate();
+            fixed_adder.evaluate();
+            fixed_register.evaluate();
+            runtime_adder.evaluate();
+            const uint32_t expected = (3 * tick) & 7u;
+            if (read_bits(runtime_register, 0, 3) != expected || read_bits(fixed_register, 0, 3) != expected)
+            {
+                std::cout << "  tick " << tick << ": expected " << expected
+                          << ", Register + Fixed_Adder " << read_bits(runtime_register, 0, 3)
+                          << ", Fixed_Register + Adder " << read_bits(fixed_register, 0, 3) << "\n";
+                interop_ok = false;
+                break;
+            }
+        }
+        std::cout << (interop_ok ? "✓ " : "✗ ") << "mixed runtime/fixed accumulators agree for 20 ticks\n";
+        failures += interop_ok ? 0 : 1;
+    }
+
+    std::cout << "\nFixed-Width Device Test Summary: "
+              << (failures == 0 ? "✓ ALL PASS" : "✗ FAILURES") << "\n";
+}
+
+// ── Component names ──────────────────────────────────────────────────────────
+
+namespace
+{
+    /// Names two gates by index, like Memory_Bit names its flip-flop and gates.
+    class Named_Parent : public Component
+    {
+    public:
+        explicit Named_Parent(const std::string& name) : Component(name), child_a(2)
+        {
+            class_name = "Named_Parent";
+            child_a.set_name_parent(this, 0);
+            child_b.set_name_parent(this, 1);
+        }
+
+        AND_Gate child_a;
+        Flip_Flop child_b;
+
+    protected:
+        std::string child_name(uint32_t index) const override
+        {
+            return get_given_name() + "_child_" + std::to_string(index);
+        }
+    };
+}
+
+/// Gate inputs read by one evaluation of `device` (netlist op inputs, buffers included).
+static size_t count_gate_inputs(Component& device)
+{
+    Netlist netlist;
+    device.compile(netlist);
+    return netlist.get_op_inputs().size();
+}
+
+void test_predecoded_decoder(uint16_t max_bits)
+{
+    std::cout << "\n=== Testing predecoded Decoder against the flat Decoder ===\n";
+    uint32_t failures = 0;
+
+    for (uint16_t bits = 2; bits <= max_bits; ++bits)
+    {
+        std::unique_ptr<bool[]> levels(new bool[bits]());
+        Decoder flat(bits);
+        Decoder predecoded(bits, "", Decoder::Structure::PREDECODED);
+        Decoder compiled(bits, "", Decoder::Structure::PREDECODED);
+        connect_levels(flat, levels.get());
+        connect_levels(predecoded, levels.get());
+        connect_levels(compiled, levels.get());
+        const std::string label = "Decoder(" + std::to_string(bits) + ", PREDECODED)";
+        failures += compare_fixed_device(label, flat, predecoded, compiled, levels.get(), 1u << bits,
+                                         [bits](uint32_t v, bool* l) { set_exhaustive(v, l, bits); });
+
+        const size_t flat_inputs = count_gate_inputs(flat);
+        const size_t predecoded_inputs = count_gate_inputs(predecoded);
+        const bool halved = bits < Decoder::predecode_min_bits || 2 * predecoded_inputs <= flat_inputs;
+        std::cout << (halved ? "  " : "✗ ") << "  gate inputs per evaluate: flat " << flat_inputs
+                  << ", predecoded " << predecoded_inputs << "\n";
+        failures += !halved;
+    }
+
+    // The drop-in structure is picked for wide memories only
+    if (Decoder::wide_structure(Decoder::predecode_min_bits) != Decoder::Structure::PREDECODED ||
+        Decoder::wide_structure(Decoder::predecode_min_bits - 1) != Decoder::Structure::FLAT)
+    {
+        std::cout << "✗ Decoder::wide_structure() threshold\n";
+        ++failures;
+    }
+    // A 1-bit decoder cannot be split and is built flat
+    if (Decoder(1, "", Decoder::Structure::PREDECODED).get_structure() != Decoder::Structure::FLAT)
+    {
+        std::cout << "✗ 1-bit PREDECODED decoder is not FLAT\n";
+        ++failures;
+    }
+
+    {
+        Decoder named(9, "row", Decoder::Structure::PREDECODED);
+        Netlist netlist;
+        netlist.record_scopes(true);
+        named.compile(netlist);
+        std::vector<std::string> names;
+        for (const Netlist::Scope_Record& record : netlist.get_scope_records())
+            names.push_back(record.component->get_given_name());
+        auto has = [&names](const std::string& name) {
+            return std::find(names.begin(), names.end(), name) != names.end();
+        };
+        const bool named_ok = has("row_predecoder_low") && has("row_predecoder_high") && has("row_output_and_511");
+        std::cout << (named_ok ? "✓ " : "✗ ") << "predecoder and output names\n";
+        failures += !named_ok;
+    }
+
+    std::cout << "\nPredecoded Decoder Test Summary: ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_bus(uint32_t num_drivers, uint32_t num_vectors)
+{
+    std::cout << "\n=== Testing Bus tri-state drivers ===\n";
+    const uint16_t num_bits = 8;
+    uint32_t failures = 0;
+
+    std::mt19937 rng(7);
+    std::vector<uint8_t> data(static_cast<size_t>(num_drivers) * num_bits);
+    for (uint8_t& bit : data)
+        bit = static_cast<uint8_t>(rng() & 1u);
+    std::unique_ptr<bool[]> data_bits(new bool[data.size()]);
+    std::unique_ptr<bool[]> enables(new bool[num_drivers]());
+    for (size_t i = 0; i < data.size(); ++i)
+        data_bits[i] = data[i] != 0;
+    bool always_on[num_bits] = {};
+    always_on[num_bits - 1] = true;
+
+    Bus wired_or(num_bits, "wired_or_bus");
+    Bus one_hot(num_bits, "one_hot_bus", Bus::Mode::ONE_HOT);
+    Bus trusted(num_bits, "trusted_bus", Bus::Mode::ONE_HOT);
+    trusted.set_trusted_one_hot(true);
+    Bus compiled(num_bits, "compiled_bus");
+    for (Bus* bus : { &wired_or, &one_hot, &trusted, &compiled })
+    {
+        bus->attach_input(always_on);
+        for (uint32_t d = 0; d < num_drivers; ++d)
+            bus->attach_driver(&data_bits[d * num_bits], &enables[d]);
+    }
+    Netlist netlist;
+    compiled.compile(netlist);
+
+    uint64_t expected_contention = 0;
+    uint64_t expected_warnings = 0;
+    std::ostringstream warnings;
+    for (uint32_t v = 0; v < num_vectors; ++v)
+    {
+        // Mostly one driver, sometimes none or several
+        std::fill(enables.get(), enables.get() + num_drivers, false);
+        const uint32_t selected = rng() % num_drivers;
+        const uint32_t pattern = v % 8;
+        if (pattern != 0)
+            enables[selected] = true;
+        if (pattern == 1)
+            enables[(selected + 1 + rng() % (num_drivers - 1)) % num_drivers] = true;
+        const bool contended = pattern == 1;
+        expected_contention += contended;
+
+        bool expected[num_bits];
+        for (uint16_t bit = 0; bit < num_bits; ++bit)
+        {
+            expected[bit] = always_on[bit];
+            for (uint32_t d = 0; d < num_drivers; ++d)
+                expected[bit] = expected[bit] || (enables[d] && data_bits[d * num_bits + bit]);
+        }
+
+        // Right hint, stale hint or a hint past the last driver
+        const uint32_t hint = (v % 3 == 0) ? selected : (v % 3 == 1) ? rng() % num_drivers : Bus::NO_DRIVER;
+        one_hot.set_active_hint(hint);
+        trusted.set_active_hint(hint);
+        // Warnings on for half the contended vectors: ONE_HOT must read the OR either way
+        const bool warn = contended && (v / 8) % 2 == 0;
+        one_hot.set_contention_warnings(warn);
+        expected_warnings += warn;
+        {
+            Console::Scope scope(warnings);
+            wired_or.evaluate();
+            one_hot.evaluate();
+            trusted.evaluate();
+            netlist.evaluate();
+        }
+
+        const uint32_t expected_driver = (pattern == 0 || contended) ? Bus::NO_DRIVER : selected;
+        // A contended trusted bus reads whichever enabled driver it found
+        const uint32_t trusted_driver = trusted.get_active_driver();
+        bool pass = contended ? (trusted_driver < num_drivers && enables[trusted_driver])
+                              : trusted_driver == expected_driver;
+        for (uint16_t bit = 0; bit < num_bits; ++bit)
+        {
+            const bool trusted_expected = contended ? (always_on[bit] || (pass && data_bits[trusted_driver * num_bits + bit]))
+                                                    : expected[bit];
+            if (wired_or.get_outputs()[bit] != expected[bit] || compiled.get_outputs()[bit] != expected[bit] ||
+                one_hot.get_outputs()[bit] != expected[bit] || trusted.get_outputs()[bit] != trusted_expected)
+                pass = false;
+        }
+        if (one_hot.get_active_driver() != expected_driver || wired_or.get_active_driver() != expected_driver)
+            pass = false;
+        if (!pass)
+        {
+            if (failures < 5)
+                std::cout << "  vector " << v << " (" << (pattern == 0 ? "no driver" : contended ? "two drivers" : "one driver")
+                          << ", hint " << hint << "): wired-or/one-hot/netlist disagree with the expected bus\n";
+            ++failures;
+        }
+    }
+    std::cout << (failures == 0 ? "✓ " : "✗ ") << num_vectors << " enable patterns over " << num_drivers
+              << " drivers (wired-or, one-hot, trusted one-hot, netlist)\n";
+
+    // Both checking modes count every contended vector; the trusted bus counts none
+    const bool counted = wired_or.get_contention_count() == expected_contention &&
+                         one_hot.get_contention_count() == expected_contention &&
+                         trusted.get_contention_count() == 0;
+    std::cout << (counted ? "✓ " : "✗ ") << "contention counted " << wired_or.get_contention_count()
+              << " / " << one_hot.get_contention_count() << " / " << trusted.get_contention_count()
+              << " times (expected " << expected_contention << " / " << expected_contention << " / 0)\n";
+    failures += !counted;
+
+    // Only the one-hot bus had warnings on, and only for some contended vectors
+    const std::string log = warnings.str();
+    const uint64_t num_warnings = static_cast<uint64_t>(std::count(log.begin(), log.end(), '\n'));
+    const bool warned = num_warnings == expected_warnings && log.find("one_hot_bus") != std::string::npos;
+    std::cout << (warned ? "✓ " : "✗ ") << num_warnings << " contention warnings\n";
+    failures += !warned;
+
+    std::cout << "\nBus Test Summary: ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_component_names()
+{
+    std::cout << "\n=== Testing lazy component names ===\n";
+    uint32_t failures = 0;
+    auto check = [&failures](bool ok, const std::string& label, const std::string& actual)
+    {
+        std::cout << (ok ? "✓ " : "✗ ") << label << ": " << actual << "\n";
+        failures += ok ? 0 : 1;
+    };
+    auto ends_with = [](const std::string& text, const std::string& suffix)
+    {
+        return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+
+    AND_Gate named(2, "probe");
+    AND_Gate unnamed(2);
+    std::ostringstream address;
+    address << std::hex << reinterpret_cast<uintptr_t>(&named);
+    check(named.get_component_name() == "AND_Gate 0x" + address.str() + " - probe", "named gate",
+          named.get_component_name());
+    check(unnamed.get_component_name().rfind("AND_Gate 0x", 0) == 0 && unnamed.get_given_name().empty(),
+          "unnamed gate", unnamed.get_component_name());
+
+    Named_Parent parent("parent");
+    check(parent.child_a.get_given_name() == "parent_child_0", "child named by parent",
+          parent.child_a.get_given_name());
+    check(parent.child_b.get_given_name() == "parent_child_1", "flip-flop named by parent",
+          parent.child_b.get_given_name());
+    parent.set_component_name("renamed");
+    check(ends_with(parent.child_a.get_component_name(), " - renamed_child_0"), "child follows parent rename",
+          parent.child_a.get_component_name());
+
+    // The gates inside an unwired Register name themselves through two
+    // parents (Register -> Memory_Bit -> gate) in their error messages
+    Register reg(2, "reg");
+    std::ostringstream errors;
+    std::streambuf* console_err = std::cerr.rdbuf(errors.rdbuf());
+    reg.evaluate();
+    std::cerr.rdbuf(console_err);
+    const std::string log = errors.str();
+    check(log.find(" - memory_bit_1_in_register_data_inverter - input[0] not connected") != std::string::npos,
+          "memory bit gate in register", "memory_bit_1_in_register_data_inverter");
+    check(log.find(" - memory_bit_0_in_register_output_and - input[1] not connected") != std::string::npos,
+          "read-enable gate in register", "memory_bit_0_in_register_output_and");
+
+    std::cout << "\nComponent Names Test Summary: "
+              << (failures == 0 ? "✓ ALL PASS" : "✗ FAILURES") << "\n";
+}
+
+// ── Component arena ──────────────────────────────────────────────────────────
+
+void test_component_arena()
+{
+    std::cout << "\n=== Testing component placement in Signal_Arena ===\n";
+    uint32_t failures = 0;
+    auto check = [&failures](bool ok, const std::string& label)
+    {
+        std::cout << (ok ? "✓ " : "✗ ") << label << "\n";
+        failures += ok ? 0 : 1;
+    };
+
+    Signal_Arena arena;
+    Register* in_arena = nullptr;
+    AND_Gate* sibling = nullptr;
+    {
+        Signal_Arena::Scope scope(arena);
+        in_arena = new Register(4, "arena_register");
+        sibling = new AND_Gate(2, "arena_gate");
+    }
+    Register* on_heap = new Register(4, "heap_register");
+
+    // Register, its Memory_Bit array, then the gate: three objects in one block
+    const char* first = reinterpret_cast<const char*>(in_arena);
+    const char* last = reinterpret_cast<const char*>(sibling);
+    check(arena.get_num_objects() == 3, "register, its memory bits and a gate placed in the arena ("
+          + std::to_string(arena.get_num_objects()) + " objects, " + std::to_string(arena.get_object_bytes()) + " bytes)");
+    check(last > first && static_cast<size_t>(last - first) <= arena.get_object_bytes(),
+          "siblings are adjacent in construction order");
+
+    bool high = true;
+    bool data[4] = { true, false, true, true };
+    for (Register* reg : { in_arena, on_heap })
+    {
+        for (uint16_t i = 0; i < 4; ++i)
+            reg->connect_input(&data[i], i);
+        reg->connect_input(&high, 4);
+        reg->connect_input(&high, 5);
+        reg->evaluate();
+    }
+    bool same = true;
+    for (uint16_t i = 0; i < 4; ++i)
+        same = same && in_arena->get_output(i) == data[i] && on_heap->get_output(i) == data[i];
+    check(same, "arena and heap registers latch the same value");
+
+    const size_t objects_before = arena.get_num_objects();
+    delete in_arena;
+    delete sibling;
+    delete on_heap;
+    check(arena.get_num_objects() == objects_before, "delete runs destructors and leaves arena memory to the arena");
+
+    Computer_3bit_v1* computer = nullptr;
+    {
+        std::ostringstream banner;
+        Console::Scope quiet(banner);
+        computer = new Computer_3bit_v1("arena");
+    }
+    const Signal_Arena& computer_arena = computer->get_signal_arena();
+    check(computer_arena.get_num_objects() > 0 && computer_arena.get_object_bytes() <= computer_arena.get_reserved_bytes(),
+          "computer parts placed in the computer's arena");
+    computer_arena.print_summary("Computer_3bit_v1");
+    delete computer;
+
+    std::cout << "\nComponent Arena Test Summary: "
+              << (failures == 0 ? "✓ ALL PASS" : "✗ FAILURES") << "\n";
+}
+
+void test_memory_footprint(size_t max_depth)
+{
+    std::cout << "\n=== Testing Memory_Footprint ===\n";
+    uint32_t failures = 0;
+    auto check = [&failures](bool ok, const std::string& label)
+    {
+        std::cout << (ok ? "✓ " : "✗ ") << label << "\n";
+        failures += ok ? 0 : 1;
+    };
+    // Every subtree total is its own value plus its children's totals
+    auto totals_add_up = [](const Memory_Footprint& footprint)
+    {
+        const std::vector<Memory_Footprint::Node>& nodes = footprint.get_nodes();
+        for (const Memory_Footprint::Node& node : nodes)
+        {
+            size_t bytes = node.own_bytes;
+            uint32_t objects = 1;
+            uint32_t gates = node.own_gates;
+            for (uint32_t child : node.children)
+            {
+                bytes += nodes[child].bytes;
+                objects += nodes[child].objects;
+                gates += nodes[child].gates;
+            }
+            if (bytes != node.bytes || objects != node.objects || gates != node.gates)
+                return false;
+        }
+        return true;
+    };
+
+    Register reg(4, "footprint_register");
+    bool data[6] = {};
+    for (uint16_t i = 0; i < 6; ++i)
+        reg.connect_input(&data[i], i);
+    Memory_Footprint register_footprint(reg);
+    const std::vector<Memory_Footprint::Node>& nodes = register_footprint.get_nodes();
+    const Memory_Footprint::Node& root = register_footprint.get_root();
+
+    check(root.component == &reg && root.children.size() == 4, "register has its 4 memory bits as children");
+    check(totals_add_up(register_footprint), "subtree bytes, objects and gates add up");
+    const Memory_Footprint::Node& bit = nodes[root.children[0]];
+    check(bit.own_bytes < bit.component->get_object_size(),
+          "gates held by value are counted on the gates, not twice on the memory bit");
+    check(root.objects == 1 + 4 * bit.objects, "register objects = 1 + 4 memory bits ("
+          + std::to_string(root.objects) + ")");
+
+    // The flip-flop's latch gates run twice per evaluate(); as hardware they count once
+    Netlist netlist;
+    reg.compile(netlist);
+    check(root.gates == 4 * bit.gates + 4 && root.gates < netlist.get_num_ops(),
+          "register gates = 4 memory bits + 4 output buffers (" + std::to_string(root.gates) + " gates, "
+          + std::to_string(netlist.get_num_ops()) + " ops per evaluate)");
+    check(register_footprint.get_name(root.children[0]) == "footprint_register/memory_bit_0_in_register",
+          "hierarchical name of a memory bit");
+
+    Computer_3bit_v1* computer = nullptr;
+    {
+        std::ostringstream banner;
+        Console::Scope quiet(banner);
+        computer = new Computer_3bit_v1("footprint");
+    }
+    Memory_Footprint computer_footprint(*computer);
+    check(totals_add_up(computer_footprint), "computer totals add up");
+
+    // RAM runs in both clock phases but must be one node
+    Netlist computer_netlist;
+    computer->compile(computer_netlist);
+    const size_t num_ram_nodes = std::count_if(computer_footprint.get_nodes().begin(), computer_footprint.get_nodes().end(),
+        [](const Memory_Footprint::Node& node) { return node.component->get_class_name() == std::string("Main_Memory"); });
+    check(num_ram_nodes == 1, "RAM compiled twice is counted once");
+    check(computer_footprint.get_root().gates < computer_netlist.get_num_ops(),
+          "gates count the hardware once (" + std::to_string(computer_footprint.get_root().gates) + " gates, "
+          + std::to_string(computer_netlist.get_num_ops()) + " ops per tick)");
+    check(computer_footprint.get_root().bytes >= computer->get_signal_arena().get_object_bytes(),
+          "footprint covers the objects in the computer's arena");
+
+    // The tree is ownership, not compile(): everything compiled is in it, and so are
+    // the RAM read decoders and buses the normal netlist replaces with MUXes
+    Netlist scoped;
+    scoped.record_scopes(true);
+    computer->compile(scoped);
+    std::unordered_set<const Component*> in_tree;
+    for (const Memory_Footprint::Node& node : computer_footprint.get_nodes())
+        in_tree.insert(node.component);
+    check(std::all_of(scoped.get_scope_records().begin(), scoped.get_scope_records().end(),
+                      [&in_tree](const Netlist::Scope_Record& record) { return in_tree.count(record.component) > 0; }),
+          "every compiled component is in the tree");
+    const auto ram_node = std::find_if(computer_footprint.get_nodes().begin(), computer_footprint.get_nodes().end(),
+        [](const Memory_Footprint::Node& node) { return node.component->get_class_name() == std::string("Main_Memory"); });
+    size_t ram_decoders = 0;
+    size_t ram_buses = 0;
+    for (uint32_t child : ram_node->children)
+    {
+        const char* child_class = computer_footprint.get_nodes()[child].component->get_class_name();
+        ram_decoders += child_class && std::string(child_class) == "Decoder";
+        ram_buses += child_class && std::string(child_class) == "Bus";
+    }
+    check(ram_decoders == 3 && ram_buses == 2, "RAM has its read/write decoders and read buses ("
+          + std::to_string(ram_decoders) + " decoders, " + std::to_string(ram_buses) + " buses)");
+
+    computer_footprint.print(std::cout, max_depth);
+    delete computer;
+
+    std::cout << "\nMemory Footprint Test Summary: "
+              << (failures == 0 ? "✓ ALL PASS" : "✗ FAILURES") << "\n";
+}
+
+void test_timing_analysis()
+{
+    std::cout << "\n=== Testing Timing_Analysis ===\n";
+    uint32_t failures = 0;
+    auto check = [&failures](bool ok, const std::string& label)
+    {
+        std::cout << (ok ? "✓ " : "✗ ") << label << "\n";
+        failures += ok ? 0 : 1;
+    };
+
+    bool address[9] = {};
+    Decoder flat(3, "flat_decoder");
+    for (uint16_t i = 0; i < 3; ++i)
+        flat.connect_input(&address[i], i);
+    Timing_Analysis flat_timing(flat);
+    check(flat_timing.get_phases().size() == 1 && flat_timing.get_phases()[0].name == "evaluate",
+          "a component with no clock phases is one \"evaluate\" phase");
+    check(flat_timing.get_clock_period() == 2, "3-bit flat decoder: 2 gate delays ("
+          + std::to_string(flat_timing.get_clock_period()) + ")");
+    check(flat_timing.get_depth(&flat) == 2, "decoder depth measured on its own");
+
+    Decoder predecoded(9, "predecoded_decoder", Decoder::Structure::PREDECODED);
+    for (uint16_t i = 0; i < 9; ++i)
+        predecoded.connect_input(&address[i], i);
+    Timing_Analysis predecoded_timing(predecoded);
+    check(predecoded_timing.get_clock_period() == 3, "9-bit predecoded decoder: 3 gate delays ("
+          + std::to_string(predecoded_timing.get_clock_period()) + ")");
+
+    Computer_3bit_v1* computer = nullptr;
+    {
+        std::ostringstream banner;
+        Console::Scope quiet(banner);
+        computer = new Computer_3bit_v1("timing");
+    }
+    Timing_Analysis timing(*computer);
+    const std::vector<Timing_Analysis::Phase_Timing>& phases = timing.get_phases();
+    check(phases.size() == 2 && phases[0].name == "read" && phases[1].name == "write",
+          "computer is timed as its read and write phases");
+
+    uint32_t period = 0;
+    bool paths_climb = true;
+    for (const Timing_Analysis::Phase_Timing& phase : phases)
+    {
+        period += phase.delay;
+        uint32_t arrival = 0;
+        for (const Timing_Analysis::Path_Step& step : phase.path)
+        {
+            paths_climb = paths_climb && step.arrival == arrival + step.gates && step.gates > 0;
+            arrival = step.arrival;
+        }
+        paths_climb = paths_climb && arrival == phase.delay;
+    }
+    check(period > 0 && period == timing.get_clock_period(), "clock period is the sum of the phases ("
+          + std::to_string(period) + " gate delays)");
+    check(paths_climb, "critical path arrivals climb to the phase delay");
+    check(phases.size() == 2 && !phases[1].capture.empty(), "write phase ends at a storage element");
+
+    const std::vector<Timing_Analysis::Component_Depth>& depths = timing.get_depths();
+    const auto ram_decoder = std::find_if(depths.begin(), depths.end(),
+        [](const Timing_Analysis::Component_Depth& entry) { return entry.name == "timing/ram_3bit_v1/Decoder"; });
+    check(ram_decoder != depths.end() && ram_decoder->depth == 2 && timing.get_depth(ram_decoder->component) == 2,
+          "RAM address decoder depth is 2");
+    check(timing.get_num_opaque() == 0, "every op of the gate-level computer is timed");
+    const auto through_ram_decoder = [](const Timing_Analysis::Path_Step& step)
+    {
+        return step.name == "timing/ram_3bit_v1/Decoder";
+    };
+    check(!phases.empty() && std::any_of(phases[0].path.begin(), phases[0].path.end(), through_ram_decoder),
+          "read path runs through the RAM read decoder");
+
+    timing.print(std::cout, 10);
+    delete computer;
+
+    std::cout << "\nTiming Analysis Test Summary: "
+              << (failures == 0 ? "✓ ALL PASS" : "✗ FAILURES") << "\n";
+}
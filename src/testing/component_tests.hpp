@@ -97,5 +97,91 @@ void test_component_type(uint16_t min_inputs = 1, uint16_t max_inputs = 4)
  */
 void test_all_components(uint16_t min_inputs = 1, uint16_t max_inputs = 4);
 
+/**
+ * @brief Checks each fixed-width device against its runtime-sized counterpart
+ * 
+ * Drives Fixed_Decoder, Fixed_Adder, Fixed_Comparator and Fixed_Multiplexer
+ * through every input combination, and Fixed_Register through a random
+ * sequence, comparing tree evaluation and the compiled netlist with the
+ * runtime device. Also runs an accumulator built from a Register and a
+ * Fixed_Adder against one built from a Fixed_Register and an Adder.
+ * 
+ * @param num_register_vectors Length of the random Fixed_Register sequence
+ */
+void test_fixed_width_devices(uint32_t num_register_vectors = 2000);
+
+/**
+ * @brief Checks the PREDECODED Decoder against the FLAT one
+ * 
+ * For every width from 2 to max_bits, drives both structures through every
+ * select value, comparing the PREDECODED decoder's tree evaluation and
+ * compiled netlist with the FLAT decoder, and prints the gate inputs each
+ * reads per evaluate(). From Decoder::predecode_min_bits up the PREDECODED
+ * decoder must read at most half as many. Also checks the predecoders'
+ * names.
+ * 
+ * @param max_bits Widest decoder to check
+ */
+void test_predecoded_decoder(uint16_t max_bits = 12);
+
+/**
+ * @brief Checks Bus tri-state drivers in both modes
+ * 
+ * Drives num_drivers random words through a WIRED_OR, a ONE_HOT and a
+ * trusted ONE_HOT Bus (with right, wrong and no active hints) and their
+ * compiled netlist, checking one-hot reads against the selected word, that
+ * several enabled drivers read as their OR in both checking modes (with
+ * contention warnings on or off) and are counted as contention, that the
+ * trusted bus then reads one enabled driver and counts nothing, and that no
+ * enabled driver reads as the always-on inputs alone.
+ * 
+ * @param num_drivers Drivers attached to each bus
+ * @param num_vectors Random enable patterns to apply
+ */
+void test_bus(uint32_t num_drivers = 64, uint32_t num_vectors = 2000);
+
+/**
+ * @brief Checks lazily built component names
+ * 
+ * Covers the "Class 0x<address> - name" format, renaming, and names derived
+ * through set_name_parent() chains (a Register's memory bits and their
+ * flip-flop gates), which must match the strings the constructors used to
+ * build eagerly.
+ */
+void test_component_names();
+
+/**
+ * @brief Checks placement of components in a Signal_Arena
+ * 
+ * Components created with new inside a Signal_Arena::Scope must come from
+ * the arena (a Register and its memory-bit array back to back), those
+ * created outside it from the heap, and both must evaluate and delete
+ * normally. Prints the arena summary of a Computer_3bit_v1.
+ */
+void test_component_arena();
+
+/**
+ * @brief Checks Memory_Footprint totals on a Register and a Computer_3bit_v1
+ * 
+ * Subtree totals must equal the sum of their nodes, members held by value
+ * (a Memory_Bit's gates) must be moved out of their owner's own bytes, and
+ * RAM, which a Computer compiles twice, must be counted once. Prints the
+ * computer's breakdown to the given depth.
+ * 
+ * @param max_depth Hierarchy depth printed for the computer
+ */
+void test_memory_footprint(size_t max_depth = 3);
+
+/**
+ * @brief Checks Timing_Analysis on Decoders and a Computer_3bit_v1
+ * 
+ * A 3-bit flat Decoder is two gate delays deep (input inverters, output
+ * ANDs) and a 9-bit predecoded one three. The computer must be timed as
+ * its read and write phases, with a clock period equal to their sum and
+ * critical paths whose arrivals climb to the phase delay. Prints the
+ * computer's timing report.
+ */
+void test_timing_analysis();
+
 #endif
 
@@ -0,0 +1,908 @@
+#include "computer_tests.hpp"
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../computers/Computer_Generic.hpp"
+#include "../utilities/evaluator.hpp"
+#include "../utilities/isa_simulator.hpp"
+#include "../utilities/profiler.hpp"
+#include "../utilities/regression_runner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+/**
+ * Step `reference` and `swapped` together until the reference halts or
+ * max_ticks, comparing run state, PC and RAM after every tick.
+ * Returns the number of mismatching ticks (stops at the first).
+ */
+static int compare_swapped_run(Computer& reference, Computer& swapped, uint64_t max_ticks, uint64_t& ticks)
+{
+    uint64_t run_ticks = 0;
+    while (run_ticks < max_ticks && reference.get_is_running())
+    {
+        reference.clock_tick();
+        swapped.clock_tick();
+        reference.sync_pc();
+        swapped.sync_pc();
+        ++run_ticks;
+        ++ticks;
+        bool pass = reference.get_is_running() == swapped.get_is_running() &&
+                    reference.get_pc() == swapped.get_pc();
+        for (uint16_t addr = 0; addr < reference.get_num_ram_addresses(); ++addr)
+        {
+            if (reference.read_ram(addr) != swapped.read_ram(addr))
+                pass = false;
+        }
+        if (!pass)
+        {
+            std::cout << "✗ tick " << run_ticks << ": PC reference=" << reference.get_pc()
+                      << " swapped=" << swapped.get_pc() << ", running reference=" << reference.get_is_running()
+                      << " swapped=" << swapped.get_is_running() << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void test_load_image(const std::string& mc_file, const std::string& other_file, uint64_t max_ticks)
+{
+    std::cout << "\n=== Testing bulk program swap (" << other_file << " -> " << mc_file << ") ===\n";
+
+    Computer_3bit_v1 reference;
+    Computer_3bit_v1 swapped;
+    if (!reference.load_program(mc_file) || !swapped.load_program(other_file))
+    {
+        std::cout << "✗ could not load programs\n";
+        return;
+    }
+    reference.prepare_run();
+    swapped.prepare_run();
+    swapped.set_event_driven_evaluation(true);
+    for (int tick = 0; tick < 50 && swapped.get_is_running(); ++tick)
+        swapped.clock_tick();
+    const Netlist* netlist_before = swapped.get_netlist();
+
+    // Image of the reference program, read back from its PM
+    std::vector<Computer::Instruction> image(reference.get_num_pm_addresses());
+    for (uint16_t addr = 0; addr < reference.get_num_pm_addresses(); ++addr)
+    {
+        Computer::Instruction& instr = image[addr];
+        reference.read_pm_instruction(addr, instr.opcode, instr.a, instr.b, instr.c);
+    }
+
+    int failures = 0;
+    if (!swapped.load_image(image))
+    {
+        std::cout << "✗ load_image rejected a valid image\n";
+        ++failures;
+    }
+    swapped.load_ram({});
+    swapped.reset_pc();
+    swapped.prepare_run();
+
+    for (uint16_t addr = 0; addr < reference.get_num_pm_addresses(); ++addr)
+    {
+        uint16_t ref[4], got[4];
+        reference.read_pm_instruction(addr, ref[0], ref[1], ref[2], ref[3]);
+        swapped.read_pm_instruction(addr, got[0], got[1], got[2], got[3]);
+        if (ref[0] != got[0] || ref[1] != got[1] || ref[2] != got[2] || ref[3] != got[3])
+        {
+            std::cout << "✗ PM[" << addr << "] differs after load_image\n";
+            ++failures;
+            break;
+        }
+    }
+    if (swapped.get_netlist() != netlist_before)
+    {
+        std::cout << "✗ compiled netlist was rebuilt by the swap\n";
+        ++failures;
+    }
+
+    uint64_t ticks = 0;
+    if (failures == 0)
+        failures += compare_swapped_run(reference, swapped, max_ticks, ticks);
+
+    // Swapping onto a halted machine must clear the latched halt, so the
+    // first tick runs instruction 0 instead of halting again
+    {
+        Computer_3bit_v1 fresh;
+        Computer_3bit_v1 halted;
+        fresh.load_program(mc_file);
+        halted.load_program(other_file);
+        fresh.prepare_run();
+        halted.prepare_run();
+        for (int tick = 0; tick < 50 && halted.get_is_running(); ++tick)
+            halted.clock_tick();
+        if (halted.get_is_running())
+        {
+            halted.sync_pc();
+            halted.write_pm_instruction(static_cast<uint16_t>(halted.get_pc()), 0, 0, 0, 0);  // HALT
+            halted.clock_tick();
+        }
+        if (halted.get_is_running())
+        {
+            std::cout << "✗ could not halt the machine to swap onto\n";
+            ++failures;
+        }
+        else
+        {
+            halted.load_image(image);
+            halted.load_ram({});
+            halted.reset_pc();
+            halted.prepare_run();
+            const int halted_failures = compare_swapped_run(fresh, halted, max_ticks, ticks);
+            if (halted_failures == 0)
+                std::cout << "✓ swap onto a halted machine runs like a fresh load\n";
+            failures += halted_failures;
+        }
+    }
+
+    // Out-of-range values must be rejected without touching PM
+    std::vector<Computer::Instruction> bad_image(1);
+    bad_image[0].opcode = static_cast<uint16_t>(1u << swapped.get_num_bits());
+    if (swapped.load_image(bad_image))
+    {
+        std::cout << "✗ load_image accepted an out-of-range opcode\n";
+        ++failures;
+    }
+
+    std::cout << "\nLoad Image Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_profiler(const std::string& mc_file, uint64_t num_ticks)
+{
+    std::cout << "\n=== Testing evaluate() profiler (" << mc_file << ") ===\n";
+
+    Computer_3bit_v1 reference;
+    Computer_3bit_v1 profiled;
+    if (!reference.load_program(mc_file) || !profiled.load_program(mc_file))
+    {
+        std::cout << "✗ could not load program\n";
+        return;
+    }
+    reference.prepare_run();
+    profiled.prepare_run();
+    profiled.reset_profile();
+    profiled.set_profiling(true);
+
+    int failures = 0;
+    uint64_t ticks = 0;
+    while (ticks < num_ticks && failures == 0 && reference.get_is_running())
+    {
+        reference.clock_tick();
+        profiled.clock_tick();
+        reference.sync_pc();
+        profiled.sync_pc();
+        ++ticks;
+        bool pass = reference.get_pc() == profiled.get_pc();
+        for (uint16_t addr = 0; addr < reference.get_num_ram_addresses(); ++addr)
+        {
+            if (reference.read_ram(addr) != profiled.read_ram(addr))
+                pass = false;
+        }
+        if (!pass)
+        {
+            std::cout << "✗ tick " << ticks << ": profiled run diverged\n";
+            ++failures;
+        }
+    }
+    profiled.set_profiling(false);
+
+    std::ostringstream report;
+    Profiler::print_report(report);
+    for (const char* name : { "Computer_3bit_v1", "Main_Memory", "Program_Memory", "Control_Unit", "AND_Gate" })
+    {
+        if (report.str().find(name) == std::string::npos)
+        {
+            std::cout << "✗ report is missing " << name << "\n";
+            ++failures;
+        }
+    }
+    profiled.print_profile(8, 2);
+    profiled.reset_profile();
+
+    std::cout << "\nProfiler Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+/**
+ * Run `computer` for up to max_ticks ticks and leave it in the last state
+ * whose next tick still runs, so a program that halts early stops one tick
+ * before the tick that halts. Returns false if the first tick already halts.
+ */
+static bool run_while_next_tick_runs(Computer& computer, uint64_t max_ticks)
+{
+    Computer::Checkpoint before_tick;
+    Computer::Checkpoint last_running;
+    bool found = false;
+    for (uint64_t tick = 0; tick < max_ticks && computer.get_is_running(); ++tick)
+    {
+        computer.save_checkpoint(before_tick);
+        computer.clock_tick();
+        if (!computer.get_is_running())
+            break;
+        std::swap(before_tick, last_running);
+        found = true;
+    }
+    return found && computer.restore_checkpoint(last_running);
+}
+
+/// Evaluator with its fault-injection testing interface made reachable
+class Fault_Injecting_Evaluator : public Evaluator
+{
+public:
+    using Evaluator::inject_fault;
+    using Evaluator::clear_fault;
+};
+
+void test_checkpoints(const std::string& mc_file, uint64_t num_ticks, uint32_t check_interval)
+{
+    std::cout << "\n=== Testing checkpoints and checkpointed evaluation (" << mc_file << ") ===\n";
+
+    int failures = 0;
+    uint64_t ticks = 0;
+    for (int run = 0; run < 3; ++run)
+    {
+        // Tree, event-driven, and tree over word-level RAM (stored outside the signals)
+        const bool event_driven = run == 1;
+        const bool word_level = run == 2;
+        Computer_3bit_v1 computer("", word_level ? Main_Memory::Engine::WORD_LEVEL : Main_Memory::Engine::GATE_LEVEL);
+        if (!computer.load_program(mc_file))
+        {
+            std::cout << "✗ could not load program\n";
+            return;
+        }
+        computer.prepare_run();
+        computer.set_event_driven_evaluation(event_driven);
+        const char* mode = word_level ? "word-level RAM" : event_driven ? "event-driven" : "tree";
+
+        if (!run_while_next_tick_runs(computer, num_ticks / 2))
+        {
+            std::cout << "  " << mode << ": program halts on its first tick, nothing to replay\n";
+            continue;
+        }
+        Computer::Checkpoint checkpoint;
+        computer.save_checkpoint(checkpoint);
+
+        // Record the second half, then replay it from the checkpoint
+        std::vector<std::vector<uint16_t>> recorded;
+        while (recorded.size() < num_ticks - num_ticks / 2 && computer.get_is_running())
+        {
+            computer.clock_tick();
+            computer.sync_pc();
+            std::vector<uint16_t> state(1, computer.get_pc());
+            for (uint16_t addr = 0; addr < computer.get_num_ram_addresses(); ++addr)
+                state.push_back(computer.read_ram(addr));
+            recorded.push_back(state);
+        }
+        if (!computer.restore_checkpoint(checkpoint))
+        {
+            std::cout << "✗ " << mode << ": restore failed\n";
+            ++failures;
+            continue;
+        }
+        bool replay_ok = true;
+        for (size_t tick = 0; tick < recorded.size() && replay_ok; ++tick)
+        {
+            computer.clock_tick();
+            computer.sync_pc();
+            std::vector<uint16_t> state(1, computer.get_pc());
+            for (uint16_t addr = 0; addr < computer.get_num_ram_addresses(); ++addr)
+                state.push_back(computer.read_ram(addr));
+            ++ticks;
+            if (state != recorded[tick])
+            {
+                std::cout << "✗ " << mode << ": replay diverged " << tick << " ticks after the checkpoint\n";
+                ++failures;
+                replay_ok = false;
+            }
+        }
+        if (replay_ok)
+            std::cout << "✓ " << mode << ": " << recorded.size() << " ticks replayed from checkpoint\n";
+    }
+
+    // Restoring rewinds the PM flip-flops, so the ROM fetch image must not
+    // keep an instruction written after the checkpoint
+    {
+        Computer_3bit_v1 computer;
+        computer.load_program(mc_file);
+        computer.prepare_run();
+        // The checkpoint must be taken on a machine whose next tick runs,
+        // or neither check below can tell the ROM image apart
+        const bool running = run_while_next_tick_runs(computer, num_ticks / 2);
+        computer.sync_pc();
+        const uint16_t pc = static_cast<uint16_t>(computer.get_pc());
+        Computer::Checkpoint checkpoint;
+        computer.save_checkpoint(checkpoint);
+
+        bool halted_on_patch = false;
+        if (running)
+        {
+            computer.write_pm_instruction(pc, 0, 0, 0, 0);  // HALT
+            computer.clock_tick();
+            halted_on_patch = !computer.get_is_running();
+            computer.restore_checkpoint(checkpoint);
+            computer.clock_tick();
+        }
+        if (!running)
+        {
+            std::cout << "  program halts on its first tick, ROM image check skipped\n";
+        }
+        else if (!halted_on_patch || !computer.get_is_running())
+        {
+            std::cout << "✗ restore_checkpoint kept the ROM image of a PM write made after the checkpoint\n";
+            ++failures;
+        }
+        else
+        {
+            std::cout << "✓ restore_checkpoint drops the ROM image of a later PM write\n";
+        }
+    }
+
+    // Listing and per-step output of both evaluator runs stay out of the test log
+    Fault_Injecting_Evaluator evaluator;
+    std::ostringstream quiet;
+    std::streambuf* console = std::cout.rdbuf(quiet.rdbuf());
+    bool per_tick_ok = evaluator.evaluate(mc_file, false);
+    int per_tick_steps = evaluator.summary().total;
+    bool checkpointed_ok = evaluator.evaluate_checkpointed(mc_file, check_interval);
+    int checkpointed_steps = evaluator.summary().total;
+    std::cout.rdbuf(console);
+
+    if (!per_tick_ok || !checkpointed_ok || per_tick_steps != checkpointed_steps)
+    {
+        std::cout << "✗ evaluator: per-tick " << (per_tick_ok ? "pass" : "FAIL") << " (" << per_tick_steps
+                  << " steps), checkpointed " << (checkpointed_ok ? "pass" : "FAIL") << " ("
+                  << checkpointed_steps << " steps)\n";
+        ++failures;
+    }
+    else
+    {
+        std::cout << "✓ evaluator: " << checkpointed_steps << " steps, hash check every "
+                  << check_interval << " cycles\n";
+    }
+
+    // Force a divergence at a known step: flip a RAM word the program never
+    // writes, so nothing can mask it before the next hash check
+    std::string isa_key;
+    std::vector<ISA_Simulator::Instruction> program;
+    ISA_Simulator::read_mc_file(mc_file, isa_key, program);
+    const ISA_Def& isa = *get_isa(isa_key.empty() ? "3bit_v1" : isa_key);
+    ISA_Simulator reference(isa);
+    reference.load_program(program);
+    const uint64_t fault_step = static_cast<uint64_t>(per_tick_steps) / 2;
+    uint16_t fault_pc = 0;
+    std::vector<bool> written(reference.get_ram().size(), false);
+    for (uint64_t step = 0; step < static_cast<uint64_t>(per_tick_steps) && !reference.is_halted(); ++step)
+    {
+        if (step == fault_step)
+            fault_pc = reference.get_pc();
+        reference.step();
+        if (reference.get_last_write() != ISA_Simulator::NO_WRITE)
+            written[reference.get_last_write()] = true;
+    }
+    const auto unwritten = std::find(written.rbegin(), written.rend(), false);
+    if (unwritten == written.rend())
+    {
+        std::cout << "✗ bisection: program writes every RAM word, nowhere to inject a fault\n";
+        ++failures;
+    }
+    else
+    {
+        const uint16_t fault_address = static_cast<uint16_t>(written.rend() - unwritten - 1);
+        std::string mnemonic = "???";
+        for (const auto& op : isa.opcodes)
+        {
+            if (fault_pc < program.size() && op.opcode == program[fault_pc].opcode)
+                mnemonic = op.name;
+        }
+        const std::string expected = "Step " + std::to_string(fault_step) + " (PC=" + std::to_string(fault_pc)
+                                   + ") " + mnemonic + " ";
+
+        evaluator.inject_fault(fault_step, fault_address);
+        console = std::cout.rdbuf(quiet.rdbuf());
+        const bool faulted_ok = evaluator.evaluate_checkpointed(mc_file, check_interval);
+        std::cout.rdbuf(console);
+        evaluator.clear_fault();
+
+        const Evaluator::Summary& summary = evaluator.summary();
+        const bool names_step = !summary.failures.empty() && summary.failures[0].rfind(expected, 0) == 0;
+        const bool reports_ram = summary.failures.size() > 1 &&
+                                 summary.failures[1].find("RAM[") != std::string::npos;
+        if (faulted_ok || summary.passed != static_cast<int>(fault_step) || !names_step || !reports_ram)
+        {
+            std::cout << "✗ bisection: fault at step " << fault_step << " (RAM[" << fault_address << "]), reported "
+                      << (summary.failures.empty() ? "nothing" : summary.failures[0])
+                      << ", " << summary.passed << " steps passed\n";
+            ++failures;
+        }
+        else
+        {
+            std::cout << "✓ bisection: fault at step " << fault_step << " reported as \""
+                      << summary.failures[0] << "\"\n";
+        }
+    }
+
+    std::cout << "\nCheckpoint Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_save_state(const std::string& mc_file, const std::string& other_file, uint64_t num_ticks)
+{
+    std::cout << "\n=== Testing save_state / restore_state (" << mc_file << ", fork over " << other_file << ") ===\n";
+
+    Computer_3bit_v1 original;
+    Computer_3bit_v1 fork;
+    if (!original.load_program(mc_file) || !fork.load_program(other_file))
+    {
+        std::cout << "✗ could not load programs\n";
+        return;
+    }
+    original.prepare_run();
+    fork.prepare_run();
+    fork.set_event_driven_evaluation(true);
+
+    original.run_headless(num_ticks);
+    fork.run_headless(num_ticks / 3 + 1);
+    std::vector<uint8_t> state = original.save_state();
+    std::cout << "State: " << state.size() << " bytes for "
+              << original.get_signal_arena().get_flip_flops().size() << " flip-flops\n";
+
+    int failures = 0;
+    if (!fork.restore_state(state))
+    {
+        std::cout << "✗ restore into fork failed\n";
+        ++failures;
+    }
+
+    // Fork and original must now run in lockstep; record the original for the rewind
+    auto snapshot = [](Computer& computer)
+    {
+        computer.sync_pc();
+        std::vector<uint16_t> values(1, computer.get_pc());
+        values.push_back(computer.get_is_running());
+        for (uint16_t addr = 0; addr < computer.get_num_ram_addresses(); ++addr)
+            values.push_back(computer.read_ram(addr));
+        return values;
+    };
+    std::vector<std::vector<uint16_t>> recorded;
+    uint64_t ticks = 0;
+    while (ticks < num_ticks && failures == 0 && original.get_is_running())
+    {
+        original.clock_tick();
+        fork.clock_tick();
+        ++ticks;
+        recorded.push_back(snapshot(original));
+        if (snapshot(fork) != recorded.back())
+        {
+            std::cout << "✗ fork diverged " << ticks << " ticks after the restore\n";
+            ++failures;
+        }
+    }
+    if (failures == 0)
+        std::cout << "✓ fork matched the original for " << ticks << " ticks\n";
+
+    if (!original.restore_state(state))
+        ++failures;
+    for (size_t tick = 0; tick < recorded.size() && failures == 0; ++tick)
+    {
+        original.clock_tick();
+        if (snapshot(original) != recorded[tick])
+        {
+            std::cout << "✗ rewind diverged at tick " << tick << "\n";
+            ++failures;
+        }
+    }
+    if (failures == 0)
+        std::cout << "✓ rewind replayed " << recorded.size() << " ticks\n";
+
+    // Word-level RAM is not built from flip-flops: the blob must carry its words
+    Computer_3bit_v1 word_level("word_level", Main_Memory::Engine::WORD_LEVEL);
+    bool word_level_ok = word_level.load_program(mc_file);
+    word_level.prepare_run();
+    word_level.run_headless(3);
+    const std::vector<uint8_t> word_state = word_level.save_state();
+    const std::vector<uint16_t> word_saved = snapshot(word_level);
+    word_level.run_headless(num_ticks);
+    const std::vector<uint16_t> word_after = snapshot(word_level);
+    word_level_ok = word_level_ok && word_level.restore_state(word_state) && snapshot(word_level) == word_saved;
+    word_level.run_headless(num_ticks);
+    word_level_ok = word_level_ok && snapshot(word_level) == word_after;
+    std::cout << (word_level_ok ? "✓ " : "✗ ") << "word-level RAM restored and replayed " << num_ticks << " ticks\n";
+    failures += !word_level_ok;
+
+    std::vector<uint8_t> truncated(state.begin(), state.end() - 1);
+    std::ostringstream expected_error;
+    std::streambuf* console = std::cerr.rdbuf(expected_error.rdbuf());
+    bool accepted = original.restore_state(truncated);
+    std::cerr.rdbuf(console);
+    if (accepted)
+    {
+        std::cout << "✗ truncated state was accepted\n";
+        ++failures;
+    }
+
+    std::cout << "\nSave State Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_banked_evaluation(const std::string& mc_file, uint16_t num_workers, uint64_t num_ticks)
+{
+    std::cout << "\n=== Testing banked memory evaluation (" << mc_file << ", "
+              << num_workers << " workers) ===\n";
+
+    Computer_3bit_v1 serial;
+    Computer_3bit_v1 banked;
+    banked.set_num_workers(num_workers);
+    if (!serial.load_program(mc_file) || !banked.load_program(mc_file))
+    {
+        std::cout << "✗ could not load program\n";
+        return;
+    }
+    serial.prepare_run();
+    banked.prepare_run();
+
+    int failures = 0;
+    for (uint16_t address = 0; address < serial.get_num_pm_addresses(); ++address)
+    {
+        uint16_t expected[4], actual[4];
+        serial.read_pm_instruction(address, expected[0], expected[1], expected[2], expected[3]);
+        banked.read_pm_instruction(address, actual[0], actual[1], actual[2], actual[3]);
+        if (!std::equal(expected, expected + 4, actual))
+        {
+            std::cout << "✗ PM[" << address << "] differs after banked load\n";
+            ++failures;
+            break;
+        }
+    }
+
+    uint64_t ticks = 0;
+    while (ticks < num_ticks && failures == 0 && serial.get_is_running())
+    {
+        // Drop back to one thread halfway to check the pool can be detached mid-run
+        if (ticks == num_ticks / 2)
+            banked.set_num_workers(1);
+        serial.clock_tick();
+        banked.clock_tick();
+        serial.sync_pc();
+        banked.sync_pc();
+        ++ticks;
+        bool pass = serial.get_pc() == banked.get_pc() && serial.get_is_running() == banked.get_is_running();
+        for (uint16_t addr = 0; addr < serial.get_num_ram_addresses(); ++addr)
+        {
+            if (serial.read_ram(addr) != banked.read_ram(addr))
+                pass = false;
+        }
+        if (!pass)
+        {
+            std::cout << "✗ tick " << ticks << ": banked run diverged\n";
+            ++failures;
+        }
+    }
+    if (failures == 0)
+        std::cout << "✓ " << ticks << " ticks identical to serial evaluation\n";
+
+    std::cout << "\nBanked Evaluation Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_regression_runner(const std::string& program_dir, uint16_t num_jobs)
+{
+    std::cout << "\n=== Testing regression runner (" << program_dir << ", "
+              << num_jobs << " jobs) ===\n";
+
+    std::vector<std::string> files = Regression_Runner::find_programs(program_dir);
+    if (files.empty())
+    {
+        std::cout << "✗ no .mc programs in " << program_dir << "\n";
+        return;
+    }
+
+    // Anything a job prints outside its buffer would land here
+    std::ostringstream leaked;
+    std::streambuf* console = std::cout.rdbuf(leaked.rdbuf());
+    std::vector<Regression_Runner::Result> serial = Regression_Runner(1).run_all(files);
+    std::vector<Regression_Runner::Result> parallel = Regression_Runner(num_jobs).run_all(files);
+    std::cout.rdbuf(console);
+
+    int failures = 0;
+    if (!leaked.str().empty())
+    {
+        std::cout << "✗ jobs wrote " << leaked.str().size() << " bytes to std::cout\n";
+        ++failures;
+    }
+
+    int steps = 0;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        const Regression_Runner::Result& s = serial[i];
+        const Regression_Runner::Result& p = parallel[i];
+        steps += p.summary.total;
+        if (p.file != files[i] || p.passed != s.passed || p.summary.passed != s.summary.passed
+            || p.summary.total != s.summary.total || p.output != s.output)
+        {
+            std::cout << "✗ " << files[i] << ": parallel result differs from serial\n";
+            ++failures;
+        }
+        if (!p.passed)
+        {
+            std::cout << "✗ " << files[i] << ": " << p.summary.failed << " steps failed\n";
+            ++failures;
+        }
+        // Each buffer holds only its own program's listing
+        for (size_t j = 0; j < files.size(); ++j)
+        {
+            if (j != i && p.output.find(files[j]) != std::string::npos)
+            {
+                std::cout << "✗ " << files[i] << ": output mentions " << files[j] << "\n";
+                ++failures;
+            }
+        }
+    }
+
+    Evaluator::Summary total = Regression_Runner::combine(parallel);
+    if (total.total != steps || total.passed + total.failed != total.total)
+    {
+        std::cout << "✗ combined summary does not add up\n";
+        ++failures;
+    }
+
+    // The Profiler is process-wide: a profiled run_all() must fall back to
+    // one job instead of racing on its call stack
+    {
+        const std::vector<std::string> twice = { files[0], files[0] };
+        Profiler::reset();
+        Profiler::set_enabled(true);
+        std::vector<Regression_Runner::Result> profiled = Regression_Runner(num_jobs).run_all(twice);
+        Profiler::set_enabled(false);
+        std::ostringstream report;
+        Profiler::print_report(report);
+        Profiler::reset();
+        const bool same = profiled[0].passed == serial[0].passed && profiled[1].passed == serial[0].passed &&
+                          profiled[0].summary.total == serial[0].summary.total &&
+                          profiled[1].summary.total == serial[0].summary.total;
+        if (!same || report.str().find("Computer_3bit_v1") == std::string::npos)
+        {
+            std::cout << "✗ profiled run_all() differs from serial or left no profile\n";
+            ++failures;
+        }
+    }
+
+    std::ostringstream json, junit;
+    Regression_Runner::write_json(json, parallel);
+    Regression_Runner::write_junit(junit, parallel);
+    size_t testcases = 0;
+    for (size_t pos = junit.str().find("<testcase"); pos != std::string::npos; pos = junit.str().find("<testcase", pos + 1))
+        ++testcases;
+    if (testcases != files.size() || json.str().find("\"programs\": " + std::to_string(files.size())) == std::string::npos)
+    {
+        std::cout << "✗ reports do not list every program\n";
+        ++failures;
+    }
+    if (failures == 0)
+        std::cout << "✓ " << files.size() << " programs, " << steps << " steps, parallel identical to serial\n";
+
+    std::cout << "\nRegression Runner Test Summary: " << steps << " steps, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_sparse_pm_computer(const std::string& mc_file, uint64_t max_ticks)
+{
+    std::cout << "\n=== Testing sparse Program Memory computer (" << mc_file << ") ===\n";
+
+    Computer_3bit_v1 reference;
+    Computer_3bit_v1 sparse("", Main_Memory::Engine::GATE_LEVEL, Program_Memory::Engine::SPARSE);
+    if (!reference.load_program(mc_file) || !sparse.load_program(mc_file))
+    {
+        std::cout << "✗ could not load " << mc_file << "\n";
+        return;
+    }
+    reference.prepare_run();
+    sparse.prepare_run();
+    sparse.set_event_driven_evaluation(true);
+
+    int failures = 0;
+    for (uint32_t addr = 0; addr < reference.get_num_pm_addresses(); ++addr)
+    {
+        uint16_t ref[4], got[4];
+        reference.read_pm_instruction(static_cast<uint16_t>(addr), ref[0], ref[1], ref[2], ref[3]);
+        sparse.read_pm_instruction(static_cast<uint16_t>(addr), got[0], got[1], got[2], got[3]);
+        if (ref[0] != got[0] || ref[1] != got[1] || ref[2] != got[2] || ref[3] != got[3])
+        {
+            std::cout << "✗ PM[" << addr << "] differs after load_program\n";
+            ++failures;
+            break;
+        }
+    }
+
+    uint64_t ticks = 0;
+    while (ticks < max_ticks && failures == 0 && reference.get_is_running())
+    {
+        reference.clock_tick();
+        sparse.clock_tick();
+        reference.sync_pc();
+        sparse.sync_pc();
+        ++ticks;
+        bool pass = reference.get_is_running() == sparse.get_is_running() &&
+                    reference.get_pc() == sparse.get_pc();
+        for (uint16_t addr = 0; addr < reference.get_num_ram_addresses(); ++addr)
+        {
+            if (reference.read_ram(addr) != sparse.read_ram(addr))
+                pass = false;
+        }
+        if (!pass)
+        {
+            std::cout << "✗ tick " << ticks << ": PC reference=" << reference.get_pc()
+                      << " sparse=" << sparse.get_pc() << "\n";
+            ++failures;
+        }
+    }
+    if (failures == 0 && sparse.get_is_running() != reference.get_is_running())
+        ++failures;
+
+    std::cout << "\nSparse PM Computer Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+/// Counting loop over every ISA v1 op; with `far_jump` it ends with a jump to 2^(pc_bits-1) + 5.
+static std::vector<Computer::Instruction> generic_test_program(const ISA_Def& isa, bool far_jump)
+{
+    const uint16_t n = isa.num_bits;
+    const uint16_t mask = static_cast<uint16_t>((1u << n) - 1);
+    auto jump = [&](uint16_t opcode, uint32_t target) {
+        return Computer::Instruction{ opcode, static_cast<uint16_t>((target >> (2 * n)) & mask),
+                                      static_cast<uint16_t>((target >> n) & mask),
+                                      static_cast<uint16_t>(target & mask) };
+    };
+    std::vector<Computer::Instruction> program = {
+        { 0b001, 1, 0, 1 },   // MOVL   1 -> [0:1]
+        { 0b001, 5, 1, 2 },   // MOVL   5 -> [1:2]
+        { 0b010, 0, 1, 0 },   // ADD    [0] + [1] -> [0]
+        { 0b111, 0, 1, 3 },   // MOVOUT [0:0] -> [1:3]
+        { 0b100, 0, 1, 2 },   // CMP    [0] vs [1:2]
+        jump(0b110, 9),       // JGT    9
+        { 0b100, 0, 0, 0 },   // CMP    [0] vs [0:0]
+        jump(0b101, 2),       // JEQ    2
+        { 0b000, 0, 0, 0 },   // HALT (not reached)
+        { 0b100, 0, 0, 0 },   // CMP    [0] vs [0:0]
+    };
+    if (!far_jump)
+        return program;
+    const uint32_t target = (1u << (isa.pc_bits - 1)) + 5;
+    program.push_back(jump(0b101, target));    // JEQ    far
+    program.resize(target);
+    program.push_back({ 0b001, 7, 0, 4 });     // MOVL   7 -> [0:4], then HALT
+    return program;
+}
+
+void test_generic_computer(const std::string& mc_file, uint64_t max_ticks)
+{
+    std::cout << "\n=== Testing generic computer (" << mc_file << ", 4bit_v1, 8bit_v1) ===\n";
+    int failures = 0;
+
+    // Same machine as the hand-wired 3-bit v1
+    {
+        Computer_3bit_v1 reference;
+        Computer_Generic generic(*get_isa("3bit_v1"));
+        if (!reference.load_program(mc_file) || !generic.load_program(mc_file))
+        {
+            std::cout << "✗ could not load " << mc_file << "\n";
+            return;
+        }
+        reference.prepare_run();
+        generic.prepare_run();
+        generic.set_event_driven_evaluation(true);
+
+        uint64_t ticks = 0;
+        int mismatches = 0;
+        while (ticks < max_ticks && mismatches == 0 && reference.get_is_running())
+        {
+            reference.clock_tick();
+            generic.clock_tick();
+            reference.sync_pc();
+            generic.sync_pc();
+            ++ticks;
+            bool pass = reference.get_is_running() == generic.get_is_running() &&
+                        reference.get_pc() == generic.get_pc();
+            for (uint16_t addr = 0; addr < reference.get_num_ram_addresses(); ++addr)
+            {
+                if (reference.read_ram(addr) != generic.read_ram(addr))
+                    pass = false;
+            }
+            if (!pass)
+            {
+                std::cout << "✗ tick " << ticks << ": PC 3bit_v1=" << reference.get_pc()
+                          << " generic=" << generic.get_pc() << "\n";
+                ++mismatches;
+            }
+        }
+        if (mismatches == 0)
+            std::cout << "✓ 3bit_v1: " << ticks << " ticks match Computer_3bit_v1\n";
+        failures += mismatches;
+    }
+
+    // Wider machines against the ISA simulator
+    for (const char* key : { "4bit_v1", "8bit_v1" })
+    {
+        const ISA_Def& isa = *get_isa(key);
+        auto start = std::chrono::steady_clock::now();
+        Computer_Generic computer(isa, key);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const bool fast = seconds < 1.0;
+        std::cout << (fast ? "✓ " : "✗ ") << key << ": constructed in " << seconds << " s ("
+                  << computer.get_num_pm_addresses() << " PM addresses, "
+                  << computer.get_num_ram_addresses() << " RAM addresses)\n";
+        failures += !fast;
+
+        const std::vector<Computer::Instruction> program = generic_test_program(isa, isa.pc_bits > 15);
+        std::vector<ISA_Simulator::Instruction> sim_program;
+        for (const Computer::Instruction& instr : program)
+            sim_program.push_back({ instr.opcode, instr.a, instr.b, instr.c });
+        ISA_Simulator sim(isa);
+        if (!computer.load_image(program) || !sim.load_program(sim_program))
+        {
+            std::cout << "✗ " << key << ": could not load the test program\n";
+            ++failures;
+            continue;
+        }
+        computer.prepare_run();
+
+        uint64_t ticks = 0;
+        int mismatches = 0;
+        while (ticks < max_ticks && mismatches == 0 && computer.get_is_running())
+        {
+            computer.clock_tick();
+            computer.sync_pc();
+            sim.step();
+            ++ticks;
+            bool pass = computer.get_pc() == sim.get_pc() && computer.get_is_running() == !sim.is_halted();
+            for (uint16_t addr = 0; addr < computer.get_num_ram_addresses(); ++addr)
+            {
+                if (computer.read_ram(addr) != sim.read_ram(addr))
+                    pass = false;
+            }
+            if (!pass)
+            {
+                std::cout << "✗ " << key << " tick " << ticks << ": PC gate=" << computer.get_pc()
+                          << " isa=" << sim.get_pc() << "\n";
+                ++mismatches;
+            }
+        }
+        // The loop must have run to its HALT, storing 7 at [0:4] after a far jump
+        const bool finished = !computer.get_is_running() && (isa.pc_bits <= 15 || computer.read_ram(4) == 7);
+        if (mismatches == 0 && finished)
+            std::cout << "✓ " << key << ": " << ticks << " ticks match the ISA simulator\n";
+        else if (!finished)
+            std::cout << "✗ " << key << ": test program did not finish\n";
+        failures += mismatches + !finished;
+    }
+
+    std::cout << "\nGeneric Computer Test Summary: ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
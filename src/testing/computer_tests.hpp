@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Test bulk program swaps (Computer::load_image / load_ram)
+ * 
+ * Runs `other_file` on a compiled, event-driven Computer_3bit_v1, then
+ * swaps in the image of `mc_file` with load_image(), clears RAM with
+ * load_ram() and resets the PC. Checks that PM matches a freshly loaded
+ * reference, that the compiled netlist survived the swap, and that both
+ * machines then execute identically. Then repeats the swap on a machine
+ * that has halted running `other_file` and checks it runs like a fresh
+ * load instead of halting again.
+ * 
+ * @param mc_file Program to swap in (.mc machine code)
+ * @param other_file Program that runs before the swap
+ * @param max_ticks Stop after this many ticks if the program has not halted
+ */
+void test_load_image(const std::string& mc_file, const std::string& other_file, uint64_t max_ticks = 1000);
+
+/**
+ * @brief Test the evaluate() profiler (Computer::set_profiling / print_profile)
+ * 
+ * Runs `mc_file` on two Computer_3bit_v1 instances, one with profiling on,
+ * and checks that profiling does not change execution and that the report
+ * lists the computer and its parts.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param num_ticks Number of clock ticks to run
+ */
+void test_profiler(const std::string& mc_file, uint64_t num_ticks = 200);
+
+/**
+ * @brief Test machine checkpoints and checkpointed differential evaluation
+ * 
+ * Runs `mc_file` halfway (or, if it halts sooner, to the last tick before
+ * the one that halts), saves a Computer::Checkpoint, records the rest of
+ * the run, restores and checks the replay matches tick for tick (tree and
+ * event-driven evaluation). Then checks Evaluator::evaluate_checkpointed()
+ * passes and covers as many steps as the per-tick Evaluator::evaluate(),
+ * and that with a fault injected halfway through (Evaluator::inject_fault)
+ * it bisects down to exactly that step and instruction.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param num_ticks Length of the recorded run
+ * @param check_interval Cycles between hash checks in the evaluator
+ */
+void test_checkpoints(const std::string& mc_file, uint64_t num_ticks = 400, uint32_t check_interval = 64);
+
+/**
+ * @brief Test Computer::save_state / restore_state
+ * 
+ * Runs `mc_file` for `num_ticks` ticks and saves its state, then forks it
+ * into a second, event-driven computer that was running `other_file`.
+ * Checks the fork continues exactly like the original, that rewinding the
+ * original to the blob replays identically, and that a malformed blob is
+ * rejected.
+ * 
+ * @param mc_file Program to save mid-run (.mc machine code)
+ * @param other_file Program running on the fork target before the restore
+ * @param num_ticks Ticks before the save, and ticks compared after it
+ */
+void test_save_state(const std::string& mc_file, const std::string& other_file, uint64_t num_ticks = 300);
+
+/**
+ * @brief Test banked multi-threaded memory evaluation (Computer::set_num_workers)
+ * 
+ * Loads and runs `mc_file` on a serial Computer_3bit_v1 and on one whose
+ * Program_Memory and Main_Memory are evaluated in banks by `num_workers`
+ * threads (set before loading, so the PM writes take the banked path too).
+ * Checks PM contents, PC and RAM match after every tick, and that switching
+ * back to one worker keeps the machines in lockstep.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param num_workers Threads for the banked computer
+ * @param num_ticks Stop after this many ticks if the program has not halted
+ */
+void test_banked_evaluation(const std::string& mc_file, uint16_t num_workers = 4, uint64_t num_ticks = 300);
+
+/**
+ * @brief Test Regression_Runner (concurrent Evaluator runs)
+ * 
+ * Evaluates every .mc file in `program_dir` serially and with `num_jobs`
+ * jobs. Checks both runs agree program by program (pass/fail, step counts,
+ * buffered output), that nothing leaks to std::cout while jobs run, that
+ * each job's output names only its own program, that a run with the
+ * Profiler enabled still matches and records a profile, and that the
+ * combined summary and JSON/JUnit reports cover every program.
+ * 
+ * @param program_dir Directory of .mc programs
+ * @param num_jobs Programs evaluated at once in the parallel run
+ */
+void test_regression_runner(const std::string& program_dir, uint16_t num_jobs = 4);
+
+/**
+ * @brief Test a Computer_3bit_v1 built with the SPARSE Program_Memory engine
+ * 
+ * Loads `mc_file` into a gate-level reference and into a sparse-PM machine
+ * running event-driven, checks the PM contents read back the same, then
+ * checks PC, halt state and RAM match after every tick.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param max_ticks Stop after this many ticks if the program has not halted
+ */
+void test_sparse_pm_computer(const std::string& mc_file, uint64_t max_ticks = 1000);
+
+/**
+ * @brief Test Computer_Generic (a computer wired from an ISA_Def)
+ * 
+ * Runs `mc_file` on Computer_Generic built from 3bit_v1 (event-driven) and
+ * on the hand-wired Computer_3bit_v1, checking PC, halt state and RAM after
+ * every tick. Then builds 4bit_v1 and 8bit_v1, checks each constructs in
+ * under a second, and runs a counting loop that uses every ISA v1 op (and,
+ * on 8-bit, a jump past address 2^15) in lockstep with the ISA_Simulator.
+ * 
+ * @param mc_file 3bit_v1 program to run (.mc machine code)
+ * @param max_ticks Stop after this many ticks if the program has not halted
+ */
+void test_generic_computer(const std::string& mc_file, uint64_t max_ticks = 1000);
@@ -0,0 +1,81 @@
+#include "isa_simulator_tests.hpp"
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/isa_simulator.hpp"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+void test_isa_simulator(const std::string& mc_file, uint64_t max_ticks, uint64_t speed_instructions)
+{
+    std::cout << "\n=== Testing ISA simulator against gate level (" << mc_file << ") ===\n";
+
+    Computer_3bit_v1 computer;
+    ISA_Simulator sim(*get_isa("3bit_v1"));
+    if (!computer.load_program(mc_file) || !sim.load_mc_file(mc_file))
+    {
+        std::cout << "✗ could not load program\n";
+        return;
+    }
+    computer.prepare_run();
+
+    int failures = 0;
+    uint64_t ticks = 0;
+    while (ticks < max_ticks && failures == 0 && computer.get_is_running())
+    {
+        computer.clock_tick();
+        computer.sync_pc();
+        sim.step();
+        ++ticks;
+
+        bool pass = computer.get_pc() == sim.get_pc() &&
+                    computer.get_is_running() == !sim.is_halted();
+        for (uint16_t addr = 0; addr < computer.get_num_ram_addresses(); ++addr)
+        {
+            if (computer.read_ram(addr) != sim.read_ram(addr))
+                pass = false;
+        }
+        if (!pass)
+        {
+            std::cout << "✗ tick " << ticks << ": PC gate=" << computer.get_pc()
+                      << " isa=" << sim.get_pc() << "\n";
+            ++failures;
+        }
+    }
+
+    // The header names the ISA by key, so a copied ISA_Def still matches it
+    {
+        const ISA_Def copy = *get_isa("3bit_v1");
+        ISA_Simulator copied(copy);
+        ISA_Simulator other(*get_isa("4bit_v1"));
+        std::ostringstream errors;
+        bool other_loaded = false;
+        {
+            Console::Scope quiet(errors);
+            other_loaded = other.load_mc_file(mc_file);
+        }
+        const bool keyed = copied.load_mc_file(mc_file) && !other_loaded;
+        std::cout << (keyed ? "✓ " : "✗ ") << "copied ISA_Def loads the file, 4bit_v1 rejects it\n";
+        failures += !keyed;
+    }
+
+    // Throughput of the predecoded dispatch loop (restarts after HALT)
+    sim.reset();
+    uint64_t executed = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (executed < speed_instructions)
+    {
+        executed += sim.run(speed_instructions - executed);
+        if (sim.is_halted())
+            sim.reset();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << executed << " instructions in " << seconds << " s ("
+              << (seconds > 0 ? executed / seconds / 1e6 : 0.0) << " M instructions/s)\n";
+
+    std::cout << "\nISA Simulator Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Differential test of ISA_Simulator against the gate-level computer
+ * 
+ * Loads the same program into a Computer_3bit_v1 and an ISA_Simulator built
+ * from the 3bit_v1 entry of isa_registry, steps both one instruction per
+ * tick and compares PC, halt state and every RAM address. Then times
+ * ISA_Simulator::run() on its own and prints instructions per second.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param max_ticks Stop the comparison after this many ticks if the program has not halted
+ * @param speed_instructions Instructions to execute for the throughput measurement
+ */
+void test_isa_simulator(const std::string& mc_file, uint64_t max_ticks = 2000,
+                        uint64_t speed_instructions = 50000000);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 class Main_Memory;
@@ -14,3 +15,16 @@ class Main_Memory;
  * @param input_str Input specification string
  */
 void main_memory_tester(Main_Memory& mm, const std::string& input_str);
+
+/**
+ * @brief Random-stimulus equivalence test of the Main_Memory engines
+ * 
+ * Drives a Main_Memory built with Engine::CROSS_CHECK (gate-level and
+ * word-level side by side) with random addresses, data and enables for
+ * num_cycles evaluations, then fails if any cycle reported a mismatch.
+ * 
+ * @param address_bits Address width of the memory under test
+ * @param data_bits Data width of the memory under test
+ * @param num_cycles Number of random evaluate() calls
+ */
+void test_main_memory_engines(uint16_t address_bits, uint16_t data_bits, uint64_t num_cycles = 1000);
@@ -0,0 +1,356 @@
+#include "netlist_tests.hpp"
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../utilities/netlist.hpp"
+#include "../utilities/console.hpp"
+#include "../utilities/lane_simulator.hpp"
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+void test_netlist(const std::string& mc_file, uint64_t max_ticks, bool print_all)
+{
+    std::cout << "\n=== Testing compiled netlist evaluation (" << mc_file << ") ===\n";
+
+    Computer_3bit_v1 tree_computer;
+    Computer_3bit_v1 netlist_computer;
+    if (!tree_computer.load_program(mc_file) || !netlist_computer.load_program(mc_file))
+    {
+        std::cout << "✗ could not load " << mc_file << "\n";
+        return;
+    }
+    tree_computer.prepare_run();
+    netlist_computer.prepare_run();
+    netlist_computer.set_compiled_evaluation(true);
+    netlist_computer.compile_netlist();
+    const Netlist& netlist = *netlist_computer.get_netlist();
+    netlist.print_summary("Computer_3bit_v1");
+
+    uint64_t ticks = 0;
+    int failures = 0;
+
+    // The PM and RAM write paths are guarded on WE (each RAM register again
+    // on its write select), so evaluate() skips them while nothing is written.
+    // Nested guards lie inside an outer one and are not counted twice.
+    uint32_t guarded_ops = 0;
+    uint32_t covered_end = 0;
+    for (const Netlist::Guard& guard : netlist.get_guards())
+    {
+        if (guard.first_op < covered_end)
+            continue;
+        guarded_ops += guard.end_op - guard.first_op;
+        covered_end = guard.end_op;
+    }
+    const bool pm_guarded = guarded_ops * 2 > netlist.get_num_ops();
+    std::cout << (pm_guarded ? "✓ " : "✗ ") << guarded_ops << " of " << netlist.get_num_ops()
+              << " ops skipped while PM and RAM WE are low (" << netlist.get_guards().size() << " guards)\n";
+    if (!pm_guarded) ++failures;
+    while (ticks < max_ticks && failures == 0)
+    {
+        bool tree_running = tree_computer.clock_tick();
+        bool netlist_running = netlist_computer.clock_tick();
+        tree_computer.sync_pc();
+        netlist_computer.sync_pc();
+        ++ticks;
+
+        bool pass = (tree_running == netlist_running) &&
+                    (tree_computer.get_pc() == netlist_computer.get_pc());
+        for (uint16_t addr = 0; addr < tree_computer.get_num_ram_addresses(); ++addr)
+        {
+            if (tree_computer.read_ram(addr) != netlist_computer.read_ram(addr))
+            {
+                pass = false;
+                if (print_all || failures == 0)
+                    std::cout << "  RAM[" << addr << "]: tree=" << tree_computer.read_ram(addr)
+                              << " netlist=" << netlist_computer.read_ram(addr) << "\n";
+            }
+        }
+        if (print_all || !pass)
+        {
+            std::cout << (pass ? "✓ " : "✗ ") << "tick " << ticks
+                      << ": PC tree=" << tree_computer.get_pc()
+                      << " netlist=" << netlist_computer.get_pc() << "\n";
+        }
+        if (!pass) ++failures;
+        if (!tree_running) break;
+    }
+
+    std::cout << "\nNetlist Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_lane_simulator(const std::vector<std::string>& mc_files, uint64_t max_ticks)
+{
+    std::cout << "\n=== Testing 64-lane bit-parallel simulation ===\n";
+    if (mc_files.empty())
+        return;
+
+    Computer_3bit_v1 host;
+    Lane_Simulator lanes(&host);
+    if (!lanes.is_valid())
+    {
+        std::cout << "✗ host could not be compiled for lane simulation\n";
+        return;
+    }
+
+    // One reference computer per lane, each lane running a different program
+    std::vector<Computer_3bit_v1*> references;
+    for (uint16_t lane = 0; lane < Lane_Simulator::NUM_LANES; ++lane)
+    {
+        const std::string& file = mc_files[lane % mc_files.size()];
+        Computer_3bit_v1* reference = new Computer_3bit_v1();
+        reference->load_program(file);
+        reference->prepare_run();
+        references.push_back(reference);
+        lanes.load_program(lane, file);
+    }
+
+    uint64_t ticks = 0;
+    int failures = 0;
+    while (ticks < max_ticks && lanes.get_running_mask() != 0 && failures == 0)
+    {
+        lanes.step();
+        ++ticks;
+        for (uint16_t lane = 0; lane < Lane_Simulator::NUM_LANES; ++lane)
+        {
+            Computer_3bit_v1* reference = references[lane];
+            if (reference->get_is_running())
+            {
+                reference->clock_tick();
+                reference->sync_pc();
+            }
+            bool pass = (reference->get_is_running() == lanes.is_running(lane)) &&
+                        (reference->get_pc() == lanes.get_pc(lane));
+            for (uint16_t addr = 0; addr < reference->get_num_ram_addresses(); ++addr)
+            {
+                if (reference->read_ram(addr) != lanes.read_ram(lane, addr))
+                    pass = false;
+            }
+            if (!pass)
+            {
+                std::cout << "✗ tick " << ticks << " lane " << lane
+                          << ": PC reference=" << reference->get_pc()
+                          << " lane=" << lanes.get_pc(lane) << "\n";
+                ++failures;
+            }
+        }
+    }
+
+    for (Computer_3bit_v1* reference : references)
+        delete reference;
+
+    std::cout << "\nLane Simulator Test Summary: " << ticks << " ticks x "
+              << Lane_Simulator::NUM_LANES << " lanes, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_event_driven(const std::string& mc_file, uint64_t max_ticks, bool print_all)
+{
+    std::cout << "\n=== Testing event-driven netlist evaluation (" << mc_file << ") ===\n";
+
+    Computer_3bit_v1 tree_computer;
+    Computer_3bit_v1 event_computer;
+    if (!tree_computer.load_program(mc_file) || !event_computer.load_program(mc_file))
+    {
+        std::cout << "✗ could not load " << mc_file << "\n";
+        return;
+    }
+    tree_computer.prepare_run();
+    event_computer.prepare_run();
+    event_computer.set_event_driven_evaluation(true);
+    event_computer.compile_netlist();
+    const Netlist* netlist = event_computer.get_netlist();
+
+    uint64_t ticks = 0;
+    int failures = 0;
+    double total_activity = 0.0;
+    uint64_t total_ops = 0;
+    while (ticks < max_ticks && failures == 0)
+    {
+        bool tree_running = tree_computer.clock_tick();
+        bool event_running = event_computer.clock_tick();
+        tree_computer.sync_pc();
+        event_computer.sync_pc();
+        ++ticks;
+        total_activity += event_computer.get_activity_factor();
+        total_ops += netlist->get_last_activity().ops_evaluated;
+
+        bool pass = (tree_running == event_running) &&
+                    (tree_computer.get_pc() == event_computer.get_pc());
+        for (uint16_t addr = 0; addr < tree_computer.get_num_ram_addresses(); ++addr)
+        {
+            if (tree_computer.read_ram(addr) != event_computer.read_ram(addr))
+            {
+                pass = false;
+                if (print_all || failures == 0)
+                    std::cout << "  RAM[" << addr << "]: tree=" << tree_computer.read_ram(addr)
+                              << " event=" << event_computer.read_ram(addr) << "\n";
+            }
+        }
+        if (print_all || !pass)
+        {
+            std::cout << (pass ? "✓ " : "✗ ") << "tick " << ticks
+                      << ": PC tree=" << tree_computer.get_pc()
+                      << " event=" << event_computer.get_pc()
+                      << "  ops=" << netlist->get_last_activity().ops_evaluated
+                      << " toggled=" << netlist->get_last_activity().nets_changed << "\n";
+        }
+        if (!pass) ++failures;
+        if (!tree_running) break;
+    }
+
+    std::cout << "\nAverage activity factor: " << std::fixed << std::setprecision(4)
+              << (ticks ? total_activity / ticks : 0.0)
+              << ", ops evaluated per tick: "
+              << (ticks ? static_cast<double>(total_ops) / ticks : 0.0)
+              << " of " << netlist->get_num_ops() << std::defaultfloat << "\n";
+    std::cout << "Event-Driven Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_connectivity(const std::string& mc_file, uint64_t max_ticks)
+{
+    std::cout << "\n=== Testing connectivity verification (" << mc_file << ") ===\n";
+
+    int failures = 0;
+
+    // Before prepare_run() the PM data inputs are still unconnected
+    {
+        std::ostringstream log;
+        Console::Scope quiet(log);
+        Computer_3bit_v1 unwired("unwired");
+        Netlist netlist;
+        unwired.compile(netlist);
+        const std::vector<Netlist::Dangling_Input>& dangling = netlist.get_dangling_inputs();
+        uint16_t num_data_inputs = static_cast<uint16_t>(4 * unwired.get_num_bits());
+        bool names_ok = dangling.size() == num_data_inputs;
+        for (const Netlist::Dangling_Input& input : dangling)
+            names_ok = names_ok && Netlist::hierarchical_name(input.path) == "unwired/pm_3bit_v1";
+        if (!names_ok)
+        {
+            std::cout << "✗ unwired computer: expected " << num_data_inputs
+                      << " dangling PM data inputs, got " << dangling.size() << "\n";
+            for (const Netlist::Dangling_Input& input : dangling)
+                std::cout << "    " << Netlist::hierarchical_name(input.path) << " input[" << input.input_index << "]\n";
+            ++failures;
+        }
+        else
+        {
+            std::cout << "✓ unwired computer reports " << dangling.size() << " inputs at unwired/pm_3bit_v1\n";
+        }
+    }
+
+    // A verified gate must go back to the checked path once an input is detached
+    AND_Gate gate(2, "probe");
+    Signal_Generator high;
+    high.go_high();
+    gate.connect_input(high.get_outputs(), 0);
+    gate.connect_input(high.get_outputs(), 1);
+    {
+        Netlist netlist;
+        gate.compile(netlist);
+    }
+    gate.evaluate();
+    bool verified_ok = gate.get_inputs_verified() && gate.get_output(0);
+    gate.connect_input(nullptr, 1);
+    std::ostringstream gate_errors;
+    std::streambuf* console_err = std::cerr.rdbuf(gate_errors.rdbuf());
+    gate.evaluate();
+    std::cerr.rdbuf(console_err);
+    if (!verified_ok || gate.get_inputs_verified() || gate.get_output(0) || gate_errors.str().empty())
+    {
+        std::cout << "✗ AND_Gate verified flag not set or not cleared on disconnect\n";
+        ++failures;
+    }
+    else
+    {
+        std::cout << "✓ disconnecting an input clears the verified flag\n";
+    }
+
+    // Fully wired machine: nothing dangling, tree evaluation runs unchecked gates
+    Computer_3bit_v1 tree_computer;
+    Computer_3bit_v1 netlist_computer;
+    std::ostringstream load_log;
+    bool loaded;
+    {
+        Console::Scope quiet(load_log);
+        loaded = tree_computer.load_program(mc_file) && netlist_computer.load_program(mc_file);
+    }
+    if (!loaded)
+    {
+        std::cout << "✗ could not load " << mc_file << "\n";
+        return;
+    }
+    tree_computer.prepare_run();
+    netlist_computer.prepare_run();
+    netlist_computer.set_compiled_evaluation(true);
+    std::ostringstream verify_log;
+    bool verified;
+    {
+        Console::Scope quiet(verify_log);
+        verified = tree_computer.verify_connections();
+    }
+    if (!verified)
+    {
+        std::cout << "✗ wired computer has unconnected inputs:\n" << verify_log.str();
+        ++failures;
+    }
+
+    // The check walks every owned component, not just what compile() reaches
+    // (the RAM read decoders and read selects compile to a MUX instead)
+    uint32_t num_components = 0;
+    uint32_t num_unverified = 0;
+    std::function<void(Component&)> count_unverified = [&](Component& component)
+    {
+        ++num_components;
+        num_unverified += component.get_inputs_verified() ? 0 : 1;
+        component.for_each_child(count_unverified);
+    };
+    count_unverified(tree_computer);
+    if (num_unverified != 0)
+    {
+        std::cout << "✗ " << num_unverified << " of " << num_components << " components not verified\n";
+        ++failures;
+    }
+    else
+    {
+        std::cout << "✓ all " << num_components << " components verified, RAM read decoders included\n";
+    }
+
+    uint64_t ticks = 0;
+    while (ticks < max_ticks && failures == 0)
+    {
+        bool tree_running = tree_computer.clock_tick();
+        bool netlist_running = netlist_computer.clock_tick();
+        tree_computer.sync_pc();
+        netlist_computer.sync_pc();
+        ++ticks;
+        bool pass = tree_running == netlist_running && tree_computer.get_pc() == netlist_computer.get_pc();
+        for (uint16_t addr = 0; addr < tree_computer.get_num_ram_addresses(); ++addr)
+            pass = pass && tree_computer.read_ram(addr) == netlist_computer.read_ram(addr);
+        if (!pass)
+        {
+            std::cout << "✗ tick " << ticks << ": unchecked tree evaluation diverged from the netlist\n";
+            ++failures;
+        }
+        if (!tree_running)
+            break;
+    }
+    if (failures == 0)
+        std::cout << "✓ " << ticks << " ticks with unchecked gates match compiled evaluation\n";
+
+    std::cout << "\nConnectivity Test Summary: " << ticks << " ticks, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
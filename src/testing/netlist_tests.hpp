@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Differential test of compiled (netlist) evaluation against the component tree
+ * 
+ * Loads the same program into two Computer_3bit_v1 instances, runs one with
+ * Computer::set_compiled_evaluation(true), and after every tick compares the
+ * PC, run/halt state and every RAM address.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param max_ticks Stop after this many ticks if the program has not halted
+ * @param print_all If true, prints every tick; if false, prints only failures
+ */
+void test_netlist(const std::string& mc_file, uint64_t max_ticks = 2000, bool print_all = false);
+
+/**
+ * @brief Differential test of the 64-lane Lane_Simulator against the component tree
+ * 
+ * Loads each program into its own lane (cycling through mc_files to fill all
+ * 64 lanes) and into a separate Computer_3bit_v1, then steps everything
+ * together and compares PC, run/halt state and RAM of every lane per tick.
+ * 
+ * @param mc_files Programs to run (.mc machine code)
+ * @param max_ticks Stop after this many ticks if lanes are still running
+ */
+void test_lane_simulator(const std::vector<std::string>& mc_files, uint64_t max_ticks = 500);
+
+/**
+ * @brief Differential test of event-driven netlist evaluation against the component tree
+ * 
+ * Same comparison as test_netlist(), with the second computer running
+ * Computer::set_event_driven_evaluation(true). Also prints the average
+ * activity factor (nets toggled per tick) and the fraction of ops evaluated.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param max_ticks Stop after this many ticks if the program has not halted
+ * @param print_all If true, prints every tick with its activity; if false, prints only failures
+ */
+void test_event_driven(const std::string& mc_file, uint64_t max_ticks = 2000, bool print_all = false);
+
+/**
+ * @brief Test the connectivity check run by Netlist::Scope / Computer::verify_connections
+ * 
+ * Checks that a freshly constructed Computer_3bit_v1 (PM data inputs not yet
+ * tied off) reports exactly those inputs by hierarchical name, that after
+ * prepare_run() nothing is reported and every owned component is verified
+ * (including the RAM read decoders), and that a gate marked verified drops
+ * back to the checked evaluate() when an input is disconnected. Then runs
+ * `mc_file` in tree mode (unchecked gates) against compiled evaluation.
+ * 
+ * @param mc_file Program to run (.mc machine code)
+ * @param max_ticks Stop after this many ticks if the program has not halted
+ */
+void test_connectivity(const std::string& mc_file, uint64_t max_ticks = 500);
@@ -2,6 +2,7 @@
 #include "../parts/Program_Memory.hpp"
 #include "../components/Signal_Generator.hpp"
 #include <iostream>
+#include <random>
 #include <sstream>
 #include <vector>
 
@@ -100,3 +101,213 @@ void program_memory_tester(Program_Memory& pm, const std::string& input_str)
     
     std::cout << "\n\n";
 }
+
+void test_program_memory_rom_fetch(uint16_t decoder_bits, uint16_t data_bits, uint64_t num_cycles)
+{
+    std::cout << "\n=== Testing Program_Memory ROM fetch (" << decoder_bits << "-bit address, "
+              << data_bits << "-bit fields) ===\n";
+
+    Program_Memory rom_pm(decoder_bits, data_bits, "rom_fetch");
+    Program_Memory gate_pm(decoder_bits, data_bits, "gate_level");
+    gate_pm.set_rom_fetch_enabled(false);
+
+    std::vector<Signal_Generator> sig_gens(rom_pm.get_num_inputs());
+    for (uint16_t i = 0; i < rom_pm.get_num_inputs(); ++i)
+    {
+        sig_gens[i].connect_output(&rom_pm, 0, i);
+        sig_gens[i].connect_output(&gate_pm, 0, i);
+    }
+
+    std::mt19937 rng(54321);
+    const uint16_t we_index = static_cast<uint16_t>(decoder_bits + 4 * data_bits);
+    int failures = 0;
+    for (uint64_t cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        for (uint16_t i = 0; i < rom_pm.get_num_inputs(); ++i)
+        {
+            bool high;
+            if (i == we_index)          high = (rng() % 8 == 0);
+            else if (i == we_index + 1) high = (rng() % 8 != 0);
+            else                        high = (rng() & 1);
+            if (high) sig_gens[i].go_high();
+            else      sig_gens[i].go_low();
+            sig_gens[i].evaluate();
+        }
+        rom_pm.evaluate();
+        gate_pm.evaluate();
+
+        bool pass = rom_pm.get_selected_address() == gate_pm.get_selected_address();
+        for (uint16_t bit = 0; bit < rom_pm.get_num_outputs(); ++bit)
+        {
+            if (rom_pm.get_output(bit) != gate_pm.get_output(bit))
+                pass = false;
+        }
+        if (!pass)
+        {
+            std::cout << "✗ cycle " << cycle << ": address rom=" << rom_pm.get_selected_address()
+                      << " gate=" << gate_pm.get_selected_address() << "\n";
+            ++failures;
+        }
+    }
+
+    std::cout << "\nProgram_Memory ROM Fetch Test Summary: " << num_cycles << " cycles, ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
+
+void test_sparse_program_memory(uint16_t decoder_bits, uint16_t data_bits, uint16_t wide_bits,
+                                uint64_t num_cycles)
+{
+    std::cout << "\n=== Testing sparse Program_Memory (" << decoder_bits << "-bit vs gate-level, "
+              << wide_bits << "-bit sparse, " << data_bits << "-bit fields) ===\n";
+    int failures = 0;
+
+    // Random stimulus against the gate-level engine
+    {
+        Program_Memory sparse_pm(decoder_bits, data_bits, "sparse", Program_Memory::Engine::SPARSE);
+        Program_Memory gate_pm(decoder_bits, data_bits, "gate_level");
+        gate_pm.set_rom_fetch_enabled(false);
+
+        std::vector<Signal_Generator> sig_gens(sparse_pm.get_num_inputs());
+        for (uint16_t i = 0; i < sparse_pm.get_num_inputs(); ++i)
+        {
+            sig_gens[i].connect_output(&sparse_pm, 0, i);
+            sig_gens[i].connect_output(&gate_pm, 0, i);
+        }
+
+        std::mt19937 rng(24680);
+        const uint16_t we_index = static_cast<uint16_t>(decoder_bits + 4 * data_bits);
+        int mismatches = 0;
+        for (uint64_t cycle = 0; cycle < num_cycles; ++cycle)
+        {
+            for (uint16_t i = 0; i < sparse_pm.get_num_inputs(); ++i)
+            {
+                bool high;
+                if (i == we_index)          high = (rng() % 8 == 0);
+                else if (i == we_index + 1) high = (rng() % 8 != 0);
+                else                        high = (rng() & 1);
+                if (high) sig_gens[i].go_high();
+                else      sig_gens[i].go_low();
+                sig_gens[i].evaluate();
+            }
+            sparse_pm.evaluate();
+            gate_pm.evaluate();
+
+            bool pass = sparse_pm.get_selected_address() == gate_pm.get_selected_address();
+            for (uint16_t bit = 0; bit < sparse_pm.get_num_outputs(); ++bit)
+            {
+                if (sparse_pm.get_output(bit) != gate_pm.get_output(bit))
+                    pass = false;
+            }
+            if (!pass)
+            {
+                if (mismatches < 5)
+                    std::cout << "✗ cycle " << cycle << ": address sparse=" << sparse_pm.get_selected_address()
+                              << " gate=" << gate_pm.get_selected_address() << "\n";
+                ++mismatches;
+            }
+        }
+        std::cout << (mismatches == 0 ? "✓" : "✗") << " " << num_cycles
+                  << " random cycles match the gate-level engine\n";
+        failures += mismatches;
+    }
+
+    // Wide address space: only written pages exist
+    {
+        Program_Memory wide_pm(wide_bits, data_bits, "wide", Program_Memory::Engine::SPARSE);
+        const uint32_t top = wide_pm.get_num_addresses() - 1;
+        const uint16_t mask = static_cast<uint16_t>((1u << data_bits) - 1);
+        const uint32_t addresses[3] = { 0, top / 2 + 3, top };
+
+        std::vector<Signal_Generator> sig_gens(wide_pm.get_num_inputs());
+        for (uint16_t i = 0; i < wide_pm.get_num_inputs(); ++i)
+            sig_gens[i].connect_output(&wide_pm, 0, i);
+        auto set_signal = [&](uint16_t index, bool high) {
+            if (high) sig_gens[index].go_high();
+            else      sig_gens[index].go_low();
+            sig_gens[index].evaluate();
+        };
+        auto drive = [&](uint32_t address, const uint16_t fields[4], bool we) {
+            for (uint16_t i = 0; i < wide_bits; ++i)
+                set_signal(i, (address >> i) & 1);
+            for (uint16_t reg = 0; reg < 4; ++reg)
+            {
+                for (uint16_t bit = 0; bit < data_bits; ++bit)
+                    set_signal(static_cast<uint16_t>(wide_bits + reg * data_bits + bit), (fields[reg] >> bit) & 1);
+            }
+            set_signal(static_cast<uint16_t>(wide_bits + 4 * data_bits), we);
+            set_signal(static_cast<uint16_t>(wide_bits + 4 * data_bits + 1), true);
+            wide_pm.evaluate();
+        };
+        auto bus_value = [&](uint16_t reg) {
+            uint16_t value = 0;
+            for (uint16_t bit = 0; bit < data_bits; ++bit)
+                value |= static_cast<uint16_t>(wide_pm.get_output(reg * data_bits + bit)) << bit;
+            return value;
+        };
+
+        // First address written directly, the others with a WE pulse
+        wide_pm.set_instruction(addresses[0], 1, 2, 3, 4);
+        for (int i = 1; i < 3; ++i)
+        {
+            const uint16_t fields[4] = { static_cast<uint16_t>(i), static_cast<uint16_t>(i + 1),
+                                         static_cast<uint16_t>(i + 2), static_cast<uint16_t>(i + 3) };
+            drive(addresses[i], fields, true);
+        }
+        // An all-zero write is a HALT and must not allocate a page
+        const uint16_t zeros[4] = {};
+        drive(top / 4, zeros, true);
+
+        bool reads_back = true;
+        for (int i = 0; i < 3; ++i)
+        {
+            drive(addresses[i], zeros, false);
+            const uint16_t base = static_cast<uint16_t>(i == 0 ? 1 : i);
+            for (uint16_t reg = 0; reg < 4; ++reg)
+            {
+                if (bus_value(reg) != ((base + reg) & mask))
+                    reads_back = false;
+            }
+            uint16_t opcode, a, b, c;
+            wide_pm.get_instruction(addresses[i], opcode, a, b, c);
+            if (wide_pm.get_selected_address() != addresses[i] || opcode != bus_value(0) || c != bus_value(3))
+                reads_back = false;
+        }
+        std::cout << (reads_back ? "✓" : "✗") << " written addresses read back (bus and get_instruction)\n";
+
+        bool unwritten_zero = true;
+        const uint32_t unwritten[3] = { 1, top / 2 + 2, top / 4 };  // same page, and a page never written
+        for (uint32_t address : unwritten)
+        {
+            drive(address, zeros, false);
+            uint16_t opcode, a, b, c;
+            wide_pm.get_instruction(address, opcode, a, b, c);
+            for (uint16_t reg = 0; reg < 4; ++reg)
+            {
+                if (bus_value(reg) != 0)
+                    unwritten_zero = false;
+            }
+            if (opcode || a || b || c)
+                unwritten_zero = false;
+        }
+        std::cout << (unwritten_zero ? "✓" : "✗") << " unwritten addresses read as HALT\n";
+
+        const bool pages_ok = wide_pm.get_num_pages() == 3;
+        std::cout << (pages_ok ? "✓" : "✗") << " " << wide_pm.get_num_pages() << " pages for a 2^"
+                  << wide_bits << "-address memory (expected 3)\n";
+
+        wide_pm.zero_all();
+        const bool cleared = wide_pm.get_num_pages() == 0;
+        std::cout << (cleared ? "✓" : "✗") << " zero_all() frees every page\n";
+
+        failures += !reads_back + !unwritten_zero + !pages_ok + !cleared;
+    }
+
+    std::cout << "\nSparse Program_Memory Test Summary: ";
+    if (failures == 0)
+        std::cout << "✓ ALL PASS\n";
+    else
+        std::cout << "✗ " << failures << " FAILURES\n";
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 class Program_Memory;
@@ -14,3 +15,35 @@ class Program_Memory;
  * @param input_str Input specification string
  */
 void program_memory_tester(Program_Memory& pm, const std::string& input_str);
+
+/**
+ * @brief Random-stimulus test of Program_Memory ROM fetch mode
+ * 
+ * Drives two Program_Memory instances with the same random addresses, data
+ * and enables (WE high on roughly one cycle in eight): one with ROM fetch
+ * enabled, one forced through the gate-level path. Compares the outputs and
+ * get_selected_address() after every evaluate().
+ * 
+ * @param decoder_bits Address width of the memories under test
+ * @param data_bits Field width of the memories under test
+ * @param num_cycles Number of random evaluate() calls
+ */
+void test_program_memory_rom_fetch(uint16_t decoder_bits, uint16_t data_bits, uint64_t num_cycles = 1000);
+
+/**
+ * @brief Test of the SPARSE Program_Memory engine
+ * 
+ * Drives a SPARSE and a GATE_LEVEL Program_Memory with the same random
+ * stimulus (as test_program_memory_rom_fetch) and compares outputs and
+ * get_selected_address(). Then builds a SPARSE memory with `wide_bits`
+ * address bits, writes a few far-apart addresses (directly and with WE
+ * pulses) and checks that they read back, that unwritten and never-paged
+ * addresses read as 0 (HALT), and that only the written pages exist.
+ * 
+ * @param decoder_bits Address width for the gate-level comparison
+ * @param data_bits Field width of the memories under test
+ * @param wide_bits Address width of the large sparse memory
+ * @param num_cycles Number of random evaluate() calls
+ */
+void test_sparse_program_memory(uint16_t decoder_bits, uint16_t data_bits, uint16_t wide_bits = 24,
+                                uint64_t num_cycles = 1000);
@@ -0,0 +1,202 @@
+#include "batch_runner.hpp"
+#include "console.hpp"
+#include "isa_simulator.hpp"
+#include "../computers/Computer_3bit_v1.hpp"
+#include "../computers/Computer_Generic.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+Batch_Runner::Batch_Runner(uint64_t max_cycles_, Mode mode_)
+    : max_cycles(max_cycles_), mode(mode_)
+{
+}
+
+// ── Running ───────────────────────────────────────────────────────────────────
+
+/// Computer for a lower-cased .mc header ISA key (no header = 3bit_v1), or nullptr.
+static Computer* create_computer(const std::string& isa_key, const std::string& mc_file)
+{
+    if (isa_key.empty() || isa_key == "3bit_v1")
+        return new Computer_3bit_v1("batch");
+    if (const ISA_Def* isa = get_isa(isa_key))
+        return new Computer_Generic(*isa, "batch");
+
+    Console::err() << "Error: Batch_Runner - unknown ISA '" << isa_key << "' in " << mc_file << std::endl;
+    return nullptr;
+}
+
+Batch_Runner::Result Batch_Runner::run(const std::string& mc_file) const
+{
+    if (mode == Mode::ISA)
+        return run_isa(mc_file);
+
+    Result result;
+    result.file = mc_file;
+
+    // The constructor and load_program() print a banner and the whole
+    // listing; keep both out of batch output
+    std::string isa_key;
+    std::vector<ISA_Simulator::Instruction> image;
+    if (!ISA_Simulator::read_mc_file(mc_file, isa_key, image))
+        return result;
+    std::transform(isa_key.begin(), isa_key.end(), isa_key.begin(),
+                   [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
+    std::ostringstream listing;
+    Computer* computer = nullptr;
+    {
+        Console::Scope quiet(listing, Console::err());
+        computer = create_computer(isa_key, mc_file);
+        result.loaded = computer && computer->load_program(mc_file);
+    }
+    if (!result.loaded)
+    {
+        delete computer;
+        return result;
+    }
+
+    computer->prepare_run();
+    if (mode != Mode::TREE)
+    {
+        // Build the netlist up front so compile time is not counted as run time
+        computer->set_compiled_evaluation(true);
+        computer->set_event_driven_evaluation(mode == Mode::EVENT_DRIVEN);
+        computer->compile_netlist();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    result.cycles = computer->run_headless(max_cycles);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    computer->sync_pc();
+    result.halted = !computer->get_is_running();
+    result.final_pc = computer->get_pc();
+    result.num_bits = computer->get_num_bits();
+    result.ram.resize(computer->get_num_ram_addresses());
+    for (size_t address = 0; address < result.ram.size(); ++address)
+        result.ram[address] = computer->read_ram(static_cast<uint16_t>(address));
+
+    delete computer;
+    return result;
+}
+
+Batch_Runner::Result Batch_Runner::run_isa(const std::string& mc_file) const
+{
+    Result result;
+    result.file = mc_file;
+
+    std::string isa_key;
+    std::vector<ISA_Simulator::Instruction> image;
+    if (!ISA_Simulator::read_mc_file(mc_file, isa_key, image))
+        return result;
+    std::transform(isa_key.begin(), isa_key.end(), isa_key.begin(),
+                   [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
+    const ISA_Def* isa = get_isa(isa_key.empty() ? "3bit_v1" : isa_key);
+    if (!isa)
+    {
+        Console::err() << "Error: Batch_Runner - unknown ISA '" << isa_key << "' in " << mc_file << std::endl;
+        return result;
+    }
+    ISA_Simulator sim(*isa);
+    result.loaded = sim.load_program(image);
+    if (!result.loaded)
+        return result;
+
+    auto start = std::chrono::steady_clock::now();
+    result.cycles = sim.run(max_cycles);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    result.halted = sim.is_halted();
+    result.final_pc = sim.get_pc();
+    result.num_bits = isa->num_bits;
+    result.ram = sim.get_ram();
+    return result;
+}
+
+std::vector<Batch_Runner::Result> Batch_Runner::run_all(const std::vector<std::string>& mc_files) const
+{
+    std::vector<Result> results;
+    results.reserve(mc_files.size());
+    for (const std::string& file : mc_files)
+        results.push_back(run(file));
+    return results;
+}
+
+bool Batch_Runner::parse_mode(const std::string& text, Mode& mode)
+{
+    if (text == "tree")          mode = Mode::TREE;
+    else if (text == "compiled") mode = Mode::COMPILED;
+    else if (text == "event")    mode = Mode::EVENT_DRIVEN;
+    else if (text == "isa")      mode = Mode::ISA;
+    else return false;
+    return true;
+}
+
+// ── Output ────────────────────────────────────────────────────────────────────
+
+bool Batch_Runner::write_ram_binary(Result& result, const std::string& path)
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        Console::err() << "Error: Batch_Runner - could not open " << path << std::endl;
+        return false;
+    }
+    for (uint16_t word : result.ram)
+    {
+        out.put(static_cast<char>(word & 0xFF));
+        if (result.num_bits > 8)
+            out.put(static_cast<char>(word >> 8));
+    }
+    result.ram_file = path;
+    return static_cast<bool>(out);
+}
+
+static std::string json_string(const std::string& text)
+{
+    std::string quoted = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void Batch_Runner::write_json(std::ostream& out, const std::vector<Result>& results, Ram_Format ram_format)
+{
+    out << "{\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& r = results[i];
+        const double ticks_per_second = r.seconds > 0 ? r.cycles / r.seconds : 0.0;
+        out << "    {\"file\": " << json_string(r.file)
+            << ", \"loaded\": " << (r.loaded ? "true" : "false");
+        if (r.loaded)
+        {
+            out << ", \"halted\": " << (r.halted ? "true" : "false")
+                << ", \"cycles\": " << r.cycles
+                << ", \"seconds\": " << std::setprecision(6) << r.seconds
+                << ", \"ticks_per_second\": " << ticks_per_second
+                << ", \"final_pc\": " << r.final_pc;
+            if (ram_format == Ram_Format::JSON)
+            {
+                out << ", \"ram\": [";
+                for (size_t address = 0; address < r.ram.size(); ++address)
+                    out << (address ? "," : "") << r.ram[address];
+                out << "]";
+            }
+            else if (ram_format == Ram_Format::BINARY && !r.ram_file.empty())
+            {
+                out << ", \"ram_file\": " << json_string(r.ram_file);
+            }
+        }
+        out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
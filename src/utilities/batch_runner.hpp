@@ -0,0 +1,85 @@
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs .mc programs without any per-tick output and collects results.
+ *
+ * Every program gets a fresh computer for the ISA named in its .mc header
+ * (Computer_3bit_v1 for 3bit_v1 or no header, Computer_Generic for any other
+ * registered ISA), is loaded with the listing suppressed, and runs via
+ * Computer::run_headless() until HALT or the cycle budget. Mode::ISA instead
+ * runs the program on an ISA_Simulator for the same ISA, one instruction per
+ * cycle. The result records
+ * cycles, wall time, final PC and a copy of RAM. Results can be written as
+ * one JSON document; RAM can instead be dumped to a raw binary file per
+ * program.
+ *
+ * Usage:
+ *   Batch_Runner runner(100000, Batch_Runner::Mode::EVENT_DRIVEN);
+ *   std::vector<Batch_Runner::Result> results = runner.run_all(files);
+ *   Batch_Runner::write_json(std::cout, results, Batch_Runner::Ram_Format::JSON);
+ */
+class Batch_Runner
+{
+public:
+    enum class Mode
+    {
+        TREE,           ///< walk the component tree (reference)
+        COMPILED,       ///< full pass over the compiled netlist
+        EVENT_DRIVEN,   ///< compiled netlist, only changed fan-out
+        ISA             ///< instruction-level ISA_Simulator, no gates
+    };
+
+    enum class Ram_Format
+    {
+        NONE,           ///< no RAM in the report
+        JSON,           ///< RAM words inline in the JSON report
+        BINARY          ///< RAM written to Result::ram_file, path in the report
+    };
+
+    struct Result
+    {
+        std::string           file;
+        bool                  loaded = false;
+        bool                  halted = false;   ///< false if the cycle budget ran out
+        uint64_t              cycles = 0;
+        double                seconds = 0.0;    ///< wall time of the run (load excluded)
+        uint32_t              final_pc = 0;
+        uint16_t              num_bits = 0;     ///< RAM word width
+        std::vector<uint16_t> ram;              ///< RAM contents after the run
+        std::string           ram_file;         ///< binary RAM dump, if written
+    };
+
+    /**
+     * @param max_cycles Stop a program after this many ticks if it has not halted
+     * @param mode Evaluation mode used for every program
+     */
+    explicit Batch_Runner(uint64_t max_cycles = 1000000, Mode mode = Mode::TREE);
+
+    /** @brief Load and run one program. */
+    Result run(const std::string& mc_file) const;
+
+    /** @brief Run each program in turn. */
+    std::vector<Result> run_all(const std::vector<std::string>& mc_files) const;
+
+    /**
+     * @brief Write RAM as raw words, address order: one byte per word when
+     *        num_bits <= 8, otherwise two bytes little-endian. Sets ram_file.
+     */
+    static bool write_ram_binary(Result& result, const std::string& path);
+
+    /** @brief Write all results as one JSON document. */
+    static void write_json(std::ostream& out, const std::vector<Result>& results, Ram_Format ram_format);
+
+    /** @brief Parse "tree", "compiled", "event" or "isa"; false if unknown. */
+    static bool parse_mode(const std::string& text, Mode& mode);
+
+private:
+    Result run_isa(const std::string& mc_file) const;
+
+    uint64_t max_cycles;
+    Mode     mode;
+};
@@ -0,0 +1,32 @@
+#include "console.hpp"
+#include <iostream>
+
+static thread_local std::ostream* current_out = nullptr;
+static thread_local std::ostream* current_err = nullptr;
+
+Console::Scope::Scope(std::ostream& out) : Scope(out, out)
+{
+}
+
+Console::Scope::Scope(std::ostream& out, std::ostream& err)
+    : previous_out(current_out), previous_err(current_err)
+{
+    current_out = &out;
+    current_err = &err;
+}
+
+Console::Scope::~Scope()
+{
+    current_out = previous_out;
+    current_err = previous_err;
+}
+
+std::ostream& Console::out()
+{
+    return current_out ? *current_out : std::cout;
+}
+
+std::ostream& Console::err()
+{
+    return current_err ? *current_err : std::cerr;
+}
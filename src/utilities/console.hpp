@@ -0,0 +1,51 @@
+#pragma once
+#include <iosfwd>
+
+/**
+ * @brief Per-thread destination for simulator console output.
+ *
+ * Computer and Evaluator print listings, banners, step results and errors
+ * through Console::out() / Console::err() rather than std::cout / std::cerr,
+ * and components, memories and the Profiler report wiring errors and
+ * warnings through Console::err().
+ * By default these are std::cout and std::cerr. A Scope redirects them for
+ * the current thread only, so several evaluations running on different
+ * threads can each buffer their own output (std::cout.rdbuf() swapping is
+ * process-wide and cannot do that).
+ *
+ * Usage:
+ *   std::ostringstream log;
+ *   {
+ *       Console::Scope scope(log);   // out() and err() both go to log
+ *       evaluator.evaluate("pong.mc");
+ *   }
+ */
+class Console
+{
+public:
+    /**
+     * @brief Redirects this thread's console output for its lifetime.
+     * Scopes nest; the previous streams are restored on destruction.
+     */
+    class Scope
+    {
+    public:
+        /** @brief Send both out() and err() to `out`. */
+        explicit Scope(std::ostream& out);
+        Scope(std::ostream& out, std::ostream& err);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::ostream* previous_out;
+        std::ostream* previous_err;
+    };
+
+    /** @brief This thread's normal output (std::cout unless redirected). */
+    static std::ostream& out();
+
+    /** @brief This thread's error output (std::cerr unless redirected). */
+    static std::ostream& err();
+};
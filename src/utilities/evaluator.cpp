@@ -1,6 +1,10 @@
 #include "evaluator.hpp"
+#include "console.hpp"
 #include "isa_registry.hpp"
+#include "isa_simulator.hpp"
+#include "lane_simulator.hpp"
 #include "../computers/Computer_3bit_v1.hpp"
+#include "../computers/Computer_Generic.hpp"
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -25,8 +29,10 @@ static Computer* create_computer(const std::string& isa_key)
 {
     if (isa_key == "3bit_v1")
         return new Computer_3bit_v1("eval_computer");
+    if (const ISA_Def* isa = get_isa(isa_key))
+        return new Computer_Generic(*isa, "eval_computer");
 
-    std::cerr << "[evaluator] unsupported ISA: " << isa_key << "\n";
+    Console::err() << "[evaluator] unsupported ISA: " << isa_key << "\n";
     return nullptr;
 }
 
@@ -40,7 +46,7 @@ bool Evaluator::parse_mc_file(const std::string& path,
     std::ifstream f(path);
     if (!f.is_open())
     {
-        std::cerr << "[evaluator] cannot open: " << path << "\n";
+        Console::err() << "[evaluator] cannot open: " << path << "\n";
         return false;
     }
 
@@ -126,7 +132,7 @@ bool Evaluator::parse_mc_file(const std::string& path,
 
     if (isa_key_out.empty())
     {
-        std::cerr << "[evaluator] no '# isa:' header found in " << path << "\n";
+        Console::err() << "[evaluator] no '# isa:' header found in " << path << "\n";
         return false;
     }
 
@@ -135,110 +141,24 @@ bool Evaluator::parse_mc_file(const std::string& path,
 
 // ── Software simulation ───────────────────────────────────────────────────────
 
-/**
- * Simulate one instruction against the given SimState (ISA 3bit_v1) and
- * populate `changed` with every RAM address that was modified.
- *
- * Architecture constants for 3bit_v1:
- *   num_bits = 3, page unit = 8, mask = 0x7
- *   RAM is flat 64-entry array: full_addr = page * 8 + addr
- */
-void Evaluator::sim_step(const MCInstruction& instr,
-                          const std::string& isa_key,
-                          SimState& state,
+bool Evaluator::load_simulator(ISA_Simulator& sim, const std::vector<MCInstruction>& instrs) const
+{
+    std::vector<ISA_Simulator::Instruction> image;
+    image.reserve(instrs.size());
+    for (const MCInstruction& mi : instrs)
+        image.push_back({ mi.opcode, mi.a, mi.b, mi.c });
+    return sim.load_program(image);
+}
+
+void Evaluator::sim_step(ISA_Simulator& sim,
                           std::vector<uint16_t>& changed,
                           uint16_t& new_pc) const
 {
     changed.clear();
-
-    // Currently only 3bit_v1 is implemented
-    const uint16_t MASK = 0x7u; // 3-bit mask
-
-    if (isa_key == "3bit_v1")
-    {
-        const uint16_t opc = instr.opcode;
-        const uint16_t a   = instr.a;
-        const uint16_t b   = instr.b;
-        const uint16_t c   = instr.c;
-
-        new_pc = static_cast<uint16_t>((state.pc + 1) & 0x1FFu); // default: PC+1
-
-        switch (opc)
-        {
-            case 0b000: // HALT
-                state.is_halted = true;
-                // Hardware: the halt signal gates the PC incrementer to 0, so
-                // PC resets to 0 after the HALT cycle.
-                new_pc = 0;
-                break;
-
-            case 0b001: // MOVL  A → [B:C]  (literal a into RAM page b, addr c)
-            {
-                uint16_t addr = static_cast<uint16_t>((b << 3) | c);
-                state.ram[addr] = a & MASK;
-                changed.push_back(addr);
-                break;
-            }
-
-            case 0b010: // ADD   [0:A] + [0:B] → [0:C]
-            {
-                uint16_t result = static_cast<uint16_t>((state.ram[a] + state.ram[b]) & MASK);
-                state.ram[c] = result;
-                changed.push_back(c);
-                break;
-            }
-
-            case 0b011: // SUB   [0:A] - [0:B] → [0:C]
-            {
-                uint16_t result = static_cast<uint16_t>((state.ram[a] - state.ram[b] + 8u) & MASK);
-                state.ram[c] = result;
-                changed.push_back(c);
-                break;
-            }
-
-            case 0b100: // CMP   flags ← [0:A] vs [B:C]
-            {
-                uint16_t addr2 = static_cast<uint16_t>((b << 3) | c);
-                uint16_t val1  = state.ram[a];
-                uint16_t val2  = state.ram[addr2];
-                state.eq_flag   = (val1 == val2);
-                state.gt_u_flag = (val1 >  val2);
-                // no RAM change
-                break;
-            }
-
-            case 0b101: // JEQ   if EQ: PC ← A:B:C
-                if (state.eq_flag)
-                    new_pc = static_cast<uint16_t>((a << 6) | (b << 3) | c);
-                break;
-
-            case 0b110: // JGT   if GT: PC ← A:B:C
-                if (state.gt_u_flag)
-                    new_pc = static_cast<uint16_t>((a << 6) | (b << 3) | c);
-                break;
-
-            case 0b111: // MOVOUT [rampage:A] → [B:C]
-            {
-                uint16_t src  = static_cast<uint16_t>((state.rampage << 3) | a);
-                uint16_t dest = static_cast<uint16_t>((b << 3) | c);
-                state.ram[dest] = state.ram[src];
-                changed.push_back(dest);
-                break;
-            }
-
-            default:
-                std::cerr << "[evaluator] unknown opcode: " << opc << "\n";
-                break;
-        }
-    }
-    else
-    {
-        // Unknown ISA — produce no changes
-        new_pc = static_cast<uint16_t>(state.pc + 1);
-        std::cerr << "[evaluator] sim_step: unimplemented ISA '" << isa_key << "'\n";
-    }
-
-    state.pc = new_pc;
+    sim.step();
+    if (sim.get_last_write() != ISA_Simulator::NO_WRITE)
+        changed.push_back(static_cast<uint16_t>(sim.get_last_write()));
+    new_pc = sim.get_pc();
 }
 
 // ── Main evaluate() entry point ───────────────────────────────────────────────
@@ -261,11 +181,11 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
     const ISA_Def* isa = get_isa(isa_key);
     if (!isa)
     {
-        std::cerr << "[evaluator] unknown ISA: " << isa_key << "\n";
+        Console::err() << "[evaluator] unknown ISA: " << isa_key << "\n";
         return false;
     }
 
-    std::cout << "\n"
+    Console::out() << "\n"
               << std::string(60, '=') << "\n"
               << "Evaluating: " << filename << " (" << isa->display_name << ")\n"
               << std::string(60, '=') << "\n";
@@ -288,31 +208,32 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
     }
 
     // ── Initialize software simulator state ───────────────────────────────────
-    SimState sim;
-    sim.pc      = 0;
-    sim.rampage = 0;
-    const uint16_t num_ram_addrs = static_cast<uint16_t>(1u << isa->num_ram_addr_bits);
-    sim.ram.assign(static_cast<size_t>(num_ram_addrs), 0u);
+    ISA_Simulator sim(*isa);
+    if (!load_simulator(sim, instructions))
+    {
+        delete computer;
+        return false;
+    }
 
     // Sync computer PC (make sure PM decoder reflects PC=0)
     computer->sync_pc();
 
     // ── Step-by-step execution and verification ───────────────────────────────
-    std::cout << "\n";
+    Console::out() << "\n";
 
     int cycle = 0;
     bool all_ok = true;
     // Safety: allow many cycles (programs with loops will execute multiple times)
     int max_cycles = std::max(1000, static_cast<int>(instructions.size()) * 100);
 
-    while (!sim.is_halted && cycle < max_cycles)
+    while (!sim.is_halted() && cycle < max_cycles)
     {
-        uint16_t expected_pc = sim.pc;
+        uint16_t expected_pc = sim.get_pc();
 
         // Bounds check: PC must point into the loaded instruction list
         if (expected_pc >= static_cast<uint16_t>(instructions.size()))
         {
-            std::cerr << "[evaluator] PC=" << expected_pc
+            Console::err() << "[evaluator] PC=" << expected_pc
                       << " exceeds program length (" << instructions.size()
                       << " instructions); stopping.\n";
             all_ok = false;
@@ -329,7 +250,7 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
         // Run the software simulation for this instruction
         std::vector<uint16_t> changed_addrs;
         uint16_t next_pc = 0;
-        sim_step(instr, isa_key, sim, changed_addrs, next_pc);
+        sim_step(sim, changed_addrs, next_pc);
 
         // Execute one hardware clock cycle
         computer->clock_tick();
@@ -365,7 +286,7 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
         uint16_t num_addrs = static_cast<uint16_t>(1u << isa->num_ram_addr_bits);
         for (uint16_t addr = 0; addr < num_addrs; ++addr)
         {
-            uint16_t expected_val = sim.ram[addr];
+            uint16_t expected_val = sim.read_ram(addr);
             uint16_t actual_val   = computer->read_ram(addr);
             if (actual_val != expected_val)
             {
@@ -390,7 +311,7 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
             ++summary_.passed;
             if (verbose)
             {
-                std::cout << "[PASS] "
+                Console::out() << "[PASS] "
                           << std::setw(3) << cycle << " (PC=" << std::setw(3) << expected_pc << ")"
                           << " | " << mnemonic
                           << " " << instr.a
@@ -398,16 +319,16 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
                           << " " << instr.c;
                 if (!changed_addrs.empty())
                 {
-                    std::cout << " | ";
+                    Console::out() << " | ";
                     for (uint16_t addr : changed_addrs)
-                        std::cout << "RAM[" << addr << "]=" << sim.ram[addr] << " ";
+                        Console::out() << "RAM[" << addr << "]=" << sim.read_ram(addr) << " ";
                 }
                 else if (instr.opcode == 0b100) // CMP
                 {
-                    std::cout << " | EQ=" << sim.eq_flag
-                              << " GT=" << sim.gt_u_flag;
+                    Console::out() << " | EQ=" << sim.get_eq_flag()
+                              << " GT=" << sim.get_gt_flag();
                 }
-                std::cout << "\n";
+                Console::out() << "\n";
             }
         }
         else
@@ -423,12 +344,12 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
             for (const auto& f : step_failures)
                 summary_.failures.push_back(f);
 
-            std::cout << "[FAIL] "
+            Console::out() << "[FAIL] "
                       << std::setw(3) << cycle << " (PC=" << std::setw(3) << expected_pc << ")"
                       << " | " << mnemonic
                       << " " << instr.a << " " << instr.b << " " << instr.c << "\n";
             for (const auto& f : step_failures)
-                std::cout << f << "\n";
+                Console::out() << f << "\n";
         }
 
         ++cycle;
@@ -436,22 +357,464 @@ bool Evaluator::evaluate(const std::string& mc_file, bool verbose)
     }
 
     // ── Summary ───────────────────────────────────────────────────────────────
-    std::cout << "\n" << std::string(60, '-') << "\n";
-    std::cout << "Result: " << summary_.passed << "/" << summary_.total
+    Console::out() << "\n" << std::string(60, '-') << "\n";
+    Console::out() << "Result: " << summary_.passed << "/" << summary_.total
               << " steps passed";
     if (summary_.failed > 0)
-        std::cout << ", " << summary_.failed << " FAILED";
-    std::cout << "\n";
+        Console::out() << ", " << summary_.failed << " FAILED";
+    Console::out() << "\n";
+
+    if (!summary_.failures.empty())
+    {
+        Console::out() << "\nFailures:\n";
+        for (const auto& f : summary_.failures)
+            Console::out() << "  " << f << "\n";
+    }
+
+    Console::out() << std::string(60, '=') << "\n\n";
+
+    delete computer;
+    return all_ok;
+}
+
+// ── Checkpointed evaluation ───────────────────────────────────────────────────
+
+/// RAM word flipped on the hardware at the end of one step (Evaluator::inject_fault).
+struct Fault
+{
+    uint64_t step;
+    uint16_t ram_address;
+};
+
+/**
+ * Advance both models by up to `cycles` ticks from step `first_step`,
+ * stopping after the HALT. A fault at a step in the range is applied after
+ * that step's tick.
+ */
+static uint64_t advance(Computer& computer, ISA_Simulator& sim, uint64_t first_step, uint64_t cycles,
+                        const Fault* fault)
+{
+    uint64_t ticks = 0;
+    while (ticks < cycles && !sim.is_halted())
+    {
+        sim.step();
+        if (computer.get_is_running())
+            computer.clock_tick();
+        if (fault && fault->step == first_step + ticks)
+            computer.write_ram(fault->ram_address, computer.read_ram(fault->ram_address) ^ 1);
+        ++ticks;
+    }
+    return ticks;
+}
+
+void Evaluator::inject_fault(uint64_t step, uint16_t ram_address)
+{
+    fault_step = step;
+    fault_address = ram_address;
+}
+
+/// Compare the hardware against the reference by state hash only.
+static bool states_match(Computer& computer, const ISA_Simulator& sim,
+                         std::vector<uint16_t>& ram_scratch)
+{
+    computer.sync_pc();
+    for (uint16_t addr = 0; addr < ram_scratch.size(); ++addr)
+        ram_scratch[addr] = computer.read_ram(addr);
+    const bool* flags = computer.get_cmp_flags();   // [EQ, NEQ, LT_U, GT_U, ...]
+    uint64_t hardware = ISA_Simulator::hash_state(computer.get_pc(), !computer.get_is_running(),
+                                                  flags && flags[0], flags && flags[3],
+                                                  ram_scratch.data(), ram_scratch.size());
+    return hardware == sim.state_hash();
+}
+
+bool Evaluator::evaluate_checkpointed(const std::string& mc_file,
+                                      uint32_t check_interval,
+                                      uint64_t max_cycles)
+{
+    summary_ = Summary{};
+
+    std::string isa_key, filename;
+    std::vector<MCInstruction> instructions;
+    if (!parse_mc_file(mc_file, isa_key, filename, instructions))
+        return false;
+    std::transform(isa_key.begin(), isa_key.end(), isa_key.begin(),
+                   [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
+
+    const ISA_Def* isa = get_isa(isa_key);
+    if (!isa)
+    {
+        Console::err() << "[evaluator] unknown ISA: " << isa_key << "\n";
+        return false;
+    }
+    if (check_interval == 0)
+        check_interval = 1;
+    if (max_cycles == 0)
+        max_cycles = static_cast<uint64_t>(std::max(1000, static_cast<int>(instructions.size()) * 100));
+
+    Console::out() << "\n"
+              << std::string(60, '=') << "\n"
+              << "Evaluating: " << filename << " (" << isa->display_name << ")"
+              << ", hash check every " << check_interval << " cycles\n"
+              << std::string(60, '=') << "\n";
+
+    Computer* computer = create_computer(isa_key);
+    if (!computer)
+        return false;
+    ISA_Simulator sim(*isa);
+    if (!computer->load_program(mc_file) || !load_simulator(sim, instructions))
+    {
+        delete computer;
+        return false;
+    }
+    computer->sync_pc();
+    const Fault fault_at = { fault_step, fault_address };
+    const Fault* fault = (fault_step != NO_FAULT) ? &fault_at : nullptr;
+
+    // ── Run in intervals, checkpoint both models after every matching check ──
+    std::vector<uint16_t> ram_scratch(computer->get_num_ram_addresses());
+    Computer::Checkpoint good_computer;
+    ISA_Simulator::State good_sim;
+    computer->save_checkpoint(good_computer);
+    sim.save_state(good_sim);
+
+    uint64_t cycle = 0;
+    uint64_t good_cycle = 0;
+    uint64_t checks = 0;
+    uint64_t bisection_steps = 0;
+    bool diverged = false;
+
+    while (!sim.is_halted() && cycle < max_cycles)
+    {
+        cycle += advance(*computer, sim, cycle, std::min<uint64_t>(check_interval, max_cycles - cycle), fault);
+        ++checks;
+        if (states_match(*computer, sim, ram_scratch))
+        {
+            computer->save_checkpoint(good_computer);
+            sim.save_state(good_sim);
+            good_cycle = cycle;
+            continue;
+        }
+
+        // ── Bisect (good_cycle, cycle] down to the first diverging tick ───────
+        uint64_t bad_cycle = cycle;
+        while (bad_cycle - good_cycle > 1)
+        {
+            uint64_t mid = good_cycle + (bad_cycle - good_cycle) / 2;
+            computer->restore_checkpoint(good_computer);
+            sim.restore_state(good_sim);
+            advance(*computer, sim, good_cycle, mid - good_cycle, fault);
+            ++bisection_steps;
+            if (states_match(*computer, sim, ram_scratch))
+            {
+                computer->save_checkpoint(good_computer);
+                sim.save_state(good_sim);
+                good_cycle = mid;
+            }
+            else
+            {
+                bad_cycle = mid;
+            }
+        }
+        computer->restore_checkpoint(good_computer);
+        sim.restore_state(good_sim);
+        computer->sync_pc();
+        diverged = true;
+        break;
+    }
+
+    summary_.passed = static_cast<int>(good_cycle);
+    summary_.total  = static_cast<int>(diverged ? good_cycle + 1 : cycle);
+
+    // ── Replay the diverging instruction with a full comparison ──────────────
+    if (diverged)
+    {
+        const uint16_t pc = sim.get_pc();
+        const MCInstruction instr = (pc < instructions.size()) ? instructions[pc] : MCInstruction{};
+        std::string mnemonic = "???";
+        for (const auto& op : isa->opcodes)
+            if (op.opcode == instr.opcode)
+                mnemonic = op.name;
+
+        advance(*computer, sim, good_cycle, 1, fault);
+        computer->sync_pc();
+
+        std::vector<std::string> step_failures;
+        if (computer->get_pc() != sim.get_pc())
+        {
+            std::ostringstream oss;
+            oss << "  PC mismatch after tick:  expected=" << sim.get_pc()
+                << " actual=" << computer->get_pc();
+            step_failures.push_back(oss.str());
+        }
+        if (computer->get_is_running() == sim.is_halted())
+        {
+            std::ostringstream oss;
+            oss << "  Halt mismatch: expected=" << sim.is_halted()
+                << " actual=" << !computer->get_is_running();
+            step_failures.push_back(oss.str());
+        }
+        const bool* flags = computer->get_cmp_flags();
+        const bool eq = flags && flags[0];
+        const bool gt = flags && flags[3];
+        if (eq != sim.get_eq_flag() || gt != sim.get_gt_flag())
+        {
+            std::ostringstream oss;
+            oss << "  Flag mismatch: expected EQ=" << sim.get_eq_flag() << " GT=" << sim.get_gt_flag()
+                << " actual EQ=" << eq << " GT=" << gt;
+            step_failures.push_back(oss.str());
+        }
+        for (uint16_t addr = 0; addr < computer->get_num_ram_addresses(); ++addr)
+        {
+            uint16_t expected_val = sim.read_ram(addr);
+            uint16_t actual_val   = computer->read_ram(addr);
+            if (actual_val != expected_val)
+            {
+                std::ostringstream oss;
+                oss << "  RAM[" << std::setw(2) << addr << "] "
+                    << "(page " << (addr >> isa->num_bits)
+                    << " addr " << (addr &  ((1u << isa->num_bits) - 1)) << ")"
+                    << ": expected=" << expected_val
+                    << " actual=" << actual_val;
+                step_failures.push_back(oss.str());
+            }
+        }
+
+        ++summary_.failed;
+        std::ostringstream fail_hdr;
+        fail_hdr << "Step " << good_cycle << " (PC=" << pc << ")"
+                 << " " << mnemonic
+                 << " " << instr.a << " " << instr.b << " " << instr.c
+                 << ": first divergence";
+        summary_.failures.push_back(fail_hdr.str());
+        for (const auto& f : step_failures)
+            summary_.failures.push_back(f);
+    }
+
+    // ── Summary ───────────────────────────────────────────────────────────────
+    Console::out() << "\n" << std::string(60, '-') << "\n";
+    Console::out() << "Result: " << summary_.passed << "/" << summary_.total
+              << " steps passed (" << checks << " hash checks, "
+              << bisection_steps << " bisection steps)";
+    if (summary_.failed > 0)
+        Console::out() << ", first divergence at step " << good_cycle;
+    else if (!sim.is_halted())
+        Console::out() << ", stopped at the " << max_cycles << "-cycle budget";
+    Console::out() << "\n";
 
     if (!summary_.failures.empty())
     {
-        std::cout << "\nFailures:\n";
+        Console::out() << "\nFailures:\n";
         for (const auto& f : summary_.failures)
-            std::cout << "  " << f << "\n";
+            Console::out() << "  " << f << "\n";
     }
 
-    std::cout << std::string(60, '=') << "\n\n";
+    Console::out() << std::string(60, '=') << "\n\n";
 
     delete computer;
+    return !diverged;
+}
+
+// ── Bit-parallel batch evaluation ─────────────────────────────────────────────
+
+bool Evaluator::evaluate_batch(const std::vector<std::string>& mc_files, bool verbose)
+{
+    summary_ = Summary{};
+    bool all_ok = true;
+
+    // Per-lane bookkeeping (one program per lane)
+    struct Lane
+    {
+        std::string                file;
+        std::vector<MCInstruction> instructions;
+        ISA_Simulator*             sim        = nullptr;
+        int                        cycle      = 0;
+        int                        max_cycles = 0;
+        bool                       done       = false;
+        bool                       ok         = true;
+    };
+
+    std::string batch_isa_key;
+    const ISA_Def* isa = nullptr;
+
+    for (size_t first = 0; first < mc_files.size(); first += Lane_Simulator::NUM_LANES)
+    {
+        size_t count = std::min<size_t>(Lane_Simulator::NUM_LANES, mc_files.size() - first);
+        std::vector<Lane> lanes(count);
+        Computer* host = nullptr;
+        Lane_Simulator* simulator = nullptr;
+        uint64_t active = 0;
+
+        // ── Parse and load every lane ─────────────────────────────────────────
+        for (uint16_t lane = 0; lane < count; ++lane)
+        {
+            Lane& l = lanes[lane];
+            l.file = mc_files[first + lane];
+            l.done = true;
+
+            std::string isa_key, filename;
+            if (!parse_mc_file(l.file, isa_key, filename, l.instructions))
+            {
+                summary_.failures.push_back(l.file + ": could not parse");
+                all_ok = false;
+                continue;
+            }
+            std::transform(isa_key.begin(), isa_key.end(), isa_key.begin(),
+                           [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
+            if (batch_isa_key.empty())
+            {
+                batch_isa_key = isa_key;
+                isa = get_isa(isa_key);
+            }
+            if (!isa || isa_key != batch_isa_key)
+            {
+                summary_.failures.push_back(l.file + ": ISA '" + isa_key + "' differs from batch ISA '" + batch_isa_key + "'");
+                all_ok = false;
+                continue;
+            }
+
+            if (!simulator)
+            {
+                host = create_computer(isa_key);
+                if (!host)
+                    return false;
+                simulator = new Lane_Simulator(host);
+                if (!simulator->is_valid())
+                {
+                    delete simulator;
+                    delete host;
+                    return false;
+                }
+            }
+            if (!simulator->load_program(lane, l.file))
+            {
+                summary_.failures.push_back(l.file + ": could not load");
+                all_ok = false;
+                continue;
+            }
+
+            l.sim = new ISA_Simulator(*isa);
+            if (!load_simulator(*l.sim, l.instructions))
+            {
+                summary_.failures.push_back(l.file + ": could not predecode");
+                all_ok = false;
+                continue;
+            }
+            l.max_cycles  = std::max(1000, static_cast<int>(l.instructions.size()) * 100);
+            l.done        = false;
+            active |= uint64_t(1) << lane;
+        }
+
+        // ── Step all lanes together, verify each against its own simulation ──
+        std::vector<uint16_t> expected_pcs(count), next_pcs(count);
+        std::vector<std::vector<uint16_t>> changed(count);
+        const uint16_t num_addrs = isa ? static_cast<uint16_t>(1u << isa->num_ram_addr_bits) : 0;
+
+        while (active != 0)
+        {
+            for (uint16_t lane = 0; lane < count; ++lane)
+            {
+                Lane& l = lanes[lane];
+                if (l.done) continue;
+                expected_pcs[lane] = l.sim->get_pc();
+                if (expected_pcs[lane] >= l.instructions.size())
+                {
+                    std::ostringstream oss;
+                    oss << l.file << ": PC=" << expected_pcs[lane] << " exceeds program length ("
+                        << l.instructions.size() << " instructions)";
+                    summary_.failures.push_back(oss.str());
+                    l.ok = false;
+                    l.done = true;
+                    active &= ~(uint64_t(1) << lane);
+                    continue;
+                }
+                if (simulator->get_pc(lane) != expected_pcs[lane])
+                {
+                    std::ostringstream oss;
+                    oss << "  PC mismatch before tick: expected=" << expected_pcs[lane]
+                        << " actual=" << simulator->get_pc(lane);
+                    changed[lane].clear();
+                    l.ok = false;
+                    summary_.failures.push_back(l.file + ": step " + std::to_string(l.cycle));
+                    summary_.failures.push_back(oss.str());
+                }
+                sim_step(*l.sim, changed[lane], next_pcs[lane]);
+            }
+
+            simulator->step(active);
+
+            for (uint16_t lane = 0; lane < count; ++lane)
+            {
+                Lane& l = lanes[lane];
+                if (l.done) continue;
+
+                std::vector<std::string> step_failures;
+                if (simulator->get_pc(lane) != next_pcs[lane])
+                {
+                    std::ostringstream oss;
+                    oss << "  PC mismatch after tick:  expected=" << next_pcs[lane]
+                        << " actual=" << simulator->get_pc(lane);
+                    step_failures.push_back(oss.str());
+                }
+                for (uint16_t addr = 0; addr < num_addrs; ++addr)
+                {
+                    uint16_t actual_val = simulator->read_ram(lane, addr);
+                    if (actual_val != l.sim->read_ram(addr))
+                    {
+                        std::ostringstream oss;
+                        oss << "  RAM[" << std::setw(2) << addr << "]: expected=" << l.sim->read_ram(addr)
+                            << " actual=" << actual_val;
+                        step_failures.push_back(oss.str());
+                    }
+                }
+
+                if (step_failures.empty())
+                {
+                    ++summary_.passed;
+                    if (verbose)
+                        Console::out() << "[PASS] " << l.file << " step " << l.cycle
+                                  << " (PC=" << expected_pcs[lane] << ")\n";
+                }
+                else
+                {
+                    ++summary_.failed;
+                    l.ok = false;
+                    summary_.failures.push_back(l.file + ": step " + std::to_string(l.cycle) +
+                                                " (PC=" + std::to_string(expected_pcs[lane]) + ")");
+                    for (const auto& f : step_failures)
+                        summary_.failures.push_back(f);
+                    Console::out() << "[FAIL] " << l.file << " step " << l.cycle
+                              << " (PC=" << expected_pcs[lane] << ")\n";
+                    for (const auto& f : step_failures)
+                        Console::out() << f << "\n";
+                }
+
+                ++l.cycle;
+                ++summary_.total;
+                if (l.sim->is_halted() || l.cycle >= l.max_cycles)
+                {
+                    l.done = true;
+                    active &= ~(uint64_t(1) << lane);
+                }
+            }
+        }
+
+        for (const Lane& l : lanes)
+        {
+            if (!l.ok) all_ok = false;
+            Console::out() << (l.ok ? "[PASS] " : "[FAIL] ") << l.file << " (" << l.cycle << " steps)\n";
+            delete l.sim;
+        }
+
+        delete simulator;
+        delete host;
+    }
+
+    Console::out() << "\n" << std::string(60, '-') << "\n";
+    Console::out() << "Batch result: " << summary_.passed << "/" << summary_.total
+              << " steps passed over " << mc_files.size() << " programs";
+    if (summary_.failed > 0)
+        Console::out() << ", " << summary_.failed << " FAILED";
+    Console::out() << "\n" << std::string(60, '=') << "\n\n";
+
     return all_ok;
 }
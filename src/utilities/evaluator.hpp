@@ -4,20 +4,25 @@
 #include <map>
 #include <cstdint>
 
+class ISA_Simulator;
+
 /**
  * @brief Instantiates a computer from a .mc file, runs the program
  *        step-by-step, and verifies correctness against a software simulation.
  *
- * The evaluator performs a parallel software simulation of the program.  After
- * each clock tick it compares the actual hardware-level RAM and PC against the
- * expected state produced by the software simulation.  Any mismatch is flagged
- * as a FAIL.
+ * The evaluator performs a parallel software simulation of the program on an
+ * ISA_Simulator (the instruction-level reference model built from the ISA's
+ * entry in isa_registry).  After each clock tick it compares the actual
+ * hardware-level RAM and PC against the expected state produced by the
+ * software simulation.  Any mismatch is flagged as a FAIL.
  *
  * Machine code file header requirements:
  *   # isa: <isa_key>        — selects the computer architecture
  *   # filename: <name>      — used for display purposes
  *
- * Supported ISAs: 3bit_v1
+ * Supported ISAs: every isa_registry key (case-insensitive). 3bit_v1 builds
+ * Computer_3bit_v1; the others (4bit_v1, 8bit_v1, ...) build a
+ * Computer_Generic from their ISA_Def.
  */
 class Evaluator
 {
@@ -33,6 +38,44 @@ public:
      */
     bool evaluate(const std::string& mc_file, bool verbose = true);
 
+    /**
+     * @brief Load, run, and evaluate a .mc program, comparing state hashes
+     *        only every `check_interval` cycles.
+     *
+     * Between checks both models run without any per-tick comparison. A
+     * check hashes PC, run/halt, the EQ/GT flags and all of RAM on each side
+     * (ISA_Simulator::hash_state). When the hashes agree, both machines are
+     * checkpointed (Computer::save_checkpoint, ISA_Simulator::save_state).
+     * When they differ, both are restored to the last good checkpoint and
+     * the interval is bisected until the first diverging cycle is found;
+     * that instruction is then replayed with the full per-address report of
+     * evaluate() and the run stops.
+     *
+     * @param mc_file        Path to the .mc machine-code file to evaluate.
+     * @param check_interval Cycles between hash checks (minimum 1).
+     * @param max_cycles     Cycle budget; 0 uses the same default as evaluate().
+     * @return true if the program ran to the end of the budget or HALT
+     *         without a divergence.
+     */
+    bool evaluate_checkpointed(const std::string& mc_file,
+                               uint32_t check_interval = 1024,
+                               uint64_t max_cycles = 0);
+
+    /**
+     * @brief Evaluate many .mc programs, 64 at a time, on a bit-parallel
+     *        Lane_Simulator (one lane per program).
+     *
+     * Every lane is checked against its own software simulation after every
+     * tick, exactly like evaluate(). All programs in one call must use the
+     * same ISA. The summary accumulates over all programs; failure lines are
+     * prefixed with the program's file name.
+     *
+     * @param mc_files Paths to the .mc files.
+     * @param verbose  If true, print every step (not only FAILs).
+     * @return true if every step of every program passed.
+     */
+    bool evaluate_batch(const std::vector<std::string>& mc_files, bool verbose = false);
+
     /** @brief Return the pass/fail summary from the last evaluate() call. */
     struct Summary
     {
@@ -44,8 +87,27 @@ public:
 
     const Summary& summary() const { return summary_; }
 
+protected:
+    // ── Testing interface (test_checkpoints() reaches it through a subclass) ──
+
+    /**
+     * @brief Flip bit 0 of hardware RAM word `ram_address` at the end of step
+     *        `step` (0-based) of evaluate_checkpointed(), every time that
+     *        step runs, so the first divergence is `step`.
+     *
+     * The fault stays set until clear_fault().
+     */
+    void inject_fault(uint64_t step, uint16_t ram_address);
+
+    /** @brief Remove a fault set by inject_fault(). */
+    void clear_fault() { fault_step = NO_FAULT; }
+
 private:
+    static constexpr uint64_t NO_FAULT = UINT64_MAX;
+
     Summary summary_;
+    uint64_t fault_step = NO_FAULT;     ///< see inject_fault()
+    uint16_t fault_address = 0;
 
     // ── Parsed instruction (from .mc file) ────────────────────────────────────
     struct MCInstruction
@@ -56,35 +118,23 @@ private:
         std::string comment; ///< Text after the '#' on that line
     };
 
-    // ── Software simulator state ──────────────────────────────────────────────
-    struct SimState
-    {
-        std::vector<uint16_t> ram;   ///< Full RAM contents (all pages flat)
-        uint16_t              pc;
-        uint16_t              rampage;
-        bool eq_flag   = false;
-        bool gt_u_flag = false;
-        bool is_halted = false;
-    };
-
     bool parse_mc_file(const std::string& path,
                        std::string& isa_key_out,
                        std::string& filename_out,
                        std::vector<MCInstruction>& instrs_out);
 
+    /** @brief Predecode a parsed program into the reference simulator. */
+    bool load_simulator(ISA_Simulator& sim, const std::vector<MCInstruction>& instrs) const;
+
     /**
-     * @brief Simulate one instruction against SimState and record which RAM
-     *        addresses should have changed so the result can be verified.
+     * @brief Execute one instruction on the reference simulator and report
+     *        which RAM addresses it wrote and the PC it leaves.
      *
-     * @param instr     The instruction to simulate.
-     * @param isa_key   ISA identifier (lowercase) for ISA-specific semantics.
-     * @param state     Current simulator state (modified in place).
+     * @param sim       Reference simulator (ISA_Simulator), advanced in place.
      * @param changed   Addresses written to by this instruction.
      * @param new_pc    The PC value the computer should show after the tick.
      */
-    void sim_step(const MCInstruction& instr,
-                  const std::string& isa_key,
-                  SimState& state,
+    void sim_step(ISA_Simulator& sim,
                   std::vector<uint16_t>& changed,
                   uint16_t& new_pc) const;
 
@@ -4,6 +4,21 @@
 
 // ── Internal registry ─────────────────────────────────────────────────────────
 
+// ISA v1 opcode table, shared by every width of the v1 family
+static std::vector<OpDef> isa_v1_opcodes()
+{
+    return {
+        { "HALT",   0b000, false, "Stop execution",                                 Op_Semantics::HALT },
+        { "MOVL",   0b001, false, "Move literal: A -> [B:C]",                       Op_Semantics::MOVE_LITERAL },
+        { "ADD",    0b010, false, "Add:      [A] + [B] -> [C]   (page 0 addresses)", Op_Semantics::ADD },
+        { "SUB",    0b011, false, "Subtract: [A] - [B] -> [C]   (page 0 addresses)", Op_Semantics::SUB },
+        { "CMP",    0b100, false, "Compare:  flags <- [0:A] vs [B:C]",              Op_Semantics::COMPARE },
+        { "JEQ",    0b101, true,  "Jump if equal:   PC <- A:B:C",                   Op_Semantics::JUMP_IF_EQUAL },
+        { "JGT",    0b110, true,  "Jump if greater: PC <- A:B:C",                   Op_Semantics::JUMP_IF_GREATER },
+        { "MOVOUT", 0b111, false, "Move out: [rampage:A] -> [B:C]",                 Op_Semantics::MOVE_PAGED },
+    };
+}
+
 static const std::vector<ISA_Def> s_isas = {
     {
         /* key          */ "3bit_v1",
@@ -11,16 +26,27 @@ static const std::vector<ISA_Def> s_isas = {
         /* num_bits     */ 3,
         /* ram_addr_bits*/ 6,
         /* pc_bits      */ 9,
-        /* opcodes      */ {
-            { "HALT",   0b000, false, "Stop execution" },
-            { "MOVL",   0b001, false, "Move literal: A -> [B:C]" },
-            { "ADD",    0b010, false, "Add:      [A] + [B] -> [C]   (page 0 addresses)" },
-            { "SUB",    0b011, false, "Subtract: [A] - [B] -> [C]   (page 0 addresses)" },
-            { "CMP",    0b100, false, "Compare:  flags <- [0:A] vs [B:C]" },
-            { "JEQ",    0b101, true,  "Jump if equal:   PC <- A:B:C" },
-            { "JGT",    0b110, true,  "Jump if greater: PC <- A:B:C" },
-            { "MOVOUT", 0b111, false, "Move out: [rampage:A] -> [B:C]" },
-        }
+        /* opcodes      */ isa_v1_opcodes()
+    },
+    {
+        // ISA v1 on a 4-bit data path: 16 pages of 16 RAM words, 4096 PM addresses
+        /* key          */ "4bit_v1",
+        /* display_name */ "4-bit v1",
+        /* num_bits     */ 4,
+        /* ram_addr_bits*/ 8,
+        /* pc_bits      */ 12,
+        /* opcodes      */ isa_v1_opcodes()
+    },
+    {
+        // ISA v1 on an 8-bit data path. RAM keeps the low 4 bits of the page
+        // (16 pages of 256 words) and the PC the low 16 bits of A:B:C, the
+        // widest the ISA_Simulator's dense tables hold.
+        /* key          */ "8bit_v1",
+        /* display_name */ "8-bit v1",
+        /* num_bits     */ 8,
+        /* ram_addr_bits*/ 12,
+        /* pc_bits      */ 16,
+        /* opcodes      */ isa_v1_opcodes()
     },
 };
 
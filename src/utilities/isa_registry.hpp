@@ -3,15 +3,35 @@
 #include <vector>
 #include <cstdint>
 
+/**
+ * @brief What an instruction does, independent of its opcode and width.
+ *
+ * Used by ISA_Simulator to execute programs without the gate-level model.
+ * With n = num_bits, [p:x] is RAM address p * 2^n + x and A:B:C is the
+ * PC value (A << 2n) | (B << n) | C. Arithmetic wraps modulo 2^n.
+ */
+enum class Op_Semantics : uint8_t
+{
+    HALT,             ///< stop; PC <- 0
+    MOVE_LITERAL,     ///< [B:C] <- A
+    ADD,              ///< [0:C] <- [0:A] + [0:B]
+    SUB,              ///< [0:C] <- [0:A] - [0:B]
+    COMPARE,          ///< EQ <- [0:A] == [B:C], GT <- [0:A] > [B:C] (unsigned)
+    JUMP_IF_EQUAL,    ///< if EQ: PC <- A:B:C
+    JUMP_IF_GREATER,  ///< if GT: PC <- A:B:C
+    MOVE_PAGED        ///< [B:C] <- [rampage:A]
+};
+
 /**
  * @brief Definition of a single ISA instruction.
  */
 struct OpDef
 {
-    std::string name;         ///< Uppercase mnemonic (e.g. "ADD")
-    uint16_t    opcode;       ///< Numeric opcode value (e.g. 0b010 for ADD)
-    bool        is_jump;      ///< True if operand is a label/address split into A:B:C
-    std::string description;  ///< Human-readable description for .mc header comments
+    std::string  name;         ///< Uppercase mnemonic (e.g. "ADD")
+    uint16_t     opcode;       ///< Numeric opcode value (e.g. 0b010 for ADD)
+    bool         is_jump;      ///< True if operand is a label/address split into A:B:C
+    std::string  description;  ///< Human-readable description for .mc header comments
+    Op_Semantics semantics;    ///< Behaviour, for the functional simulator
 };
 
 /**
@@ -0,0 +1,284 @@
+#include "isa_simulator.hpp"
+#include "console.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+ISA_Simulator::ISA_Simulator(const ISA_Def& isa_)
+    : isa(isa_),
+      data_mask(static_cast<uint16_t>((1u << isa_.num_bits) - 1)),
+      ram_mask(static_cast<uint16_t>((1u << isa_.num_ram_addr_bits) - 1)),
+      pc_mask(static_cast<uint16_t>((1u << isa_.pc_bits) - 1))
+{
+    // Opcodes missing from the table behave as HALT
+    semantics_by_opcode.assign(size_t(1) << isa.num_bits, Op_Semantics::HALT);
+    for (const OpDef& op : isa.opcodes)
+    {
+        if (op.opcode < semantics_by_opcode.size())
+            semantics_by_opcode[op.opcode] = op.semantics;
+    }
+
+    program.assign(size_t(1) << isa.pc_bits, _decode(Instruction{}));
+    ram.assign(size_t(1) << isa.num_ram_addr_bits, 0);
+}
+
+// ── Loading ───────────────────────────────────────────────────────────────────
+
+ISA_Simulator::Decoded_Op ISA_Simulator::_decode(const Instruction& instruction) const
+{
+    const uint16_t n = isa.num_bits;
+    const uint16_t a = instruction.a, b = instruction.b, c = instruction.c;
+    const uint16_t page_address = static_cast<uint16_t>(((b << n) | c) & ram_mask);
+
+    Decoded_Op decoded = { semantics_by_opcode[instruction.opcode], 0, 0, 0 };
+    switch (decoded.op)
+    {
+        case Op_Semantics::HALT:
+            break;
+        case Op_Semantics::MOVE_LITERAL:     // x = destination, y = literal
+            decoded.x = page_address;
+            decoded.y = a;
+            break;
+        case Op_Semantics::ADD:              // x, y = sources, z = destination
+        case Op_Semantics::SUB:
+            decoded.x = a;
+            decoded.y = b;
+            decoded.z = c;
+            break;
+        case Op_Semantics::COMPARE:          // x = left source, y = right source
+            decoded.x = a;
+            decoded.y = page_address;
+            break;
+        case Op_Semantics::JUMP_IF_EQUAL:    // x = target PC
+        case Op_Semantics::JUMP_IF_GREATER:
+            decoded.x = static_cast<uint16_t>(((a << (2 * n)) | (b << n) | c) & pc_mask);
+            break;
+        case Op_Semantics::MOVE_PAGED:       // x = offset in rampage, y = destination
+            decoded.x = a;
+            decoded.y = page_address;
+            break;
+    }
+    return decoded;
+}
+
+bool ISA_Simulator::load_program(const std::vector<Instruction>& image)
+{
+    if (image.size() > program.size())
+    {
+        Console::err() << "Error: ISA_Simulator - program has " << image.size()
+                  << " instructions, PM holds " << program.size() << std::endl;
+        return false;
+    }
+    for (size_t address = 0; address < image.size(); ++address)
+    {
+        const Instruction& instr = image[address];
+        if (instr.opcode > data_mask || instr.a > data_mask || instr.b > data_mask || instr.c > data_mask)
+        {
+            Console::err() << "Error: ISA_Simulator - value out of range at address " << address << std::endl;
+            return false;
+        }
+    }
+
+    const Decoded_Op zero = _decode(Instruction{});
+    for (size_t address = 0; address < program.size(); ++address)
+        program[address] = (address < image.size()) ? _decode(image[address]) : zero;
+    reset();
+    return true;
+}
+
+bool ISA_Simulator::read_mc_file(const std::string& path, std::string& isa_key_out,
+                                 std::vector<Instruction>& program_out)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        Console::err() << "Error: ISA_Simulator - could not open " << path << std::endl;
+        return false;
+    }
+
+    isa_key_out.clear();
+    program_out.clear();
+    std::string line;
+    while (std::getline(file, line))
+    {
+        size_t hash = line.find('#');
+        if (hash != std::string::npos)
+        {
+            // "# isa: 3bit_v1" header
+            std::string comment = line.substr(hash + 1);
+            size_t colon = comment.find(':');
+            if (hash == 0 && colon != std::string::npos)
+            {
+                std::string key = comment.substr(0, colon);
+                key.erase(std::remove_if(key.begin(), key.end(), ::isspace), key.end());
+                std::transform(key.begin(), key.end(), key.begin(),
+                               [](unsigned char ch){ return static_cast<char>(std::tolower(ch)); });
+                if (key == "isa")
+                {
+                    std::istringstream value(comment.substr(colon + 1));
+                    value >> isa_key_out;
+                }
+            }
+            line = line.substr(0, hash);
+        }
+
+        std::istringstream fields(line);
+        std::string field[4];
+        if (!(fields >> field[0] >> field[1] >> field[2] >> field[3]))
+            continue;
+
+        uint16_t value[4] = { 0, 0, 0, 0 };
+        for (int i = 0; i < 4; ++i)
+        {
+            for (char ch : field[i])
+                value[i] = static_cast<uint16_t>((value[i] << 1) | (ch == '1' ? 1 : 0));
+        }
+        program_out.push_back({ value[0], value[1], value[2], value[3] });
+    }
+    return true;
+}
+
+bool ISA_Simulator::load_mc_file(const std::string& path)
+{
+    std::string isa_key;
+    std::vector<Instruction> image;
+    if (!read_mc_file(path, isa_key, image))
+        return false;
+    // Keys, not addresses: the simulator may run a copy of a registry ISA_Def
+    auto lower = [](std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    };
+    if (!isa_key.empty() && lower(isa_key) != lower(isa.key))
+    {
+        Console::err() << "Error: ISA_Simulator - " << path << " is for ISA '" << isa_key
+                  << "', simulator runs '" << isa.key << "'" << std::endl;
+        return false;
+    }
+    return load_program(image);
+}
+
+void ISA_Simulator::reset()
+{
+    std::fill(ram.begin(), ram.end(), 0);
+    pc = 0;
+    rampage = 0;
+    eq_flag = false;
+    gt_flag = false;
+    halted = false;
+    last_write = NO_WRITE;
+    instruction_count = 0;
+}
+
+// ── Execution ─────────────────────────────────────────────────────────────────
+
+inline uint32_t ISA_Simulator::_execute()
+{
+    const Decoded_Op& op = program[pc];
+    uint16_t* memory = ram.data();
+    pc = static_cast<uint16_t>((pc + 1) & pc_mask);
+
+    switch (op.op)
+    {
+        case Op_Semantics::HALT:
+            // The halt signal gates the PC incrementer, so PC reads 0 afterwards
+            halted = true;
+            pc = 0;
+            return NO_WRITE;
+        case Op_Semantics::MOVE_LITERAL:
+            memory[op.x] = op.y;
+            return op.x;
+        case Op_Semantics::ADD:
+            memory[op.z] = static_cast<uint16_t>((memory[op.x] + memory[op.y]) & data_mask);
+            return op.z;
+        case Op_Semantics::SUB:
+            memory[op.z] = static_cast<uint16_t>((memory[op.x] - memory[op.y]) & data_mask);
+            return op.z;
+        case Op_Semantics::COMPARE:
+            eq_flag = memory[op.x] == memory[op.y];
+            gt_flag = memory[op.x] > memory[op.y];
+            return NO_WRITE;
+        case Op_Semantics::JUMP_IF_EQUAL:
+            if (eq_flag)
+                pc = op.x;
+            return NO_WRITE;
+        case Op_Semantics::JUMP_IF_GREATER:
+            if (gt_flag)
+                pc = op.x;
+            return NO_WRITE;
+        case Op_Semantics::MOVE_PAGED:
+        {
+            const uint16_t source = static_cast<uint16_t>(((rampage << isa.num_bits) | op.x) & ram_mask);
+            memory[op.y] = memory[source];
+            return op.y;
+        }
+    }
+    return NO_WRITE;
+}
+
+bool ISA_Simulator::step()
+{
+    last_write = NO_WRITE;
+    if (halted)
+        return false;
+    last_write = _execute();
+    ++instruction_count;
+    return !halted;
+}
+
+uint64_t ISA_Simulator::run(uint64_t max_instructions)
+{
+    uint64_t executed = 0;
+    while (!halted && executed < max_instructions)
+    {
+        _execute();
+        ++executed;
+    }
+    instruction_count += executed;
+    last_write = NO_WRITE;
+    return executed;
+}
+
+// ── Checkpoints ───────────────────────────────────────────────────────────────
+
+void ISA_Simulator::save_state(State& state) const
+{
+    state.pc = pc;
+    state.rampage = rampage;
+    state.eq_flag = eq_flag;
+    state.gt_flag = gt_flag;
+    state.halted = halted;
+    state.instruction_count = instruction_count;
+    state.ram = ram;
+}
+
+void ISA_Simulator::restore_state(const State& state)
+{
+    pc = state.pc;
+    rampage = state.rampage;
+    eq_flag = state.eq_flag;
+    gt_flag = state.gt_flag;
+    halted = state.halted;
+    instruction_count = state.instruction_count;
+    ram = state.ram;
+    last_write = NO_WRITE;
+}
+
+uint64_t ISA_Simulator::hash_state(uint16_t pc, bool halted, bool eq_flag, bool gt_flag,
+                                   const uint16_t* ram, size_t num_words)
+{
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint16_t value)
+    {
+        hash = (hash ^ (value & 0xFF)) * 1099511628211ull;
+        hash = (hash ^ (value >> 8)) * 1099511628211ull;
+    };
+    mix(pc);
+    mix(static_cast<uint16_t>((halted ? 1 : 0) | (eq_flag ? 2 : 0) | (gt_flag ? 4 : 0)));
+    for (size_t address = 0; address < num_words; ++address)
+        mix(ram[address]);
+    return hash;
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include "isa_registry.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Instruction-level functional simulator for any ISA in isa_registry.
+ *
+ * Executes programs from the architectural description alone (ISA_Def and
+ * the Op_Semantics of each opcode), with no gates involved. load_program()
+ * predecodes every PM address once into a compact dispatch table: each entry
+ * holds the operation and its operands already combined into flat RAM
+ * addresses / jump targets, so executing an instruction is one switch and a
+ * couple of array accesses.
+ *
+ * Matches the gate-level computers tick for tick: unloaded PM addresses read
+ * as all-zero instructions, the PC wraps at 2^pc_bits, and HALT resets the
+ * PC to 0. Intended as the fast reference model for the Evaluator, the batch
+ * runner and the GUI.
+ *
+ * Usage:
+ *   ISA_Simulator sim(*get_isa("3bit_v1"));
+ *   sim.load_mc_file("pong.mc");
+ *   sim.run(1000000);
+ *   uint16_t v = sim.read_ram(5);
+ */
+class ISA_Simulator
+{
+public:
+    static constexpr uint32_t NO_WRITE = UINT32_MAX;
+
+    /// One PM row as stored in a .mc file.
+    struct Instruction
+    {
+        uint16_t opcode = 0;
+        uint16_t a = 0;
+        uint16_t b = 0;
+        uint16_t c = 0;
+    };
+
+    /** @param isa Architecture to simulate; must outlive the simulator. */
+    explicit ISA_Simulator(const ISA_Def& isa);
+
+    // ── Loading ───────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Predecode a program (program[i] at PM address i, the rest zero)
+     *        and reset() the machine. Fails if the program is too long or a
+     *        field does not fit in num_bits.
+     */
+    bool load_program(const std::vector<Instruction>& program);
+
+    /** @brief Read a .mc file and load_program() it. Fails on an ISA mismatch. */
+    bool load_mc_file(const std::string& path);
+
+    /**
+     * @brief Parse a .mc file: "# isa: <key>" header and binary instruction lines.
+     * @return false if the file cannot be opened
+     */
+    static bool read_mc_file(const std::string& path, std::string& isa_key_out,
+                             std::vector<Instruction>& program_out);
+
+    /** @brief PC, flags and RAM back to zero; the loaded program is kept. */
+    void reset();
+
+    // ── Execution ─────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Execute one instruction (the HALT itself counts as one).
+     * @return false once halted (also when already halted on entry)
+     */
+    bool step();
+
+    /**
+     * @brief Execute until HALT or `max_instructions`, whichever comes first.
+     * @return Number of instructions executed by this call
+     */
+    uint64_t run(uint64_t max_instructions);
+
+    // ── State ─────────────────────────────────────────────────────────────────
+
+    uint16_t get_pc() const { return pc; }
+    bool     is_halted() const { return halted; }
+    bool     get_eq_flag() const { return eq_flag; }
+    bool     get_gt_flag() const { return gt_flag; }
+    uint16_t get_rampage() const { return rampage; }
+    uint64_t get_instruction_count() const { return instruction_count; }
+
+    /** @brief RAM address written by the last step(), or NO_WRITE. */
+    uint32_t get_last_write() const { return last_write; }
+
+    uint16_t read_ram(uint16_t address) const { return ram[address & ram_mask]; }
+    void     write_ram(uint16_t address, uint16_t value) { ram[address & ram_mask] = value & data_mask; }
+    const std::vector<uint16_t>& get_ram() const { return ram; }
+
+    const ISA_Def& get_isa() const { return isa; }
+
+    // ── Checkpoints ───────────────────────────────────────────────────────────
+
+    /// Everything step() reads or writes besides the (immutable) program.
+    struct State
+    {
+        uint16_t              pc = 0;
+        uint16_t              rampage = 0;
+        bool                  eq_flag = false;
+        bool                  gt_flag = false;
+        bool                  halted = false;
+        uint64_t              instruction_count = 0;
+        std::vector<uint16_t> ram;
+    };
+
+    void save_state(State& state) const;
+
+    /** @brief Restore a save_state() copy; the loaded program is kept. */
+    void restore_state(const State& state);
+
+    /**
+     * @brief 64-bit FNV-1a hash of the architectural state: PC, halt, the
+     *        EQ/GT flags and every RAM word. Equal machines hash equal, so
+     *        two models can be compared without walking RAM side by side.
+     */
+    static uint64_t hash_state(uint16_t pc, bool halted, bool eq_flag, bool gt_flag,
+                               const uint16_t* ram, size_t num_words);
+
+    /** @brief hash_state() of this simulator. */
+    uint64_t state_hash() const
+    {
+        return hash_state(pc, halted, eq_flag, gt_flag, ram.data(), ram.size());
+    }
+
+private:
+    /// Predecoded PM row; operand meaning depends on op (see _decode()).
+    struct Decoded_Op
+    {
+        Op_Semantics op;
+        uint16_t     x;
+        uint16_t     y;
+        uint16_t     z;
+    };
+
+    Decoded_Op _decode(const Instruction& instruction) const;
+
+    /// Execute the op at pc; returns the RAM address written or NO_WRITE.
+    inline uint32_t _execute();
+
+    const ISA_Def&            isa;
+    std::vector<Op_Semantics> semantics_by_opcode;  ///< 2^num_bits entries
+    std::vector<Decoded_Op>   program;              ///< 2^pc_bits entries
+    std::vector<uint16_t>     ram;
+
+    uint16_t data_mask;
+    uint16_t ram_mask;
+    uint16_t pc_mask;
+
+    uint16_t pc = 0;
+    uint16_t rampage = 0;
+    bool     eq_flag = false;
+    bool     gt_flag = false;
+    bool     halted = false;
+    uint32_t last_write = NO_WRITE;
+    uint64_t instruction_count = 0;
+};
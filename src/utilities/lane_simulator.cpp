@@ -0,0 +1,147 @@
+#include "lane_simulator.hpp"
+#include "console.hpp"
+#include "../computers/Computer.hpp"
+#include <iostream>
+
+Lane_Simulator::Lane_Simulator(Computer* host_) : host(host_)
+{
+    // Compile against the run-time wiring (PM address from PC, PM data tied low)
+    host->prepare_run();
+    host->compile(netlist);
+    if (netlist.get_num_opaque() > 0)
+    {
+        Console::err() << "Error: Lane_Simulator - " << host->get_component_name() << " has "
+                  << netlist.get_num_opaque() << " components without a gate-level description" << std::endl;
+        return;
+    }
+
+    // Probe nets (allocated before sizing the lane arrays)
+    const bool* pc = host->get_pc_signals();
+    for (uint16_t i = 0; i < host->get_pc_bits(); ++i)
+        pc_nets.push_back(netlist.net(&pc[i]));
+    for (uint16_t addr = 0; addr < host->get_num_ram_addresses(); ++addr)
+    {
+        const bool* reg = host->get_ram_signals(addr);
+        for (uint16_t bit = 0; bit < host->get_num_bits(); ++bit)
+            ram_nets.push_back(netlist.net(&reg[bit]));
+    }
+    run_halt_net = netlist.net(host->get_run_halt_signal());
+
+    values.assign(netlist.get_num_nets(), 0);
+    previous.assign(netlist.get_num_nets(), 0);
+    power_on_state.resize(netlist.get_num_nets());
+    for (uint32_t id = 0; id < netlist.get_num_nets(); ++id)
+        power_on_state[id] = *netlist.get_signal(id);
+
+    valid = true;
+}
+
+Lane_Simulator::~Lane_Simulator()
+{
+}
+
+// ── Loading ───────────────────────────────────────────────────────────────────
+
+bool Lane_Simulator::load_program(uint16_t lane, const std::string& filename)
+{
+    if (!valid || lane >= NUM_LANES)
+        return false;
+
+    // Back to power-on state so addresses the program does not write read as zero
+    for (uint32_t id = 0; id < power_on_state.size(); ++id)
+        *netlist.get_signal(id) = power_on_state[id];
+
+    if (!host->load_program(filename))
+        return false;
+    host->prepare_run();
+    load_lane(lane);
+    return true;
+}
+
+void Lane_Simulator::load_lane(uint16_t lane)
+{
+    const uint64_t bit = uint64_t(1) << lane;
+    for (uint32_t id = 0; id < values.size(); ++id)
+    {
+        if (*netlist.get_signal(id)) values[id] |= bit;
+        else                         values[id] &= ~bit;
+    }
+    loaded_mask |= bit;
+    running_mask |= bit;
+    execution_counts[lane] = 0;
+}
+
+void Lane_Simulator::store_lane(uint16_t lane) const
+{
+    for (uint32_t id = 0; id < values.size(); ++id)
+        *netlist.get_signal(id) = lane_bit(id, lane);
+}
+
+void Lane_Simulator::unload_lane(uint16_t lane)
+{
+    const uint64_t bit = uint64_t(1) << lane;
+    loaded_mask &= ~bit;
+    running_mask &= ~bit;
+}
+
+// ── Execution ─────────────────────────────────────────────────────────────────
+
+uint64_t Lane_Simulator::step(uint64_t lane_mask)
+{
+    const uint64_t active = running_mask & lane_mask;
+    if (!valid || active == 0)
+        return running_mask;
+
+    // Lanes that must not advance are restored after the pass
+    const bool freeze = (active != ~uint64_t(0));
+    if (freeze)
+        previous = values;
+
+    netlist.evaluate_lanes(values.data());
+
+    if (freeze)
+    {
+        for (size_t id = 0; id < values.size(); ++id)
+            values[id] = (values[id] & active) | (previous[id] & ~active);
+    }
+
+    for (uint16_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        if ((active >> lane) & 1)
+            execution_counts[lane]++;
+    }
+    running_mask &= ~active | values[run_halt_net];
+    return running_mask;
+}
+
+uint64_t Lane_Simulator::run(uint64_t max_ticks)
+{
+    uint64_t ticks = 0;
+    while (running_mask != 0 && ticks < max_ticks)
+    {
+        step();
+        ++ticks;
+    }
+    return ticks;
+}
+
+// ── Per-lane queries ──────────────────────────────────────────────────────────
+
+uint16_t Lane_Simulator::get_pc(uint16_t lane) const
+{
+    uint16_t value = 0;
+    for (uint16_t i = 0; i < pc_nets.size(); ++i)
+        value |= static_cast<uint16_t>(lane_bit(pc_nets[i], lane)) << i;
+    return value;
+}
+
+uint16_t Lane_Simulator::read_ram(uint16_t lane, uint16_t address) const
+{
+    const uint16_t num_bits = host->get_num_bits();
+    if (address >= host->get_num_ram_addresses())
+        return 0;
+    uint16_t value = 0;
+    for (uint16_t bit = 0; bit < num_bits; ++bit)
+        value |= static_cast<uint16_t>(lane_bit(ram_nets[address * num_bits + bit], lane)) << bit;
+    return value;
+}
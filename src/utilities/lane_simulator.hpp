@@ -0,0 +1,116 @@
+#pragma once
+#include "netlist.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Computer;
+
+/**
+ * @brief Runs 64 independent copies of one Computer design in bit-parallel lanes.
+ *
+ * The host Computer is compiled once into a Netlist. Every net then holds a
+ * uint64_t instead of a bool: bit k is that net's value in lane k, so one
+ * pass over the gate ops (Netlist::evaluate_lanes) advances all 64 machines.
+ * Each lane has its own Program_Memory and RAM contents because those live
+ * in flip-flop nets like everything else.
+ *
+ * The host is only used as a loading / inspection surface: a lane is loaded
+ * by putting the host into the wanted state (load_program) and capturing its
+ * nets into the lane bit; store_lane() copies a lane back into the host so
+ * any existing Computer query can be used on it.
+ *
+ * Halted lanes are frozen, matching Computer::clock_tick() which does not
+ * evaluate once halted.
+ *
+ * Usage:
+ *   Computer_3bit_v1 host;
+ *   Lane_Simulator lanes(&host);
+ *   lanes.load_program(0, "a.mc");
+ *   lanes.load_program(1, "b.mc");
+ *   while (lanes.get_running_mask()) lanes.step();
+ *   uint16_t v = lanes.read_ram(1, 5);
+ */
+class Lane_Simulator
+{
+public:
+    static constexpr uint16_t NUM_LANES = 64;
+
+    /**
+     * @param host Fully wired computer; not owned, must outlive the simulator.
+     *             Its PM is re-attached to the PC (prepare_run) before compiling.
+     */
+    explicit Lane_Simulator(Computer* host);
+    ~Lane_Simulator();
+
+    Lane_Simulator(const Lane_Simulator&) = delete;
+    Lane_Simulator& operator=(const Lane_Simulator&) = delete;
+
+    /** @brief False if the host could not be compiled without opaque ops. */
+    bool is_valid() const { return valid; }
+
+    // ── Loading ───────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Reset the host to its power-on state, load a program into it and
+     *        capture the result into `lane`. The lane starts running at PC 0.
+     */
+    bool load_program(uint16_t lane, const std::string& filename);
+
+    /** @brief Capture the host's current net values into `lane` and mark it running. */
+    void load_lane(uint16_t lane);
+
+    /** @brief Copy `lane` back into the host's signals (for inspection). */
+    void store_lane(uint16_t lane) const;
+
+    /** @brief Remove a lane from the run set (its state is kept). */
+    void unload_lane(uint16_t lane);
+
+    // ── Execution ─────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Advance every running lane in `lane_mask` by one clock cycle.
+     * @return Mask of lanes still running afterwards.
+     */
+    uint64_t step(uint64_t lane_mask = ~uint64_t(0));
+
+    /**
+     * @brief Step until every lane has halted or `max_ticks` steps were taken.
+     * @return Number of steps taken.
+     */
+    uint64_t run(uint64_t max_ticks);
+
+    // ── Per-lane queries ──────────────────────────────────────────────────────
+
+    uint64_t get_loaded_mask() const { return loaded_mask; }
+    uint64_t get_running_mask() const { return running_mask; }
+    bool is_running(uint16_t lane) const { return (running_mask >> lane) & 1; }
+    uint64_t get_execution_count(uint16_t lane) const { return execution_counts[lane]; }
+
+    /** @brief Program counter of `lane` (PC register contents). */
+    uint16_t get_pc(uint16_t lane) const;
+
+    /** @brief RAM value at a full address in `lane`. */
+    uint16_t read_ram(uint16_t lane, uint16_t address) const;
+
+    const Netlist& get_netlist() const { return netlist; }
+
+private:
+    bool lane_bit(uint32_t net_id, uint16_t lane) const { return (values[net_id] >> lane) & 1; }
+
+    Computer*             host;
+    Netlist               netlist;
+    bool                  valid = false;
+
+    std::vector<uint64_t> values;         ///< net ID -> 64 lane values
+    std::vector<uint64_t> previous;       ///< scratch copy used to freeze halted lanes
+    std::vector<bool>     power_on_state; ///< host net values right after construction
+
+    std::vector<uint32_t> pc_nets;        ///< PC register bits
+    std::vector<uint32_t> ram_nets;       ///< [address * num_bits + bit]
+    uint32_t              run_halt_net = 0;
+
+    uint64_t              loaded_mask = 0;
+    uint64_t              running_mask = 0;
+    uint64_t              execution_counts[NUM_LANES] = {};
+};
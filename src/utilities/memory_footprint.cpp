@@ -0,0 +1,223 @@
+#include "memory_footprint.hpp"
+#include "netlist.hpp"
+#include "../components/Component.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <unordered_map>
+
+namespace
+{
+    /// Siblings of one class beyond this many are printed as one row.
+    constexpr size_t MAX_SEPARATE_SIBLINGS = 4;
+
+    const char* class_of(const Component* component)
+    {
+        return component->get_class_name() ? component->get_class_name() : "component";
+    }
+
+    bool holds_by_value(const Component* parent, const Component* child)
+    {
+        const char* begin = reinterpret_cast<const char*>(parent);
+        const char* address = reinterpret_cast<const char*>(child);
+        return address > begin && address < begin + parent->get_object_size();
+    }
+}
+
+Memory_Footprint::Memory_Footprint(Component& root)
+{
+    add_subtree(root, NO_PARENT);
+    std::unordered_map<const Component*, uint32_t> node_of;
+    for (uint32_t i = 0; i < nodes.size(); ++i)
+        node_of.emplace(nodes[i].component, i);
+
+    // Gates: the ops each compiled scope emits itself, excluding nested scopes
+    Netlist scratch;
+    scratch.set_gate_faithful(true);
+    scratch.record_scopes(true);
+    root.compile(scratch);
+    const std::vector<Netlist::Scope_Record>& records = scratch.get_scope_records();
+    std::vector<uint32_t> direct_ops(records.size());
+    for (size_t r = 0; r < records.size(); ++r)
+    {
+        direct_ops[r] += records[r].end_op - records[r].first_op;
+        if (records[r].parent != Netlist::NO_SCOPE)
+            direct_ops[records[r].parent] -= records[r].end_op - records[r].first_op;
+    }
+
+    // A component compiled more than once (RAM runs in both clock phases) counts its
+    // first compile only. A scope outside the tree counts toward its nearest owner in it.
+    std::vector<uint32_t> owner_record(records.size(), Netlist::NO_SCOPE);
+    std::vector<uint32_t> first_record(nodes.size(), Netlist::NO_SCOPE);
+    for (size_t r = 0; r < records.size(); ++r)
+    {
+        auto found = node_of.find(records[r].component);
+        if (found != node_of.end())
+            owner_record[r] = static_cast<uint32_t>(r);
+        else if (records[r].parent != Netlist::NO_SCOPE)
+            owner_record[r] = owner_record[records[r].parent];
+        if (owner_record[r] == Netlist::NO_SCOPE)
+            continue;
+
+        const uint32_t node = node_of.at(records[owner_record[r]].component);
+        if (first_record[node] == Netlist::NO_SCOPE)
+            first_record[node] = owner_record[r];
+        if (first_record[node] == owner_record[r])
+            nodes[node].own_gates += direct_ops[r];
+    }
+
+    // Children always come after their parent, so one reverse pass sums every subtree
+    for (size_t i = nodes.size(); i-- > 0;)
+    {
+        Node& node = nodes[i];
+        node.bytes += node.own_bytes;
+        node.objects += 1;
+        node.gates += node.own_gates;
+        if (node.parent != NO_PARENT)
+        {
+            Node& parent = nodes[node.parent];
+            parent.bytes += node.bytes;
+            parent.objects += node.objects;
+            parent.gates += node.gates;
+        }
+    }
+}
+
+void Memory_Footprint::add_subtree(Component& component, uint32_t parent)
+{
+    const uint32_t index = static_cast<uint32_t>(nodes.size());
+    Node node;
+    node.component = &component;
+    node.parent = parent;
+    node.own_bytes = component.get_object_size() + component.get_owned_bytes();
+    if (parent != NO_PARENT)
+    {
+        Node& parent_node = nodes[parent];
+        node.depth = parent_node.depth + 1;
+        parent_node.children.push_back(index);
+        if (holds_by_value(parent_node.component, &component))
+            parent_node.own_bytes -= component.get_object_size();
+    }
+    nodes.push_back(std::move(node));
+    component.for_each_child([this, index](Component& child) { add_subtree(child, index); });
+}
+
+std::string Memory_Footprint::get_name(uint32_t node) const
+{
+    std::vector<const Component*> path;
+    for (uint32_t i = node; i != NO_PARENT; i = nodes[i].parent)
+        path.push_back(nodes[i].component);
+    std::reverse(path.begin(), path.end());
+    return Netlist::hierarchical_name(path);
+}
+
+void Memory_Footprint::print(std::ostream& out, size_t max_depth) const
+{
+    struct Class_Totals
+    {
+        uint32_t objects = 0;
+        size_t   bytes = 0;
+        uint32_t gates = 0;
+    };
+    std::map<std::string, Class_Totals> totals;
+    for (const Node& node : nodes)
+    {
+        Class_Totals& t = totals[class_of(node.component)];
+        t.objects += 1;
+        t.bytes += node.own_bytes;
+        t.gates += node.own_gates;
+    }
+    std::vector<std::pair<std::string, Class_Totals>> rows(totals.begin(), totals.end());
+    std::sort(rows.begin(), rows.end(), [](const auto& x, const auto& y) {
+        return x.second.bytes > y.second.bytes;
+    });
+
+    const Node& root = get_root();
+    const std::ios_base::fmtflags old_flags = out.flags();
+    const char old_fill = out.fill(' ');
+    const std::streamsize old_precision = out.precision();
+    out << "\n=== Memory footprint: " << get_name(0) << " - " << root.bytes << " bytes, "
+        << root.objects << " objects, " << root.gates << " gates ===\n";
+    out << "\nPer class (own bytes):\n";
+    out << "  " << std::left << std::setw(28) << "class" << std::right
+        << std::setw(10) << "objects" << std::setw(14) << "bytes" << std::setw(10) << "gates"
+        << std::setw(9) << "%" << "\n";
+    out << std::fixed << std::setprecision(1);
+    for (const auto& row : rows)
+    {
+        double percent = root.bytes ? 100.0 * static_cast<double>(row.second.bytes) / root.bytes : 0.0;
+        out << "  " << std::left << std::setw(28) << row.first << std::right
+            << std::setw(10) << row.second.objects
+            << std::setw(14) << row.second.bytes
+            << std::setw(10) << row.second.gates
+            << std::setw(8) << percent << "%\n";
+    }
+
+    out << "\nHierarchy (bytes, objects, gates):\n";
+    Group top;
+    top.members.push_back(0);
+    top.bytes = root.bytes;
+    top.objects = root.objects;
+    top.gates = root.gates;
+    print_group(out, top, 0, max_depth);
+    out.flags(old_flags);
+    out.fill(old_fill);
+    out.precision(old_precision);
+}
+
+void Memory_Footprint::print_group(std::ostream& out, const Group& group, size_t depth, size_t max_depth) const
+{
+    out << "  " << std::string(2 * depth, ' ') << group_label(group)
+        << "  " << group.bytes << ", " << group.objects << ", " << group.gates << "\n";
+    if (max_depth > 0 && depth + 1 >= max_depth)
+        return;
+
+    // Children of every member, grouped by class
+    std::map<std::string, std::vector<uint32_t>> by_class;
+    for (uint32_t member : group.members)
+    {
+        for (uint32_t child : nodes[member].children)
+            by_class[class_of(nodes[child].component)].push_back(child);
+    }
+    std::vector<Group> children;
+    for (const auto& entry : by_class)
+    {
+        if (entry.second.size() > MAX_SEPARATE_SIBLINGS)
+        {
+            children.emplace_back();
+            children.back().members = entry.second;
+        }
+        else
+        {
+            for (uint32_t child : entry.second)
+            {
+                children.emplace_back();
+                children.back().members.push_back(child);
+            }
+        }
+    }
+    for (Group& child : children)
+    {
+        for (uint32_t member : child.members)
+        {
+            child.bytes += nodes[member].bytes;
+            child.objects += nodes[member].objects;
+            child.gates += nodes[member].gates;
+        }
+    }
+    std::stable_sort(children.begin(), children.end(), [](const Group& x, const Group& y) {
+        return x.bytes > y.bytes;
+    });
+    for (const Group& child : children)
+        print_group(out, child, depth + 1, max_depth);
+}
+
+std::string Memory_Footprint::group_label(const Group& group) const
+{
+    const Component* first = nodes[group.members.front()].component;
+    if (group.members.size() > 1)
+        return std::string(class_of(first)) + " x" + std::to_string(group.members.size());
+    std::string given = first->get_given_name();
+    return given.empty() ? std::string(class_of(first)) : given;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class Component;
+
+/**
+ * @brief Per-component memory, object and gate counts for a component tree.
+ *
+ * The tree is the ownership tree Component::for_each_child() walks, so
+ * every component the root owns is a node, including the parts a normal
+ * compile() skips (the memories' read decoders, read selects and buses).
+ *
+ * For each node:
+ *   - own bytes:  Component::get_object_size() plus get_owned_bytes() (IO
+ *                 arrays, name string, vectors, pointer arrays). A child
+ *                 held by value lies inside its parent's object, so its
+ *                 size is moved from the parent to the child.
+ *   - bytes:      own bytes summed over the subtree
+ *   - objects:    components in the subtree, this one included
+ *   - gates:      ops the subtree emits into a gate-faithful netlist (see
+ *                 Netlist::set_gate_faithful) on its first compile, i.e. the
+ *                 gates it is built from rather than the ops run per tick
+ *
+ * Allocator headers and arena slack are not included; compare
+ * get_root().bytes with Signal_Arena::print_summary() for those.
+ *
+ * Usage:
+ *   Memory_Footprint footprint(computer);
+ *   footprint.print(std::cout, 4);
+ */
+class Memory_Footprint
+{
+public:
+    static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+    struct Node
+    {
+        const Component* component = nullptr;
+        uint32_t parent = NO_PARENT;    ///< index in get_nodes(), NO_PARENT for the root
+        uint32_t depth = 0;
+        size_t   own_bytes = 0;
+        size_t   bytes = 0;             ///< own_bytes over the subtree
+        uint32_t objects = 0;           ///< components in the subtree
+        uint32_t own_gates = 0;         ///< ops emitted directly by this component
+        uint32_t gates = 0;             ///< own_gates over the subtree
+        std::vector<uint32_t> children;
+    };
+
+    /**
+     * @brief Measures `root` and every component it owns.
+     *
+     * Gates are counted by compiling `root` into a scratch netlist. That only
+     * reads the wiring, but it does refresh each compiled component's
+     * inputs-verified flag (see Netlist::Scope).
+     */
+    explicit Memory_Footprint(Component& root);
+
+    /** @brief Nodes in depth-first order (parents before children); nodes[0] is the root. */
+    const std::vector<Node>& get_nodes() const { return nodes; }
+    const Node& get_root() const { return nodes.front(); }
+
+    /** @brief "computer/program_memory/register_0_addr_5_in_program_memory" for a node. */
+    std::string get_name(uint32_t node) const;
+
+    /**
+     * @brief Print a per-class summary (sorted by bytes) and the hierarchy.
+     *
+     * In the hierarchy, siblings are sorted by bytes and siblings of one
+     * class are merged into a single "Class x count" row once there are
+     * more than a few of them, so e.g. Program_Memory shows one row for
+     * its registers; their children are merged the same way beneath it.
+     *
+     * @param max_depth Limit on hierarchy depth (0 = all)
+     */
+    void print(std::ostream& out, size_t max_depth = 0) const;
+
+private:
+    /// Siblings listed under one row of the hierarchy.
+    struct Group
+    {
+        std::vector<uint32_t> members;
+        size_t   bytes = 0;
+        uint32_t objects = 0;
+        uint32_t gates = 0;
+    };
+
+    /// Append `component` and its subtree under node `parent`.
+    void add_subtree(Component& component, uint32_t parent);
+    void print_group(std::ostream& out, const Group& group, size_t depth, size_t max_depth) const;
+    std::string group_label(const Group& group) const;
+
+    std::vector<Node> nodes;
+};
@@ -0,0 +1,603 @@
+#include "netlist.hpp"
+#include "console.hpp"
+#include "../components/Component.hpp"
+#include <algorithm>
+#include <iostream>
+
+Netlist::Netlist()
+{
+    // Net 0 is always the shared constant-low net used for unconnected inputs
+    net(nullptr);
+}
+
+Netlist::~Netlist()
+{
+}
+
+// ── Connectivity check ────────────────────────────────────────────────────────
+
+Netlist::Scope::Scope(Netlist& netlist_, Component* component)
+    : netlist(netlist_), dangling(false), record(NO_SCOPE)
+{
+    netlist.component_path.push_back(component);
+    if (netlist.recording_scopes)
+    {
+        const uint32_t num_ops = static_cast<uint32_t>(netlist.ops.size());
+        record = static_cast<uint32_t>(netlist.scope_records.size());
+        netlist.scope_records.push_back({ component, netlist.open_record, num_ops, num_ops });
+        netlist.open_record = record;
+    }
+    for (uint16_t i = 0; i < component->get_num_inputs(); ++i)
+    {
+        if (component->is_input_connected(i))
+            continue;
+        // Inside a component that is already missing an input, this is only a consequence
+        if (netlist.dangling_scopes == 0)
+            netlist.dangling_inputs.push_back({ netlist.component_path, i });
+        dangling = true;
+    }
+    if (dangling)
+        ++netlist.dangling_scopes;
+    component->set_inputs_verified(!dangling);
+}
+
+Netlist::Scope::~Scope()
+{
+    netlist.component_path.pop_back();
+    if (dangling)
+        --netlist.dangling_scopes;
+    if (record != NO_SCOPE)
+    {
+        netlist.scope_records[record].end_op = static_cast<uint32_t>(netlist.ops.size());
+        netlist.open_record = netlist.scope_records[record].parent;
+    }
+}
+
+std::string Netlist::hierarchical_name(const std::vector<const Component*>& path)
+{
+    std::string name;
+    for (const Component* component : path)
+    {
+        std::string given = component->get_given_name();
+        if (!name.empty())
+            name += '/';
+        if (!given.empty())
+            name += given;
+        else if (component->get_class_name())
+            name += component->get_class_name();
+        else
+            name += "component";
+    }
+    return name;
+}
+
+// ── Construction ──────────────────────────────────────────────────────────────
+
+uint32_t Netlist::net(const bool* signal)
+{
+    if (signal == nullptr)
+        signal = &constant_low;
+
+    auto it = net_ids.find(signal);
+    if (it != net_ids.end())
+        return it->second;
+
+    uint32_t id = static_cast<uint32_t>(nets.size());
+    nets.push_back(const_cast<bool*>(signal));
+    net_ids.emplace(signal, id);
+    return id;
+}
+
+const bool* Netlist::scratch_signal()
+{
+    scratch.push_back(false);
+    const bool* signal = &scratch.back();
+    net(signal);
+    return signal;
+}
+
+void Netlist::emit(Op_Type type, const bool* const* inputs, uint16_t num_inputs, const bool* output)
+{
+    Op op;
+    op.type = type;
+    op.num_inputs = num_inputs;
+    op.first_input = static_cast<uint32_t>(op_inputs.size());
+    op.output = net(output);
+    for (uint16_t i = 0; i < num_inputs; ++i)
+    {
+        op_inputs.push_back(net(inputs[i]));
+    }
+    ops.push_back(op);
+    events_ready = false;
+}
+
+void Netlist::emit(Op_Type type, std::initializer_list<const bool*> inputs, const bool* output)
+{
+    emit(type, inputs.begin(), static_cast<uint16_t>(inputs.size()), output);
+}
+
+void Netlist::emit_const(const bool* output, bool value)
+{
+    emit(value ? Op_Type::CONST1 : Op_Type::CONST0, nullptr, 0, output);
+}
+
+void Netlist::emit_buffer(const bool* src, const bool* output)
+{
+    emit(Op_Type::BUF, &src, 1, output);
+}
+
+void Netlist::emit_priority_select(const std::vector<const bool*>& enables,
+                                   const std::vector<std::vector<const bool*>>& values,
+                                   const bool* outputs, uint16_t num_bits)
+{
+    // select[k] = enable[k] AND NOT(any earlier enable)
+    std::vector<const bool*> selects;
+    const bool* earlier = nullptr;  // OR of enables seen so far (nullptr = none yet)
+    for (size_t k = 0; k < enables.size(); ++k)
+    {
+        if (earlier == nullptr)
+        {
+            selects.push_back(enables[k]);
+            earlier = enables[k];
+            continue;
+        }
+        const bool* not_earlier = scratch_signal();
+        emit(Op_Type::NOT, { earlier }, not_earlier);
+        const bool* select = scratch_signal();
+        emit(Op_Type::AND, { enables[k], not_earlier }, select);
+        selects.push_back(select);
+
+        const bool* any = scratch_signal();
+        emit(Op_Type::OR, { earlier, enables[k] }, any);
+        earlier = any;
+    }
+
+    // output[bit] = OR_k (select[k] AND values[k][bit])
+    std::vector<const bool*> pairs;
+    for (uint16_t bit = 0; bit < num_bits; ++bit)
+    {
+        pairs.clear();
+        for (size_t k = 0; k < selects.size(); ++k)
+        {
+            pairs.push_back(selects[k]);
+            pairs.push_back(values[k][bit]);
+        }
+        emit(Op_Type::AND_OR, pairs.data(), static_cast<uint16_t>(pairs.size()), &outputs[bit]);
+    }
+}
+
+void Netlist::emit_mux(const std::vector<const bool*>& select, const std::vector<const bool*>& data,
+                       const bool* output)
+{
+    std::vector<const bool*> inputs(select);
+    inputs.insert(inputs.end(), data.begin(), data.end());
+    emit(Op_Type::MUX, inputs.data(), static_cast<uint16_t>(inputs.size()), output);
+    ops.back().select_bits = static_cast<uint8_t>(select.size());
+}
+
+void Netlist::begin_guard(const bool* enable)
+{
+    // Pushed when opened, so guards stay sorted by first_op, outer before inner
+    const uint32_t first_op = static_cast<uint32_t>(ops.size());
+    open_guards.push_back(static_cast<uint32_t>(guards.size()));
+    guards.push_back({ net(enable), first_op, first_op });
+}
+
+void Netlist::end_guard()
+{
+    if (open_guards.empty())
+        return;
+    Guard& guard = guards[open_guards.back()];
+    open_guards.pop_back();
+    guard.end_op = static_cast<uint32_t>(ops.size());
+    // An empty guard holds no inner guards (they were empty too and dropped)
+    if (guard.end_op == guard.first_op)
+        guards.pop_back();
+}
+
+void Netlist::emit_opaque(Component* component)
+{
+    Op op;
+    op.type = Op_Type::OPAQUE;
+    op.num_inputs = 0;
+    op.first_input = static_cast<uint32_t>(opaque_components.size());
+    op.output = 0;
+    opaque_components.push_back(component);
+    ops.push_back(op);
+    events_ready = false;
+}
+
+// ── Scheduling ────────────────────────────────────────────────────────────────
+
+void Netlist::levelize()
+{
+    std::vector<uint32_t> write_level(nets.size(), 0);
+    std::vector<uint32_t> read_level(nets.size(), 0);
+    op_levels.assign(ops.size(), 0);
+
+    uint32_t barrier = 0;    // level of the most recent opaque op
+    uint32_t max_level = 0;
+
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        const Op& op = ops[i];
+        uint32_t level;
+        if (op.type == Op_Type::OPAQUE)
+        {
+            // Opaque components touch nets we cannot see; order them after
+            // everything before and before everything after.
+            level = max_level + 1;
+            barrier = level;
+        }
+        else
+        {
+            level = barrier + 1;
+            const uint32_t* in = &op_inputs[op.first_input];
+            for (uint16_t k = 0; k < op.num_inputs; ++k)
+                level = std::max(level, write_level[in[k]] + 1);               // read after write
+            level = std::max(level, read_level[op.output] + 1);                // write after read
+            level = std::max(level, write_level[op.output] + 1);               // write after write
+
+            for (uint16_t k = 0; k < op.num_inputs; ++k)
+                read_level[in[k]] = std::max(read_level[in[k]], level);
+            write_level[op.output] = level;
+        }
+        op_levels[i] = level;
+        max_level = std::max(max_level, level);
+    }
+    num_levels = max_level;
+}
+
+void Netlist::sort_by_level()
+{
+    if (op_levels.size() != ops.size())
+        levelize();
+
+    // Stable counting sort of ops by level
+    std::vector<uint32_t> level_start(num_levels + 2, 0);
+    for (uint32_t level : op_levels)
+        level_start[level + 1]++;
+    for (uint32_t l = 1; l < level_start.size(); ++l)
+        level_start[l] += level_start[l - 1];
+
+    std::vector<Op> sorted_ops(ops.size());
+    std::vector<uint32_t> sorted_levels(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        uint32_t slot = level_start[op_levels[i]]++;
+        sorted_ops[slot] = ops[i];
+        sorted_levels[slot] = op_levels[i];
+    }
+    ops.swap(sorted_ops);
+    op_levels.swap(sorted_levels);
+    guards.clear();  // guarded runs are no longer contiguous
+    events_ready = false;
+}
+
+// ── Execution ─────────────────────────────────────────────────────────────────
+
+/// Result of one gate op (not OPAQUE) given the net pointer table.
+static inline bool evaluate_op(const Netlist::Op& op, const uint32_t* in, bool* const* n)
+{
+    switch (op.type)
+    {
+        case Netlist::Op_Type::CONST0:
+            return false;
+        case Netlist::Op_Type::CONST1:
+            return true;
+        case Netlist::Op_Type::BUF:
+            return *n[in[0]];
+        case Netlist::Op_Type::NOT:
+            return !*n[in[0]];
+        case Netlist::Op_Type::AND:
+        case Netlist::Op_Type::NAND:
+        {
+            bool value = true;
+            for (uint16_t k = 0; k < op.num_inputs; ++k)
+            {
+                if (!*n[in[k]]) { value = false; break; }
+            }
+            return (op.type == Netlist::Op_Type::NAND) ? !value : value;
+        }
+        case Netlist::Op_Type::OR:
+        case Netlist::Op_Type::NOR:
+        {
+            bool value = false;
+            for (uint16_t k = 0; k < op.num_inputs; ++k)
+            {
+                if (*n[in[k]]) { value = true; break; }
+            }
+            return (op.type == Netlist::Op_Type::NOR) ? !value : value;
+        }
+        case Netlist::Op_Type::XOR:
+        {
+            bool value = false;
+            for (uint16_t k = 0; k < op.num_inputs; ++k)
+                value = value != *n[in[k]];
+            return value;
+        }
+        case Netlist::Op_Type::AND_OR:
+            for (uint16_t k = 0; k + 1 < op.num_inputs; k += 2)
+            {
+                if (*n[in[k]] && *n[in[k + 1]]) return true;
+            }
+            return false;
+        case Netlist::Op_Type::MUX:
+        {
+            uint32_t index = 0;
+            for (uint16_t k = 0; k < op.select_bits; ++k)
+                index |= static_cast<uint32_t>(*n[in[k]]) << k;
+            return index < static_cast<uint32_t>(op.num_inputs - op.select_bits) && *n[in[op.select_bits + index]];
+        }
+        default:
+            return false;
+    }
+}
+
+void Netlist::evaluate() const
+{
+    bool* const* n = nets.data();
+    const uint32_t* all_inputs = op_inputs.data();
+
+    const uint32_t num_ops = static_cast<uint32_t>(ops.size());
+    const Guard* guard = guards.data();
+    const Guard* guards_end = guard + guards.size();
+
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+        // Enter the guards starting here; a disabled one skips its ops and
+        // the guards nested in them, then guards starting after it are tested
+        while (guard != guards_end && guard->first_op == i)
+        {
+            const bool enabled = *n[guard->enable];
+            const uint32_t end_op = guard->end_op;
+            ++guard;
+            if (enabled)
+                continue;
+            while (guard != guards_end && guard->first_op < end_op)
+                ++guard;
+            i = end_op;
+        }
+        if (i >= num_ops)
+            break;
+        const Op& op = ops[i];
+        if (op.type == Op_Type::OPAQUE)
+        {
+            opaque_components[op.first_input]->evaluate();
+            continue;
+        }
+        *n[op.output] = evaluate_op(op, all_inputs + op.first_input, n);
+    }
+}
+
+void Netlist::evaluate_lanes(uint64_t* values) const
+{
+    const uint32_t* all_inputs = op_inputs.data();
+
+    for (const Op& op : ops)
+    {
+        const uint32_t* in = all_inputs + op.first_input;
+        uint64_t value;
+        switch (op.type)
+        {
+            case Op_Type::CONST0:
+                value = 0;
+                break;
+            case Op_Type::CONST1:
+                value = ~uint64_t(0);
+                break;
+            case Op_Type::BUF:
+                value = values[in[0]];
+                break;
+            case Op_Type::NOT:
+                value = ~values[in[0]];
+                break;
+            case Op_Type::AND:
+            case Op_Type::NAND:
+                value = ~uint64_t(0);
+                for (uint16_t k = 0; k < op.num_inputs; ++k)
+                    value &= values[in[k]];
+                if (op.type == Op_Type::NAND) value = ~value;
+                break;
+            case Op_Type::OR:
+            case Op_Type::NOR:
+                value = 0;
+                for (uint16_t k = 0; k < op.num_inputs; ++k)
+                    value |= values[in[k]];
+                if (op.type == Op_Type::NOR) value = ~value;
+                break;
+            case Op_Type::XOR:
+                value = 0;
+                for (uint16_t k = 0; k < op.num_inputs; ++k)
+                    value ^= values[in[k]];
+                break;
+            case Op_Type::AND_OR:
+                value = 0;
+                for (uint16_t k = 0; k + 1 < op.num_inputs; k += 2)
+                    value |= values[in[k]] & values[in[k + 1]];
+                break;
+            case Op_Type::MUX:
+            {
+                // Each lane may select a different input
+                const uint32_t num_data = op.num_inputs - op.select_bits;
+                value = 0;
+                for (unsigned lane = 0; lane < 64; ++lane)
+                {
+                    uint32_t index = 0;
+                    for (uint16_t k = 0; k < op.select_bits; ++k)
+                        index |= static_cast<uint32_t>((values[in[k]] >> lane) & 1) << k;
+                    if (index < num_data)
+                        value |= values[in[op.select_bits + index]] & (uint64_t(1) << lane);
+                }
+                break;
+            }
+            default:
+                continue;
+        }
+        values[op.output] = value;
+    }
+}
+
+// ── Event-driven execution ────────────────────────────────────────────────────
+
+void Netlist::prepare_events()
+{
+    const size_t num_ops = ops.size();
+    const size_t num_words = (num_ops + 63) / 64;
+
+    // Fanout lists in compressed form: count readers per net, then fill
+    fanout_start.assign(nets.size() + 1, 0);
+    for (const Op& op : ops)
+    {
+        if (op.type == Op_Type::OPAQUE) continue;
+        for (uint16_t k = 0; k < op.num_inputs; ++k)
+            fanout_start[op_inputs[op.first_input + k] + 1]++;
+    }
+    for (size_t id = 1; id < fanout_start.size(); ++id)
+        fanout_start[id] += fanout_start[id - 1];
+    fanout_ops.assign(fanout_start.back(), 0);
+    std::vector<uint32_t> fill(fanout_start.begin(), fanout_start.end() - 1);
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+        const Op& op = ops[i];
+        if (op.type == Op_Type::OPAQUE) continue;
+        for (uint16_t k = 0; k < op.num_inputs; ++k)
+            fanout_ops[fill[op_inputs[op.first_input + k]]++] = i;
+    }
+
+    // A skipped op relies on its net still holding its own last result. That
+    // only holds if every writer of the net computes the same function of the
+    // same inputs (repeated passes such as the second RAM evaluation); nets
+    // with differing writers have all of them run on every pass.
+    std::vector<int64_t> first_writer(nets.size(), -1);
+    std::vector<bool> mixed_writers(nets.size(), false);
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+        const Op& op = ops[i];
+        if (op.type == Op_Type::OPAQUE) continue;
+        int64_t& first = first_writer[op.output];
+        if (first < 0)
+        {
+            first = i;
+            continue;
+        }
+        const Op& other = ops[first];
+        bool same = other.type == op.type && other.num_inputs == op.num_inputs &&
+                    std::equal(&op_inputs[op.first_input], &op_inputs[op.first_input] + op.num_inputs,
+                               &op_inputs[other.first_input]);
+        if (!same)
+            mixed_writers[op.output] = true;
+    }
+    always_dirty.assign(num_words, 0);
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+        if (ops[i].type != Op_Type::OPAQUE && mixed_writers[ops[i].output])
+            always_dirty[i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    dirty.assign(num_words, 0);
+    shadow.resize(nets.size());
+    for (uint32_t id = 0; id < nets.size(); ++id)
+        shadow[id] = *nets[id];
+    all_dirty = true;
+    events_ready = true;
+}
+
+void Netlist::evaluate_event_driven()
+{
+    if (!opaque_components.empty())
+    {
+        // No visibility into what an opaque component changes
+        evaluate();
+        last_activity.ops_evaluated = static_cast<uint32_t>(ops.size());
+        last_activity.nets_changed = 0;
+        return;
+    }
+    if (!events_ready)
+        prepare_events();
+
+    const size_t num_ops = ops.size();
+    const size_t num_words = dirty.size();
+    if (all_dirty)
+    {
+        // Nets may have been overwritten from outside (restored checkpoint,
+        // direct RAM/PC writes); what readers see now is what was propagated
+        for (size_t net = 0; net < nets.size(); ++net)
+            shadow[net] = *nets[net];
+        for (size_t w = 0; w < num_words; ++w)
+            dirty[w] = ~uint64_t(0);
+        if (num_ops % 64 != 0)
+            dirty[num_words - 1] = (uint64_t(1) << (num_ops % 64)) - 1;
+        all_dirty = false;
+    }
+
+    bool* const* n = nets.data();
+    const uint32_t* all_inputs = op_inputs.data();
+    uint32_t ops_evaluated = 0;
+    uint32_t nets_changed = 0;
+
+    for (size_t w = 0; w < num_words; ++w)
+    {
+        uint64_t pending = dirty[w];
+        while (pending != 0)
+        {
+            const unsigned bit = static_cast<unsigned>(__builtin_ctzll(pending));
+            const uint32_t i = static_cast<uint32_t>(w * 64 + bit);
+            dirty[w] &= ~(uint64_t(1) << bit);
+
+            const Op& op = ops[i];
+            const bool value = evaluate_op(op, all_inputs + op.first_input, n);
+            *n[op.output] = value;
+            ++ops_evaluated;
+
+            if (shadow[op.output] != value)
+            {
+                // Readers later in this pass run now; earlier ones on the next pass,
+                // exactly when a full evaluate() would next observe the change.
+                shadow[op.output] = value;
+                ++nets_changed;
+                for (uint32_t f = fanout_start[op.output]; f < fanout_start[op.output + 1]; ++f)
+                {
+                    const uint32_t reader = fanout_ops[f];
+                    dirty[reader / 64] |= uint64_t(1) << (reader % 64);
+                }
+            }
+
+            pending = (bit == 63) ? 0 : dirty[w] & (~uint64_t(0) << (bit + 1));
+        }
+        dirty[w] |= always_dirty[w];
+    }
+
+    last_activity.ops_evaluated = ops_evaluated;
+    last_activity.nets_changed = nets_changed;
+}
+
+double Netlist::get_activity_factor() const
+{
+    if (nets.empty())
+        return 0.0;
+    return static_cast<double>(last_activity.nets_changed) / static_cast<double>(nets.size());
+}
+
+// ── Introspection ─────────────────────────────────────────────────────────────
+
+void Netlist::print_summary(const std::string& label) const
+{
+    static const char* type_names[] = {
+        "CONST0", "CONST1", "BUF", "NOT", "AND", "OR", "NAND", "NOR", "XOR", "AND_OR", "MUX", "OPAQUE"
+    };
+    size_t counts[12] = {};
+    for (const Op& op : ops)
+        counts[static_cast<size_t>(op.type)]++;
+
+    Console::out() << "Netlist";
+    if (!label.empty())
+        Console::out() << " (" << label << ")";
+    Console::out() << ": " << ops.size() << " ops, " << nets.size() << " nets, "
+              << num_levels << " levels, " << op_inputs.size() << " input refs" << std::endl;
+    for (size_t t = 0; t < 12; ++t)
+    {
+        if (counts[t] > 0)
+            Console::out() << "  " << type_names[t] << ": " << counts[t] << std::endl;
+    }
+}
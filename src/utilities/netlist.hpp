@@ -0,0 +1,355 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Component;
+
+/**
+ * @brief Flattened, levelized gate-level netlist of a wired component tree.
+ *
+ * A Netlist is produced by calling Component::compile() on a fully wired
+ * component (normally a Computer). Every component appends the primitive gate
+ * operations it would perform in evaluate(), in the same order, so running
+ * the op list once gives the same result as one evaluate() of the tree.
+ *
+ * Nets are identified by 32-bit integer IDs. A net ID maps to the bool that
+ * backs it (a component output, or a scratch bool owned by the Netlist for
+ * signals that have no component storage). Unconnected inputs (nullptr) are
+ * mapped to a shared constant-low net.
+ *
+ * Op semantics (inputs are read in order, output is written last):
+ *   CONST0 / CONST1 : out = 0 / 1
+ *   BUF             : out = in[0]
+ *   NOT             : out = !in[0]
+ *   AND / OR        : out = AND / OR of all inputs
+ *   NAND / NOR      : out = NOT of AND / OR of all inputs
+ *   XOR             : out = parity of all inputs
+ *   AND_OR          : out = OR over pairs (in[2k] AND in[2k+1])
+ *   MUX             : the first select_bits inputs are an index (LSB first),
+ *                     the rest are data; out = data[index], or 0 past the end
+ *   OPAQUE          : calls evaluate() on a component that has no compile()
+ *                     override (acts as a scheduling barrier)
+ *
+ * levelize() assigns every op a dependency level: one more than every earlier
+ * op it conflicts with (read after write, write after read, write after
+ * write). Ops within one level are independent of each other. The compile
+ * order is already a topological order of these levels, and it keeps each
+ * component's ops next to each other in memory, so it is the order evaluate()
+ * runs by default. sort_by_level() reorders ops level-major (stable) for
+ * callers that want to process a whole level at a time.
+ *
+ * evaluate_event_driven() runs the same op order but skips every op whose
+ * inputs have not changed since it last ran. Each net has a fanout list (the
+ * ops that read it, i.e. its downstream gates); when an op's result differs
+ * from the net's last propagated value, the ops on that list are marked
+ * dirty. Dirty flags are a bitset scanned a word at a time, so idle regions
+ * (unselected Program_Memory addresses, RAM registers that are not being
+ * written) cost one word test per 64 ops.
+ *
+ * A guard (begin_guard() / end_guard()) marks a run of ops that evaluate()
+ * skips while the guard's enable signal is low, for logic whose results
+ * nothing reads while it is disabled (a memory's write path while WE is
+ * low). Guards nest: skipping a guard skips every guard inside it, and an
+ * inner guard is only tested once its outer guards are enabled (Main_Memory
+ * guards each address's register on its write select, inside the guard on
+ * WE). Skipping is only a shortcut: the other execution modes run guarded
+ * ops as usual, and sort_by_level() drops all guards.
+ *
+ * A few compile() overrides emit a cheaper equivalent of the gates their
+ * evaluate() runs (Main_Memory and Program_Memory read each output bit
+ * with one MUX op instead of their read decoders, select gates and read
+ * buses). With set_gate_faithful() on they emit those gates instead, so
+ * the netlist is the machine as built: Timing_Analysis and
+ * Memory_Footprint compile this way. Both forms compute the same values.
+ *
+ * Every compile() override opens a Netlist::Scope first, so compiling also
+ * walks the component hierarchy that evaluate() reaches. Each scope checks
+ * that all inputs of its component are connected: components that pass are
+ * marked with Component::set_inputs_verified() (their gates then evaluate
+ * without per-input nullptr checks), and every unconnected input is recorded
+ * with the path of components leading to it (get_dangling_inputs()). Inputs
+ * below a component that is itself missing an input are not recorded again.
+ * With record_scopes() on, every scope is also kept as a Scope_Record, which
+ * gives the component tree and the ops each component emitted
+ * (Memory_Footprint builds its report from these). A compile() that runs in
+ * clock phases (Computer) names each one with begin_phase(); the phases
+ * partition the op list and Timing_Analysis times each separately.
+ *
+ * Usage:
+ *   Netlist netlist;
+ *   computer->compile(netlist);
+ *   netlist.levelize();   // optional: level statistics / sort_by_level()
+ *   netlist.evaluate();   // one evaluate() worth of work
+ */
+class Netlist
+{
+public:
+    enum class Op_Type : uint8_t
+    {
+        CONST0,
+        CONST1,
+        BUF,
+        NOT,
+        AND,
+        OR,
+        NAND,
+        NOR,
+        XOR,
+        AND_OR,
+        MUX,
+        OPAQUE
+    };
+
+    struct Op
+    {
+        Op_Type  type;
+        uint8_t  select_bits = 0;  ///< MUX: leading inputs that form the index
+        uint16_t num_inputs;   ///< Number of entries in op_inputs starting at first_input
+        uint32_t first_input;  ///< Index into op_inputs (or into opaque_components for OPAQUE)
+        uint32_t output;       ///< Output net ID (unused for OPAQUE)
+    };
+
+    /// Work done by the most recent evaluate_event_driven() pass.
+    struct Activity
+    {
+        uint32_t ops_evaluated = 0;  ///< Ops that were dirty and ran
+        uint32_t nets_changed = 0;   ///< Op results that differed from the previous value
+    };
+
+    /// An unconnected input found while compiling.
+    struct Dangling_Input
+    {
+        std::vector<const Component*> path;  ///< outermost compiled component first, owner of the input last
+        uint16_t input_index;
+    };
+
+    /// One Scope opened while record_scopes() was on.
+    struct Scope_Record
+    {
+        const Component* component;
+        uint32_t parent;    ///< record of the enclosing scope, NO_SCOPE at the top
+        uint32_t first_op;  ///< number of ops when the scope opened
+        uint32_t end_op;    ///< number of ops when it closed
+    };
+
+    /// A named clock phase: ops from first_op up to the next phase's first_op.
+    struct Phase
+    {
+        std::string name;
+        uint32_t    first_op;
+    };
+
+    /// Ops [first_op, end_op) that evaluate() skips while `enable` is low.
+    struct Guard
+    {
+        uint32_t enable;    ///< net ID
+        uint32_t first_op;
+        uint32_t end_op;
+    };
+
+    static constexpr uint32_t NO_SCOPE = UINT32_MAX;
+
+    /**
+     * @brief Marks one component's compile() for the connectivity check.
+     *
+     * Opened at the top of every Component::compile() override. Checks the
+     * component's inputs, records unconnected ones, and sets
+     * Component::set_inputs_verified() to whether all were connected.
+     */
+    class Scope
+    {
+    public:
+        Scope(Netlist& netlist, Component* component);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Netlist& netlist;
+        bool     dangling;
+        uint32_t record;  ///< index in scope_records, NO_SCOPE when not recording
+    };
+
+    Netlist();
+    ~Netlist();
+
+    Netlist(const Netlist&) = delete;
+    Netlist& operator=(const Netlist&) = delete;
+
+    // ── Construction (used by Component::compile overrides) ───────────────────
+
+    /** @brief Return the net ID for a signal, allocating one on first use. nullptr maps to constant low. */
+    uint32_t net(const bool* signal);
+
+    /** @brief Allocate a scratch signal owned by the Netlist (for internal nodes with no component storage). */
+    const bool* scratch_signal();
+
+    /** @brief Append a gate op reading `num_inputs` signals and writing `output`. */
+    void emit(Op_Type type, const bool* const* inputs, uint16_t num_inputs, const bool* output);
+
+    /** @brief Convenience overload for small fixed fan-in. */
+    void emit(Op_Type type, std::initializer_list<const bool*> inputs, const bool* output);
+
+    /** @brief Append out = value. */
+    void emit_const(const bool* output, bool value);
+
+    /** @brief Append out = src. */
+    void emit_buffer(const bool* src, const bool* output);
+
+    /**
+     * @brief Append a priority select: output[bit] takes values[k][bit] for the
+     *        first k whose enable is high, or 0 if no enable is high.
+     *        `outputs` is a contiguous array of num_bits signals.
+     *
+     * Mirrors the if / else-if chains used in behavioural evaluate() methods
+     * (ALU, Arithmetic_Unit, Logic_Unit). A nullptr enable is treated as low
+     * and a nullptr value bit as 0.
+     */
+    void emit_priority_select(const std::vector<const bool*>& enables,
+                              const std::vector<std::vector<const bool*>>& values,
+                              const bool* outputs, uint16_t num_bits);
+
+    /**
+     * @brief Append out = data[index], where `select` holds the index bits
+     *        (LSB first). Indices past the end of `data` read 0.
+     */
+    void emit_mux(const std::vector<const bool*>& select, const std::vector<const bool*>& data,
+                  const bool* output);
+
+    /** @brief Append an opaque call to component->evaluate(). */
+    void emit_opaque(Component* component);
+
+    /** @brief Start a new clock phase: ops emitted from here on belong to `name`. */
+    void begin_phase(const std::string& name) { phases.push_back({ name, static_cast<uint32_t>(ops.size()) }); }
+
+    /** @brief Ops emitted from here until end_guard() are skipped by evaluate() while `enable` is low. Guards nest. */
+    void begin_guard(const bool* enable);
+
+    /** @brief Close the innermost guard opened by begin_guard(). */
+    void end_guard();
+
+    // ── Scheduling and execution ──────────────────────────────────────────────
+
+    /** @brief Assign each op its dependency level (see class comment). Does not reorder. */
+    void levelize();
+
+    /** @brief Stable-sort ops level-major (dropping guards). Calls levelize() first if needed. */
+    void sort_by_level();
+
+    /** @brief Run every op once, in order, skipping guarded ops whose enable is low. */
+    void evaluate() const;
+
+    /**
+     * @brief Run every op once on 64 independent lanes.
+     *
+     * `values` is indexed by net ID; bit k of each word is the net's value in
+     * lane k. Gate ops become bitwise word ops, so one pass advances all 64
+     * lanes. The backing bools are not touched. Netlists with OPAQUE ops
+     * cannot be run this way (see get_num_opaque()).
+     */
+    void evaluate_lanes(uint64_t* values) const;
+
+    /**
+     * @brief Run, in order, only the ops whose inputs changed since they last ran.
+     *
+     * Gives the same result as evaluate() provided every change to a backing
+     * bool made outside this method is either recomputed by a dirty op (e.g.
+     * Computer::sync_pc re-evaluating Program_Memory) or announced with
+     * mark_all_dirty(). Ops on a net with several different writers (such as
+     * the two-phase ram_read_flag) always run. Netlists with OPAQUE ops fall
+     * back to a full evaluate().
+     */
+    void evaluate_event_driven();
+
+    /** @brief Make the next evaluate_event_driven() run every op (after external state changes). */
+    void mark_all_dirty() { all_dirty = true; }
+
+    /** @brief Ops run and nets changed by the last evaluate_event_driven(). */
+    const Activity& get_last_activity() const { return last_activity; }
+
+    /** @brief Fraction of nets that changed value in the last evaluate_event_driven(). */
+    double get_activity_factor() const;
+
+    // ── Introspection ─────────────────────────────────────────────────────────
+
+    size_t get_num_ops() const { return ops.size(); }
+    size_t get_num_nets() const { return nets.size(); }
+    size_t get_num_opaque() const { return opaque_components.size(); }
+    uint32_t get_num_levels() const { return num_levels; }
+    const std::vector<Op>& get_ops() const { return ops; }
+    const std::vector<uint32_t>& get_op_inputs() const { return op_inputs; }
+    const std::vector<uint32_t>& get_op_levels() const { return op_levels; }
+
+    /** @brief Return the bool backing a net ID. */
+    bool* get_signal(uint32_t net_id) const { return nets[net_id]; }
+
+    /** @brief Unconnected inputs found while compiling (see Scope). */
+    const std::vector<Dangling_Input>& get_dangling_inputs() const { return dangling_inputs; }
+
+    /** @brief Compile the gates evaluate() runs, not cheaper equivalents (off by default; see class comment). */
+    void set_gate_faithful(bool enabled) { gate_faithful = enabled; }
+    bool is_gate_faithful() const { return gate_faithful; }
+
+    /** @brief Keep a Scope_Record for every Scope opened from now on (off by default). */
+    void record_scopes(bool enabled) { recording_scopes = enabled; }
+
+    /** @brief Scopes recorded so far, in the order they opened (parents before children). */
+    const std::vector<Scope_Record>& get_scope_records() const { return scope_records; }
+
+    /** @brief Guards closed so far, in op order. */
+    const std::vector<Guard>& get_guards() const { return guards; }
+
+    /** @brief Phases named with begin_phase(), in op order (empty if none were). */
+    const std::vector<Phase>& get_phases() const { return phases; }
+
+    /**
+     * @brief "computer/pm_3bit_v1/register_0_addr_5_in_program_memory": the
+     *        given name of each component on the path (its class name if it
+     *        has none), joined with '/'.
+     */
+    static std::string hierarchical_name(const std::vector<const Component*>& path);
+
+    /** @brief Print op/net/level counts and per-type op counts. */
+    void print_summary(const std::string& label = "") const;
+
+private:
+    /// Build fanout lists, always-run mask and value shadow for evaluate_event_driven().
+    void prepare_events();
+
+    std::vector<Op>         ops;
+    std::vector<uint32_t>   op_inputs;
+    std::vector<uint32_t>   op_levels;          ///< level of ops[i] (filled by levelize())
+    std::vector<bool*>      nets;               ///< net ID -> backing bool
+    std::vector<Component*> opaque_components;
+    std::unordered_map<const bool*, uint32_t> net_ids;
+    std::deque<bool>        scratch;            ///< storage for scratch_signal() (stable addresses)
+    bool                    constant_low = false;
+    bool                    gate_faithful = false;
+    uint32_t                num_levels = 0;
+
+    // ── Connectivity check (maintained by Scope) ─────────────────────────────
+    std::vector<const Component*> component_path;  ///< components whose compile() is running
+    uint32_t                dangling_scopes = 0;  ///< open scopes with an unconnected input
+    std::vector<Dangling_Input> dangling_inputs;
+    bool                    recording_scopes = false;
+    uint32_t                open_record = NO_SCOPE;  ///< innermost recorded scope still open
+    std::vector<Scope_Record> scope_records;
+    std::vector<Phase>      phases;
+    std::vector<Guard>      guards;
+    std::vector<uint32_t>   open_guards;  ///< indices into guards not yet closed, innermost last
+
+    // ── Event-driven state (built lazily by prepare_events()) ────────────────
+    std::vector<uint32_t>   fanout_start;       ///< net ID -> first entry in fanout_ops (size nets + 1)
+    std::vector<uint32_t>   fanout_ops;         ///< op indices reading each net
+    std::vector<uint64_t>   dirty;              ///< bit i set = ops[i] must run
+    std::vector<uint64_t>   always_dirty;       ///< bit i set = ops[i] runs every pass
+    std::vector<uint8_t>    shadow;             ///< net ID -> value last propagated to its fanout
+    bool                    events_ready = false;
+    bool                    all_dirty = true;
+    Activity                last_activity;
+};
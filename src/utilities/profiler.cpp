@@ -0,0 +1,177 @@
+#include "profiler.hpp"
+#include "console.hpp"
+#include "../components/Component.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+/// Readable class name for a type (demangled where the compiler supports it).
+static const std::string& class_name(std::type_index type)
+{
+    static std::unordered_map<std::type_index, std::string> names;
+    auto it = names.find(type);
+    if (it != names.end())
+        return it->second;
+
+    std::string name = type.name();
+#ifdef __GNUG__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (status == 0 && demangled)
+        name = demangled;
+    std::free(demangled);
+#endif
+    return names.emplace(type, name).first->second;
+}
+
+static double to_ms(uint64_t ns)
+{
+    return static_cast<double>(ns) / 1e6;
+}
+
+// ── Recording ─────────────────────────────────────────────────────────────────
+
+Profiler::Node::~Node()
+{
+    for (auto& child : children)
+        delete child.second;
+}
+
+Profiler::Node& Profiler::root()
+{
+    static Node tree_root;
+    return tree_root;
+}
+
+void Profiler::Scope::begin(const Component* component)
+{
+    Node& parent = stack.empty() ? root() : *stack.back().node;
+    std::type_index type(typeid(*component));
+    Node*& node = parent.children[type];
+    if (node == nullptr)
+    {
+        node = new Node();
+        node->type = type;
+    }
+    stack.push_back({ node, Clock::now(), 0 });
+    active = true;
+}
+
+void Profiler::Scope::end()
+{
+    const Frame frame = stack.back();
+    stack.pop_back();
+    const uint64_t elapsed = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - frame.start).count());
+
+    frame.node->calls++;
+    frame.node->inclusive_ns += elapsed;
+    frame.node->self_ns += (elapsed > frame.child_ns) ? elapsed - frame.child_ns : 0;
+    if (!stack.empty())
+        stack.back().child_ns += elapsed;
+}
+
+void Profiler::reset()
+{
+    if (!stack.empty())
+    {
+        Console::err() << "Error: Profiler - reset() called inside a profiled evaluate()" << std::endl;
+        return;
+    }
+    Node& tree_root = root();
+    for (auto& child : tree_root.children)
+        delete child.second;
+    tree_root.children.clear();
+}
+
+// ── Reporting ─────────────────────────────────────────────────────────────────
+
+void Profiler::print_report(std::ostream& out, size_t max_rows, size_t max_depth)
+{
+    struct Class_Totals
+    {
+        uint64_t calls = 0;
+        uint64_t self_ns = 0;
+    };
+    std::map<std::string, Class_Totals> totals;
+    uint64_t total_ns = 0;
+
+    // Walk the tree summing per class
+    std::vector<const Node*> pending;
+    for (const auto& child : root().children)
+    {
+        pending.push_back(child.second);
+        total_ns += child.second->inclusive_ns;
+    }
+    while (!pending.empty())
+    {
+        const Node* node = pending.back();
+        pending.pop_back();
+        Class_Totals& t = totals[class_name(node->type)];
+        t.calls += node->calls;
+        t.self_ns += node->self_ns;
+        for (const auto& child : node->children)
+            pending.push_back(child.second);
+    }
+
+    std::vector<std::pair<std::string, Class_Totals>> rows(totals.begin(), totals.end());
+    std::sort(rows.begin(), rows.end(), [](const auto& x, const auto& y) {
+        return x.second.self_ns > y.second.self_ns;
+    });
+    if (max_rows > 0 && rows.size() > max_rows)
+        rows.resize(max_rows);
+
+    // Callers may have left fill/format state on the stream
+    const std::ios_base::fmtflags old_flags = out.flags();
+    const char old_fill = out.fill(' ');
+    const std::streamsize old_precision = out.precision();
+    out << "\n=== Evaluation profile: " << std::fixed << std::setprecision(3)
+        << to_ms(total_ns) << " ms total ===\n";
+    out << "\nPer class (self time):\n";
+    out << "  " << std::left << std::setw(28) << "class" << std::right
+        << std::setw(14) << "calls" << std::setw(14) << "self ms" << std::setw(9) << "%" << "\n";
+    for (const auto& row : rows)
+    {
+        double percent = total_ns ? 100.0 * static_cast<double>(row.second.self_ns) / total_ns : 0.0;
+        out << "  " << std::left << std::setw(28) << row.first << std::right
+            << std::setw(14) << row.second.calls
+            << std::setw(14) << to_ms(row.second.self_ns)
+            << std::setw(8) << std::setprecision(1) << percent << "%" << std::setprecision(3) << "\n";
+    }
+
+    out << "\nPer owner (calls, inclusive ms, self ms):\n";
+    std::vector<const Node*> top;
+    for (const auto& child : root().children)
+        top.push_back(child.second);
+    std::sort(top.begin(), top.end(), [](const Node* x, const Node* y) {
+        return x->inclusive_ns > y->inclusive_ns;
+    });
+    for (const Node* node : top)
+        print_node(out, *node, 0, max_depth);
+    out.flags(old_flags);
+    out.fill(old_fill);
+    out.precision(old_precision);
+}
+
+void Profiler::print_node(std::ostream& out, const Node& node, size_t depth, size_t max_depth)
+{
+    out << "  " << std::string(2 * depth, ' ') << class_name(node.type)
+        << "  " << node.calls << ", " << to_ms(node.inclusive_ns) << ", " << to_ms(node.self_ns) << "\n";
+    if (max_depth > 0 && depth + 1 >= max_depth)
+        return;
+
+    std::vector<const Node*> children;
+    for (const auto& child : node.children)
+        children.push_back(child.second);
+    std::sort(children.begin(), children.end(), [](const Node* x, const Node* y) {
+        return x->inclusive_ns > y->inclusive_ns;
+    });
+    for (const Node* child : children)
+        print_node(out, *child, depth + 1, max_depth);
+}
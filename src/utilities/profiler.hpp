@@ -0,0 +1,100 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+class Component;
+
+/**
+ * @brief Runtime-switchable profiler for component evaluate() calls.
+ *
+ * Every evaluate() override opens a Profiler::Scope on entry. While the
+ * profiler is off the scope is a single branch on a static flag. While it is
+ * on, each call is timed and recorded in a call tree keyed by component
+ * class: the path from the root to a node is the chain of owner classes,
+ * e.g. Computer_3bit_v1 > Program_Memory > Decoder > AND_Gate. Each node
+ * accumulates call count, inclusive time and self time (inclusive minus
+ * time spent in nested evaluate() calls).
+ *
+ * The report lists both a per-class summary (summed over every place the
+ * class appears) and the per-owner tree, sorted by time. Timing overhead
+ * (two clock reads per call) is included in the numbers and dominates for
+ * single gates, so compare classes by call count as well as by time.
+ *
+ * Usage:
+ *   Profiler::set_enabled(true);
+ *   computer.clock_tick();
+ *   Profiler::print_report(std::cout);
+ */
+class Profiler
+{
+public:
+    /// RAII timer for one evaluate() call.
+    class Scope
+    {
+    public:
+        explicit Scope(const Component* component)
+        {
+            if (enabled)
+                begin(component);
+        }
+        ~Scope()
+        {
+            if (active)
+                end();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        void begin(const Component* component);
+        void end();
+
+        bool active = false;
+    };
+
+    /** @brief Turn recording on or off (off by default). */
+    static void set_enabled(bool on) { enabled = on; }
+    static bool is_enabled() { return enabled; }
+
+    /** @brief Discard everything recorded so far. */
+    static void reset();
+
+    /**
+     * @brief Print the per-class summary (sorted by self time) and the
+     *        per-owner tree (siblings sorted by inclusive time).
+     * @param max_rows Limit on rows in the per-class summary (0 = all)
+     * @param max_depth Limit on owner-tree depth (0 = all)
+     */
+    static void print_report(std::ostream& out, size_t max_rows = 0, size_t max_depth = 0);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Node
+    {
+        std::type_index type = typeid(void);
+        uint64_t calls = 0;
+        uint64_t inclusive_ns = 0;
+        uint64_t self_ns = 0;
+        std::unordered_map<std::type_index, Node*> children;
+        ~Node();
+    };
+
+    struct Frame
+    {
+        Node* node;
+        Clock::time_point start;
+        uint64_t child_ns;
+    };
+
+    static Node& root();
+    static void print_node(std::ostream& out, const Node& node, size_t depth, size_t max_depth);
+
+    static inline bool enabled = false;
+    static inline std::vector<Frame> stack;
+};
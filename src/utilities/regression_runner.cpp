@@ -0,0 +1,191 @@
+#include "regression_runner.hpp"
+#include "console.hpp"
+#include "profiler.hpp"
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+Regression_Runner::Regression_Runner(uint16_t num_jobs_, uint32_t check_interval_)
+    : num_jobs(std::max<uint16_t>(num_jobs_, 1)), check_interval(check_interval_)
+{
+}
+
+// ── Running ───────────────────────────────────────────────────────────────────
+
+Regression_Runner::Result Regression_Runner::run(const std::string& mc_file) const
+{
+    Result result;
+    result.file = mc_file;
+
+    std::ostringstream output;
+    auto start = std::chrono::steady_clock::now();
+    {
+        Console::Scope buffered(output);
+        Evaluator evaluator;
+        result.passed = check_interval > 0
+                      ? evaluator.evaluate_checkpointed(mc_file, check_interval)
+                      : evaluator.evaluate(mc_file, false);
+        result.summary = evaluator.summary();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.output = output.str();
+    return result;
+}
+
+std::vector<Regression_Runner::Result> Regression_Runner::run_all(const std::vector<std::string>& mc_files) const
+{
+    std::vector<Result> results(mc_files.size());
+    // The Profiler's call stack is process-wide, so profiled runs stay on
+    // the calling thread (as the PM/RAM bank split does)
+    const uint16_t max_jobs = Profiler::is_enabled() ? 1 : num_jobs;
+    const uint16_t num_threads = static_cast<uint16_t>(std::min<size_t>(max_jobs, std::max<size_t>(mc_files.size(), 1)));
+    Worker_Pool pool(num_threads);
+    pool.run(mc_files.size(), [&](size_t job) { results[job] = run(mc_files[job]); });
+    return results;
+}
+
+Evaluator::Summary Regression_Runner::combine(const std::vector<Result>& results)
+{
+    Evaluator::Summary total;
+    for (const Result& r : results)
+    {
+        total.passed += r.summary.passed;
+        total.failed += r.summary.failed;
+        total.total  += r.summary.total;
+        if (!r.passed && r.summary.failures.empty())
+            total.failures.push_back(r.file + ": did not run");
+        for (const std::string& failure : r.summary.failures)
+            total.failures.push_back(r.file + ": " + failure);
+    }
+    return total;
+}
+
+std::vector<std::string> Regression_Runner::find_programs(const std::string& directory)
+{
+    std::vector<std::string> files;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".mc")
+            files.push_back(entry.path().string());
+    }
+    if (error)
+        Console::err() << "Error: Regression_Runner - could not read " << directory << std::endl;
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+// ── Output ────────────────────────────────────────────────────────────────────
+
+static std::string json_string(const std::string& text)
+{
+    std::ostringstream quoted;
+    quoted << '"';
+    for (unsigned char c : text)
+    {
+        if (c == '"' || c == '\\')
+            quoted << '\\' << c;
+        else if (c == '\n')
+            quoted << "\\n";
+        else if (c < 0x20)
+            quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+        else
+            quoted << c;
+    }
+    quoted << '"';
+    return quoted.str();
+}
+
+static std::string xml_escape(const std::string& text)
+{
+    std::string escaped;
+    for (unsigned char c : text)
+    {
+        switch (c)
+        {
+            case '&':  escaped += "&amp;";  break;
+            case '<':  escaped += "&lt;";   break;
+            case '>':  escaped += "&gt;";   break;
+            case '"':  escaped += "&quot;"; break;
+            case '\'': escaped += "&apos;"; break;
+            default:
+                // Control characters other than tab/newline are not valid XML 1.0
+                if (c >= 0x20 || c == '\t' || c == '\n' || c == '\r')
+                    escaped += static_cast<char>(c);
+        }
+    }
+    return escaped;
+}
+
+void Regression_Runner::write_json(std::ostream& out, const std::vector<Result>& results)
+{
+    const Evaluator::Summary total = combine(results);
+    size_t programs_passed = 0;
+    double seconds = 0.0;
+    for (const Result& r : results)
+    {
+        programs_passed += r.passed ? 1 : 0;
+        seconds += r.seconds;
+    }
+
+    out << "{\n  \"summary\": {\"programs\": " << results.size()
+        << ", \"programs_passed\": " << programs_passed
+        << ", \"steps_passed\": " << total.passed
+        << ", \"steps_failed\": " << total.failed
+        << ", \"steps_total\": " << total.total
+        << ", \"job_seconds\": " << std::setprecision(6) << seconds << "},\n"
+        << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& r = results[i];
+        out << "    {\"file\": " << json_string(r.file)
+            << ", \"passed\": " << (r.passed ? "true" : "false")
+            << ", \"steps_passed\": " << r.summary.passed
+            << ", \"steps_failed\": " << r.summary.failed
+            << ", \"steps_total\": " << r.summary.total
+            << ", \"seconds\": " << std::setprecision(6) << r.seconds
+            << ", \"failures\": [";
+        for (size_t f = 0; f < r.summary.failures.size(); ++f)
+            out << (f ? ", " : "") << json_string(r.summary.failures[f]);
+        out << "]}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+void Regression_Runner::write_junit(std::ostream& out, const std::vector<Result>& results,
+                                    const std::string& suite_name)
+{
+    size_t failures = 0;
+    double seconds = 0.0;
+    for (const Result& r : results)
+    {
+        failures += r.passed ? 0 : 1;
+        seconds += r.seconds;
+    }
+
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<testsuite name=\"" << xml_escape(suite_name) << "\" tests=\"" << results.size()
+        << "\" failures=\"" << failures << "\" errors=\"0\" time=\"" << std::setprecision(6) << seconds << "\">\n";
+    for (const Result& r : results)
+    {
+        out << "  <testcase classname=\"" << xml_escape(suite_name) << "\" name=\"" << xml_escape(r.file)
+            << "\" time=\"" << std::setprecision(6) << r.seconds << "\">\n";
+        if (!r.passed)
+        {
+            out << "    <failure message=\"" << r.summary.failed << " of " << r.summary.total
+                << " steps failed\">";
+            for (const std::string& failure : r.summary.failures)
+                out << xml_escape(failure) << "\n";
+            if (r.summary.failures.empty())
+                out << "did not run (see system-out)\n";
+            out << "</failure>\n";
+        }
+        out << "    <system-out>" << xml_escape(r.output) << "</system-out>\n"
+            << "  </testcase>\n";
+    }
+    out << "</testsuite>\n";
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "evaluator.hpp"
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Verifies many .mc programs concurrently with the Evaluator.
+ *
+ * Each program is one job on a Worker_Pool. A job owns everything it
+ * touches: its own Evaluator (and so its own Computer, Signal_Arena and
+ * ISA_Simulator) and its own output buffer, installed with a Console::Scope
+ * so the listing, step results and errors of concurrent programs never
+ * interleave. Results come back in input order whatever the job count.
+ *
+ * Computer construction and evaluation keep no global mutable state: the
+ * current Signal_Arena and Console streams are thread_local and the ISA
+ * registry is read-only. The Profiler is the exception: it is process-wide,
+ * so while it is enabled run_all() evaluates one program at a time on the
+ * calling thread.
+ *
+ * Usage:
+ *   Regression_Runner runner(4);
+ *   std::vector<Regression_Runner::Result> results =
+ *       runner.run_all(Regression_Runner::find_programs("../programs"));
+ *   Regression_Runner::write_junit(report, results);
+ */
+class Regression_Runner
+{
+public:
+    struct Result
+    {
+        std::string        file;
+        bool               passed = false;
+        Evaluator::Summary summary;         ///< per-step results of this program
+        double             seconds = 0.0;   ///< wall time of the job, load included
+        std::string        output;          ///< everything the job printed
+    };
+
+    /**
+     * @param num_jobs       Programs evaluated at once (1 = serial on the caller)
+     * @param check_interval 0 for per-tick Evaluator::evaluate(), otherwise
+     *                       Evaluator::evaluate_checkpointed() with this interval
+     */
+    explicit Regression_Runner(uint16_t num_jobs = 1, uint32_t check_interval = 0);
+
+    /** @brief Evaluate one program on the calling thread. */
+    Result run(const std::string& mc_file) const;
+
+    /** @brief Evaluate every program, num_jobs at a time (one at a time while the Profiler is enabled). */
+    std::vector<Result> run_all(const std::vector<std::string>& mc_files) const;
+
+    /**
+     * @brief Sum of all per-program summaries. Failure lines are prefixed
+     *        with the program's file name.
+     */
+    static Evaluator::Summary combine(const std::vector<Result>& results);
+
+    /** @brief All *.mc files directly inside `directory`, sorted by name. */
+    static std::vector<std::string> find_programs(const std::string& directory);
+
+    /** @brief Write the combined summary and per-program results as JSON. */
+    static void write_json(std::ostream& out, const std::vector<Result>& results);
+
+    /**
+     * @brief Write one JUnit <testsuite>, one <testcase> per program; failed
+     *        programs carry their failure lines, every program its output.
+     */
+    static void write_junit(std::ostream& out, const std::vector<Result>& results,
+                            const std::string& suite_name = "regression");
+
+private:
+    uint16_t num_jobs;
+    uint32_t check_interval;
+};
@@ -0,0 +1,132 @@
+#include "signal_arena.hpp"
+#include "console.hpp"
+#include <cstring>
+#include <iostream>
+#include <new>
+
+static thread_local Signal_Arena* current_arena = nullptr;
+
+Signal_Arena::Scope::Scope(Signal_Arena& arena) : previous(current_arena)
+{
+    current_arena = &arena;
+}
+
+Signal_Arena::Scope::~Scope()
+{
+    current_arena = previous;
+}
+
+Signal_Arena::Signal_Arena()
+{
+}
+
+Signal_Arena::~Signal_Arena()
+{
+    for (bool* block : signal_blocks)
+        delete[] block;
+    for (bool** block : pointer_blocks)
+        delete[] block;
+    for (void* block : object_blocks)
+        ::operator delete(block);
+}
+
+Signal_Arena* Signal_Arena::get_current()
+{
+    return current_arena;
+}
+
+bool* Signal_Arena::allocate_signals(uint16_t count, uint32_t& first_net)
+{
+    // A component's outputs never straddle two blocks
+    if (signals_used + count > BLOCK_SIGNALS)
+    {
+        signal_blocks.push_back(new bool[BLOCK_SIGNALS]());
+        signals_used = 0;
+    }
+    first_net = static_cast<uint32_t>(signal_blocks.size() - 1) * BLOCK_SIGNALS + signals_used;
+    bool* signals = signal_blocks.back() + signals_used;
+    signals_used += count;
+    num_signals += count;
+    return signals;
+}
+
+bool** Signal_Arena::allocate_pointers(uint16_t count)
+{
+    if (pointers_used + count > BLOCK_POINTERS)
+    {
+        pointer_blocks.push_back(new bool*[BLOCK_POINTERS]());
+        pointers_used = 0;
+    }
+    bool** pointers = pointer_blocks.back() + pointers_used;
+    pointers_used += count;
+    num_pointers += count;
+    return pointers;
+}
+
+void* Signal_Arena::allocate_object(size_t bytes)
+{
+    constexpr size_t alignment = alignof(std::max_align_t);
+    bytes = (bytes + alignment - 1) & ~(alignment - 1);
+    ++num_objects;
+    object_bytes += bytes;
+
+    if (bytes > BLOCK_OBJECT_BYTES / 4)
+    {
+        // Large arrays get their own block; the current block stays open
+        void* block = ::operator new(bytes);
+        object_blocks.push_back(block);
+        object_block_sizes.push_back(bytes);
+        return block;
+    }
+    if (objects_used + bytes > BLOCK_OBJECT_BYTES)
+    {
+        object_block = static_cast<char*>(::operator new(BLOCK_OBJECT_BYTES));
+        object_blocks.push_back(object_block);
+        object_block_sizes.push_back(BLOCK_OBJECT_BYTES);
+        objects_used = 0;
+    }
+    void* object = object_block + objects_used;
+    objects_used += bytes;
+    return object;
+}
+
+size_t Signal_Arena::get_reserved_bytes() const
+{
+    size_t object_reserved = 0;
+    for (size_t size : object_block_sizes)
+        object_reserved += size;
+    return signal_blocks.size() * BLOCK_SIGNALS * sizeof(bool) +
+           pointer_blocks.size() * BLOCK_POINTERS * sizeof(bool*) +
+           object_reserved;
+}
+
+void Signal_Arena::print_summary(const std::string& label) const
+{
+    std::ostream& out = Console::out();
+    out << "Signal_Arena" << (label.empty() ? "" : " (" + label + ")") << ":\n"
+        << "  signals:  " << num_signals << " in " << signal_blocks.size() << " blocks\n"
+        << "  pointers: " << num_pointers << " in " << pointer_blocks.size() << " blocks\n"
+        << "  objects:  " << num_objects << " (" << object_bytes << " bytes) in "
+        << object_blocks.size() << " blocks\n"
+        << "  used:     " << (num_signals * sizeof(bool) + num_pointers * sizeof(bool*) + object_bytes)
+        << " of " << get_reserved_bytes() << " bytes reserved" << std::endl;
+}
+
+// ── Snapshots ─────────────────────────────────────────────────────────────────
+
+void Signal_Arena::save_signals(std::vector<uint8_t>& out) const
+{
+    static_assert(sizeof(bool) == sizeof(uint8_t), "signals are copied bytewise");
+    out.resize(static_cast<size_t>(signal_blocks.size()) * BLOCK_SIGNALS);
+    for (size_t block = 0; block < signal_blocks.size(); ++block)
+        std::memcpy(out.data() + block * BLOCK_SIGNALS, signal_blocks[block], BLOCK_SIGNALS);
+}
+
+bool Signal_Arena::restore_signals(const std::vector<uint8_t>& in)
+{
+    if (in.size() != static_cast<size_t>(signal_blocks.size()) * BLOCK_SIGNALS)
+        return false;
+    for (size_t block = 0; block < signal_blocks.size(); ++block)
+        std::memcpy(signal_blocks[block], in.data() + block * BLOCK_SIGNALS, BLOCK_SIGNALS);
+    return true;
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Flip_Flop;
+class Register;
+
+/**
+ * @brief Block arena for component input/output storage.
+ *
+ * By default every Component allocates its own `bool[]` of outputs and
+ * `bool*[]` of input pointers on the heap, so signals of neighbouring gates
+ * end up scattered. While a Signal_Arena is active (see Scope), the
+ * allocations made by Component::initialize_IO_arrays() are carved out of
+ * large contiguous blocks instead, in construction order. Components built
+ * together (all flip-flops of a register, all registers of a memory) then
+ * sit next to each other, and the per-allocation heap overhead disappears.
+ *
+ * Every output signal gets a 32-bit net index: block * BLOCK_SIGNALS + offset.
+ * A component's outputs have consecutive indices starting at
+ * Component::get_output_net().
+ *
+ * Every Flip_Flop and Register constructed while the arena is active
+ * registers itself, so the arena also knows all storage elements of the
+ * machine, in construction order. Computer::save_state() uses those lists.
+ *
+ * Components created with `new` while the arena is active are placed in it
+ * too (Component::operator new): sub-gates, registers and their memory bits
+ * are bump-allocated from large object blocks, so siblings sit next to each
+ * other in construction order and need no per-object heap allocation.
+ * Deleting such a component runs its destructor but gives no memory back.
+ *
+ * Storage is only released when the arena is destroyed, in one pass over
+ * its blocks; components built inside it must be deleted first (Computer
+ * owns its arena and deletes its parts in its destructor body, before
+ * members are destroyed).
+ *
+ * Usage:
+ *   Signal_Arena arena;
+ *   {
+ *       Signal_Arena::Scope scope(arena);
+ *       Register* r = new Register(8);  // IO allocated from arena
+ *   }
+ */
+class Signal_Arena
+{
+public:
+    static constexpr uint32_t NO_NET = UINT32_MAX;
+    static constexpr uint32_t BLOCK_SIGNALS = 1u << 16;   ///< bools per signal block
+    static constexpr uint32_t BLOCK_POINTERS = 1u << 16;  ///< pointers per input block
+    static constexpr size_t   BLOCK_OBJECT_BYTES = size_t(1) << 20;  ///< bytes per object block
+
+    /**
+     * @brief Makes an arena the target of Component IO allocation for its lifetime.
+     * Scopes nest; the previous arena is restored on destruction.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Signal_Arena& arena);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Signal_Arena* previous;
+    };
+
+    Signal_Arena();
+    ~Signal_Arena();
+
+    Signal_Arena(const Signal_Arena&) = delete;
+    Signal_Arena& operator=(const Signal_Arena&) = delete;
+
+    /** @brief Return the arena active on this thread, or nullptr. */
+    static Signal_Arena* get_current();
+
+    /**
+     * @brief Allocate `count` consecutive signals, all low.
+     * @param first_net Receives the net index of the first signal
+     */
+    bool* allocate_signals(uint16_t count, uint32_t& first_net);
+
+    /** @brief Allocate `count` input pointers, all nullptr. */
+    bool** allocate_pointers(uint16_t count);
+
+    /**
+     * @brief Allocate `bytes` of object storage, aligned for any type.
+     *        Requests larger than a block get a block of their own.
+     */
+    void* allocate_object(size_t bytes);
+
+    /** @brief Return the signal backing a net index. */
+    bool* get_signal(uint32_t net) const
+    {
+        return signal_blocks[net / BLOCK_SIGNALS] + (net % BLOCK_SIGNALS);
+    }
+
+    /** @brief Number of signals handed out. */
+    uint32_t get_num_signals() const { return num_signals; }
+
+    /** @brief Number of input pointers handed out. */
+    size_t get_num_pointers() const { return num_pointers; }
+
+    /** @brief Number of objects placed with allocate_object(). */
+    size_t get_num_objects() const { return num_objects; }
+
+    /** @brief Bytes handed out by allocate_object() (alignment padding included). */
+    size_t get_object_bytes() const { return object_bytes; }
+
+    /** @brief Bytes reserved by all blocks. */
+    size_t get_reserved_bytes() const;
+
+    /** @brief Print signal, pointer and object counts, block counts and bytes used / reserved. */
+    void print_summary(const std::string& label = "") const;
+
+    /** @brief Record a storage element built inside this arena (Flip_Flop constructor). */
+    void register_flip_flop(Flip_Flop* flip_flop) { flip_flops.push_back(flip_flop); }
+
+    /** @brief Every Flip_Flop built inside this arena, in construction order. */
+    const std::vector<Flip_Flop*>& get_flip_flops() const { return flip_flops; }
+
+    /** @brief Record a register built inside this arena (Register constructor). */
+    void register_register(Register* reg) { registers.push_back(reg); }
+
+    /** @brief Every Register built inside this arena, in construction order. */
+    const std::vector<Register*>& get_registers() const { return registers; }
+
+    /**
+     * @brief Copy all signal blocks into `out`, one byte per signal, indexed
+     *        by net. Input pointers are wiring, not state, and are not copied.
+     */
+    void save_signals(std::vector<uint8_t>& out) const;
+
+    /**
+     * @brief Overwrite every signal from a save_signals() copy.
+     * @return false (nothing written) if the copy does not match this
+     *         arena's block layout
+     */
+    bool restore_signals(const std::vector<uint8_t>& in);
+
+private:
+    std::vector<bool*>  signal_blocks;
+    std::vector<bool**> pointer_blocks;
+    std::vector<void*>  object_blocks;
+    std::vector<size_t> object_block_sizes;          ///< bytes reserved by object_blocks[i]
+    std::vector<Flip_Flop*> flip_flops;
+    std::vector<Register*>  registers;
+    uint32_t            signals_used = BLOCK_SIGNALS;   ///< used in the last signal block
+    uint32_t            pointers_used = BLOCK_POINTERS; ///< used in the last pointer block
+    uint32_t            num_signals = 0;
+    size_t              num_pointers = 0;
+    size_t              objects_used = BLOCK_OBJECT_BYTES; ///< used in the last standard object block
+    char*               object_block = nullptr;   ///< last standard object block
+    size_t              num_objects = 0;
+    size_t              object_bytes = 0;
+};
@@ -0,0 +1,397 @@
+#include "timing_analysis.hpp"
+#include "netlist.hpp"
+#include "../components/Component.hpp"
+#include "../device_components/Flip_Flop.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+
+namespace
+{
+    constexpr int32_t  HELD = -1;          ///< settled in an earlier phase: launches nothing
+    constexpr uint32_t NONE = UINT32_MAX;
+
+    int32_t gate_delay(Netlist::Op_Type type)
+    {
+        switch (type)
+        {
+            case Netlist::Op_Type::CONST0:
+            case Netlist::Op_Type::CONST1:
+            case Netlist::Op_Type::BUF:
+            case Netlist::Op_Type::OPAQUE:
+                return 0;
+            case Netlist::Op_Type::AND_OR:
+                return 2;
+            case Netlist::Op_Type::MUX:
+                return 4;   // index decode, then AND_OR (not in gate-faithful netlists)
+            default:
+                return 1;
+        }
+    }
+
+    /// Delay from one input of `gate` to its output: a MUX's data inputs skip the index decode.
+    int32_t input_delay(const Netlist::Op& gate, uint16_t input)
+    {
+        if (gate.type == Netlist::Op_Type::MUX && input >= gate.select_bits)
+            return gate_delay(Netlist::Op_Type::AND_OR);
+        return gate_delay(gate.type);
+    }
+
+    std::string record_name(const std::vector<Netlist::Scope_Record>& records, uint32_t record)
+    {
+        std::vector<const Component*> path;
+        for (uint32_t r = record; r != Netlist::NO_SCOPE; r = records[r].parent)
+            path.push_back(records[r].component);
+        std::reverse(path.begin(), path.end());
+        return Netlist::hierarchical_name(path);
+    }
+
+    /**
+     * Settles the Flip_Flop compiled as ops [first, end): returns the latest
+     * arrival among its external inputs (the path endpoint) and sets every
+     * net it drives to 0, or HELD if no input moved. `latest_net` receives
+     * the input that arrived last.
+     */
+    template <typename Arrival_Of, typename Set_Arrival>
+    int32_t settle_storage(const Netlist& netlist, uint32_t first, uint32_t end,
+                           Arrival_Of arrival_of, Set_Arrival set_arrival, uint32_t& latest_net)
+    {
+        const std::vector<Netlist::Op>& ops = netlist.get_ops();
+        const std::vector<uint32_t>& op_inputs = netlist.get_op_inputs();
+
+        // Nets written inside the latch (its inverters and cross-coupled NANDs)
+        std::vector<uint32_t> internal;
+        for (uint32_t op = first; op < end; ++op)
+            internal.push_back(ops[op].output);
+
+        int32_t latest = HELD;
+        latest_net = NONE;
+        for (uint32_t op = first; op < end; ++op)
+        {
+            for (uint16_t i = 0; i < ops[op].num_inputs; ++i)
+            {
+                const uint32_t net = op_inputs[ops[op].first_input + i];
+                if (std::find(internal.begin(), internal.end(), net) != internal.end())
+                    continue;
+                if (arrival_of(net) > latest)
+                {
+                    latest = arrival_of(net);
+                    latest_net = net;
+                }
+            }
+        }
+        for (uint32_t net : internal)
+            set_arrival(net, latest == HELD ? HELD : 0);
+        return latest;
+    }
+}
+
+Timing_Analysis::Timing_Analysis(Component& root)
+{
+    Netlist netlist;
+    netlist.record_scopes(true);
+    netlist.set_gate_faithful(true);
+    root.compile(netlist);
+    const std::vector<Netlist::Scope_Record>& records = netlist.get_scope_records();
+    const std::vector<Netlist::Op>& ops = netlist.get_ops();
+    const std::vector<uint32_t>& op_inputs = netlist.get_op_inputs();
+    const uint32_t num_ops = static_cast<uint32_t>(ops.size());
+    const size_t num_nets = netlist.get_num_nets();
+
+    // Innermost scope and enclosing Flip_Flop of every op (children overwrite their parents)
+    std::vector<uint32_t> op_scope(num_ops, NONE);
+    std::vector<uint32_t> storage_of(num_ops, NONE);
+    std::vector<uint8_t>  has_children(records.size(), 0);
+    std::vector<uint8_t>  is_storage(records.size(), 0);
+    for (uint32_t r = 0; r < records.size(); ++r)
+    {
+        const Netlist::Scope_Record& record = records[r];
+        std::fill(op_scope.begin() + record.first_op, op_scope.begin() + record.end_op, r);
+        if (record.parent != Netlist::NO_SCOPE)
+            has_children[record.parent] = 1;
+        if (dynamic_cast<const Flip_Flop*>(record.component))
+        {
+            is_storage[r] = 1;
+            std::fill(storage_of.begin() + record.first_op, storage_of.begin() + record.end_op, r);
+        }
+    }
+    // Flip_Flop driving each net, for paths that start from storage written later in the pass
+    std::vector<uint32_t> storage_driving(num_nets, NONE);
+    for (uint32_t op = 0; op < num_ops; ++op)
+    {
+        if (storage_of[op] != NONE)
+            storage_driving[ops[op].output] = storage_of[op];
+    }
+    // Gates are reported as part of the component that holds them
+    auto owner_of = [&](uint32_t r) {
+        return (has_children[r] || records[r].parent == Netlist::NO_SCOPE) ? r : records[r].parent;
+    };
+
+    std::vector<Netlist::Phase> marks = netlist.get_phases();
+    if (marks.empty())
+        marks.push_back({ "evaluate", 0 });
+    marks.front().first_op = 0;
+
+    // ── Critical path per phase ──────────────────────────────────────────────
+    std::vector<int32_t>  arrival(num_nets, 0);
+    std::vector<uint32_t> writer(num_nets, NONE);   ///< op that last drove each net
+    std::vector<uint32_t> pred(num_ops, NONE);      ///< op that drove each op's latest input
+    std::vector<uint32_t> pred_net(num_ops, NONE);  ///< that input's net
+    std::vector<int32_t>  op_arrival(num_ops, HELD);
+    std::vector<int32_t>  op_delay(num_ops, 0);     ///< delay through that input
+    for (size_t p = 0; p < marks.size(); ++p)
+    {
+        Phase_Timing timing;
+        timing.name = marks[p].name;
+        timing.first_op = marks[p].first_op;
+        timing.end_op = (p + 1 < marks.size()) ? marks[p + 1].first_op : num_ops;
+        if (p > 0)
+            std::fill(arrival.begin(), arrival.end(), HELD);
+
+        int32_t  worst = 0;
+        uint32_t worst_op = NONE;       ///< last op of the critical path
+        uint32_t capture = NONE;        ///< Flip_Flop record it ends at, if any
+        for (uint32_t op = timing.first_op; op < timing.end_op; ++op)
+        {
+            const uint32_t storage = storage_of[op];
+            if (storage != NONE)
+            {
+                const uint32_t launch_op = records[storage].first_op;
+                uint32_t latest_net = NONE;
+                const int32_t latest = settle_storage(
+                    netlist, records[storage].first_op, records[storage].end_op,
+                    [&](uint32_t net) { return arrival[net]; }, [&](uint32_t net, int32_t at) {
+                        arrival[net] = at;
+                        writer[net] = launch_op;
+                    },
+                    latest_net);
+                // On a tie the path into the storage element is the one to report
+                if (latest > 0 && latest >= worst)
+                {
+                    worst = latest;
+                    worst_op = writer[latest_net];
+                    capture = storage;
+                }
+                op = records[storage].end_op - 1;
+                continue;
+            }
+
+            const Netlist::Op& gate = ops[op];
+            if (gate.type == Netlist::Op_Type::OPAQUE)
+            {
+                ++num_opaque;
+                continue;
+            }
+            int32_t  at = HELD;
+            uint32_t latest_net = NONE;
+            for (uint16_t i = 0; i < gate.num_inputs; ++i)
+            {
+                const uint32_t net = op_inputs[gate.first_input + i];
+                if (arrival[net] != HELD && arrival[net] + input_delay(gate, i) > at)
+                {
+                    at = arrival[net] + input_delay(gate, i);
+                    latest_net = net;
+                    op_delay[op] = input_delay(gate, i);
+                }
+            }
+            if (gate.type == Netlist::Op_Type::CONST0 || gate.type == Netlist::Op_Type::CONST1)
+                at = 0;  // a phase signal switching at the start of the phase
+            else if (at != HELD)
+            {
+                pred[op] = writer[latest_net];
+                pred_net[op] = latest_net;
+            }
+            arrival[gate.output] = at;
+            writer[gate.output] = op;
+            op_arrival[op] = at;
+            if (at > worst)
+            {
+                worst = at;
+                worst_op = op;
+                capture = NONE;
+            }
+        }
+        timing.delay = static_cast<uint32_t>(worst);
+
+        // Walk back to the storage element (or held signal) the path starts from
+        std::vector<uint32_t> chain;
+        uint32_t op = worst_op;
+        while (op != NONE && storage_of[op] == NONE)
+        {
+            chain.push_back(op);
+            op = pred[op];
+        }
+        if (op != NONE)
+            timing.launch = record_name(records, storage_of[op]);
+        else if (!chain.empty() && pred_net[chain.back()] != NONE &&
+                 storage_driving[pred_net[chain.back()]] != NONE)
+            timing.launch = record_name(records, storage_driving[pred_net[chain.back()]]);
+        if (capture != NONE)
+            timing.capture = record_name(records, capture);
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        {
+            // Buffers and constants only pass the signal along
+            if (gate_delay(ops[*it].type) == 0)
+                continue;
+            const uint32_t owner = owner_of(op_scope[*it]);
+            const std::string name = record_name(records, owner);
+            if (timing.path.empty() || timing.path.back().name != name)
+            {
+                timing.path.emplace_back();
+                timing.path.back().component = records[owner].component;
+                timing.path.back().name = name;
+            }
+            timing.path.back().gates += static_cast<uint32_t>(op_delay[*it]);
+            timing.path.back().arrival = static_cast<uint32_t>(op_arrival[*it]);
+        }
+        phases.push_back(std::move(timing));
+    }
+
+    // ── Depth of each component on its own ────────────────────────────────────
+    std::unordered_map<const Component*, uint32_t> entry_of_component;
+    std::vector<uint32_t> entry_of_record(records.size(), NONE);
+    std::vector<int32_t>  local(num_nets, 0);
+    std::vector<uint32_t> stamp(num_nets, 0);
+    uint32_t generation = 0;
+    for (uint32_t r = 0; r < records.size(); ++r)
+    {
+        const Netlist::Scope_Record& record = records[r];
+        if (!has_children[r] || is_storage[r] || entry_of_component.count(record.component))
+            continue;
+
+        // Inputs arrive at 0; nets not yet driven inside the component read as 0
+        ++generation;
+        auto arrival_of = [&](uint32_t net) { return stamp[net] == generation ? local[net] : 0; };
+        auto set_arrival = [&](uint32_t net, int32_t at) {
+            stamp[net] = generation;
+            local[net] = at;
+        };
+        int32_t depth = 0;
+        for (uint32_t op = record.first_op; op < record.end_op; ++op)
+        {
+            const uint32_t storage = storage_of[op];
+            if (storage != NONE)
+            {
+                uint32_t latest_net = NONE;
+                depth = std::max(depth, settle_storage(netlist, records[storage].first_op, records[storage].end_op,
+                                                       arrival_of, set_arrival, latest_net));
+                op = records[storage].end_op - 1;
+                continue;
+            }
+            const Netlist::Op& gate = ops[op];
+            if (gate.type == Netlist::Op_Type::OPAQUE)
+                continue;
+            int32_t latest = 0;
+            for (uint16_t i = 0; i < gate.num_inputs; ++i)
+                latest = std::max(latest, arrival_of(op_inputs[gate.first_input + i]) + input_delay(gate, i));
+            const bool constant = gate.type == Netlist::Op_Type::CONST0 || gate.type == Netlist::Op_Type::CONST1;
+            const int32_t at = constant ? 0 : latest;
+            set_arrival(gate.output, at);
+            depth = std::max(depth, at);
+        }
+
+        Component_Depth entry;
+        entry.component = record.component;
+        entry.name = record_name(records, r);
+        entry.parent = (record.parent == Netlist::NO_SCOPE) ? NONE : entry_of_record[record.parent];
+        entry.depth = static_cast<uint32_t>(depth);
+        entry_of_record[r] = static_cast<uint32_t>(depths.size());
+        entry_of_component.emplace(record.component, entry_of_record[r]);
+        depths.push_back(std::move(entry));
+    }
+}
+
+uint32_t Timing_Analysis::get_clock_period() const
+{
+    uint32_t period = 0;
+    for (const Phase_Timing& phase : phases)
+        period += phase.delay;
+    return period;
+}
+
+uint32_t Timing_Analysis::get_depth(const Component* component) const
+{
+    for (const Component_Depth& entry : depths)
+    {
+        if (entry.component == component)
+            return entry.depth;
+    }
+    return 0;
+}
+
+void Timing_Analysis::print(std::ostream& out, size_t max_rows, double gate_delay_ps) const
+{
+    const std::ios_base::fmtflags old_flags = out.flags();
+    const std::streamsize old_precision = out.precision();
+    out << "\n=== Static timing: " << (depths.empty() ? std::string("(empty)") : depths.front().name)
+        << " - gate delays between storage elements ===\n";
+
+    for (const Phase_Timing& phase : phases)
+    {
+        out << "\nPhase \"" << phase.name << "\": " << phase.delay << " gate delays\n";
+        out << "  launch   " << (phase.launch.empty() ? "signals held at the start of the phase" : phase.launch) << "\n";
+        for (const Path_Step& step : phase.path)
+            out << "  " << std::setw(6) << step.arrival << "  +" << std::left << std::setw(4) << step.gates
+                << std::right << step.name << "\n";
+        out << "  capture  " << (phase.capture.empty() ? "combinational net (held into the next phase)" : phase.capture)
+            << "\n";
+    }
+
+    const uint32_t period = get_clock_period();
+    out << "\nClock period:";
+    for (size_t p = 0; p < phases.size(); ++p)
+        out << (p == 0 ? " " : " + ") << phases[p].delay;
+    out << " = " << period << " gate delays";
+    if (period > 0 && gate_delay_ps > 0.0)
+        out << std::fixed << std::setprecision(1) << " (max " << 1e6 / (period * gate_delay_ps) << " MHz at "
+            << gate_delay_ps << " ps per gate)";
+    out << "\n";
+    out.flags(old_flags);
+    out.precision(old_precision);
+    if (num_opaque > 0)
+        out << "Note: " << num_opaque << " opaque ops (behavioural components) are not timed; "
+            << "the period is a lower bound\n";
+
+    // Deepest components; siblings of one class and depth are one row
+    struct Row
+    {
+        uint32_t first;
+        uint32_t count;
+    };
+    std::map<std::tuple<uint32_t, std::string, uint32_t>, size_t> row_of;
+    std::vector<Row> rows;
+    for (uint32_t i = 0; i < depths.size(); ++i)
+    {
+        const char* class_name = depths[i].component->get_class_name();
+        const auto key = std::make_tuple(depths[i].parent, std::string(class_name ? class_name : ""), depths[i].depth);
+        auto found = row_of.find(key);
+        if (found != row_of.end())
+        {
+            ++rows[found->second].count;
+            continue;
+        }
+        row_of.emplace(key, rows.size());
+        rows.push_back({ i, 1 });
+    }
+    std::stable_sort(rows.begin(), rows.end(), [this](const Row& x, const Row& y) {
+        return depths[x.first].depth > depths[y.first].depth;
+    });
+
+    out << "\nDeepest components (gate delays, measured on their own):\n";
+    for (size_t i = 0; i < rows.size() && (max_rows == 0 || i < max_rows); ++i)
+    {
+        const Component_Depth& entry = depths[rows[i].first];
+        out << "  " << std::setw(6) << entry.depth << "  ";
+        if (rows[i].count > 1)
+        {
+            const char* class_name = entry.component->get_class_name();
+            const std::string parent = (entry.parent == NONE) ? std::string() : depths[entry.parent].name + "/";
+            out << parent << (class_name ? class_name : "component") << " x" << rows[i].count << "\n";
+        }
+        else
+            out << entry.name << "\n";
+    }
+}
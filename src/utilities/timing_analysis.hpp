@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class Component;
+
+/**
+ * @brief Static timing of a component tree, in gate delays.
+ *
+ * The root is compiled into a scratch gate-faithful Netlist
+ * (Netlist::set_gate_faithful) with Netlist::record_scopes() on, so the
+ * memories' read decoders, select gates and read buses are timed as built
+ * rather than as the compiled evaluation's MUX shortcut. The ops are walked
+ * once in compile order (the order evaluate() runs them), giving every net
+ * the time it settles:
+ *   - NOT, AND, OR, NAND, NOR, XOR: one gate delay
+ *   - AND_OR (an AND level feeding an OR): two gate delays
+ *   - MUX: four from an index input (a decoder, then an AND_OR), two from
+ *     a data input (the AND_OR alone); only emitted by shortcuts a
+ *     gate-faithful compile replaces, so normally absent
+ *   - BUF and constants: no delay (wiring and tie-offs)
+ *   - OPAQUE (behavioural components with no gate-level compile()): not
+ *     timed; counted in get_num_opaque()
+ *
+ * Flip_Flops (the storage inside Memory_Bit and every Register) end and
+ * start paths: a Flip_Flop's Set/Reset inputs are a path endpoint, and its
+ * outputs launch new paths at time 0, so paths run between storage
+ * elements and never through a latch's feedback loop.
+ *
+ * Each clock phase named with Netlist::begin_phase() (Computer: "read",
+ * "write") is timed on its own. In the first phase every signal not yet
+ * driven (storage outputs, primary inputs) launches at 0. In a later phase
+ * signals settled in earlier phases are held: only the phase's own
+ * constants (the clock phase signal) and storage that can change launch at
+ * 0, so e.g. the write phase is timed from ram_read_flag going low rather
+ * than from the RAM address decoders, whose inputs have not moved. A root
+ * with no phases is one phase named "evaluate". The clock period is the
+ * sum of the phase delays.
+ *
+ * The critical path of each phase is reported by component: consecutive
+ * gates inside the same Device or Part are one step. Separately, every
+ * non-gate component gets its own depth: its longest input-to-output or
+ * input-to-storage path with all inputs arriving at 0 (e.g. the PC
+ * incrementer's carry chain, the RAM address Decoder).
+ *
+ * Usage:
+ *   Timing_Analysis timing(computer);
+ *   timing.print(std::cout);
+ */
+class Timing_Analysis
+{
+public:
+    /// One component's stretch of a critical path (consecutive components with one name are merged).
+    struct Path_Step
+    {
+        const Component* component = nullptr;
+        std::string name;       ///< hierarchical name
+        uint32_t    gates = 0;  ///< gate delays spent inside the component
+        uint32_t    arrival = 0;///< time the path leaves the component
+    };
+
+    struct Phase_Timing
+    {
+        std::string name;
+        uint32_t    first_op = 0;
+        uint32_t    end_op = 0;
+        uint32_t    delay = 0;      ///< critical path length in gate delays
+        std::string launch;         ///< storage element the path starts at ("" = held signals)
+        std::string capture;        ///< storage element it ends at ("" = a combinational net)
+        std::vector<Path_Step> path;
+    };
+
+    /// Depth of one Device / Part / storage cell, measured on its own.
+    struct Component_Depth
+    {
+        const Component* component = nullptr;
+        std::string name;           ///< hierarchical name
+        uint32_t    parent = 0;     ///< index of the enclosing entry (UINT32_MAX for the root)
+        uint32_t    depth = 0;
+    };
+
+    /**
+     * @brief Times `root` and everything its compile() reaches.
+     *
+     * Compiling only reads the wiring, but it does refresh each component's
+     * inputs-verified flag (see Netlist::Scope).
+     */
+    explicit Timing_Analysis(Component& root);
+
+    const std::vector<Phase_Timing>& get_phases() const { return phases; }
+
+    /** @brief Sum of the phase delays: the shortest clock period in gate delays. */
+    uint32_t get_clock_period() const;
+
+    /** @brief Every non-gate component in compile order; entry 0 is the root. */
+    const std::vector<Component_Depth>& get_depths() const { return depths; }
+
+    /** @brief Depth of `component` measured on its own (0 if it is a gate or was not reached). */
+    uint32_t get_depth(const Component* component) const;
+
+    /** @brief OPAQUE ops skipped by the analysis (non-zero means the result is a lower bound). */
+    uint32_t get_num_opaque() const { return num_opaque; }
+
+    /**
+     * @brief Print each phase's critical path, the clock period, and the
+     *        deepest components (siblings of one class and depth merged).
+     *
+     * @param max_rows      Rows of the deepest-components table
+     * @param gate_delay_ps Gate delay used to turn the period into a frequency
+     */
+    void print(std::ostream& out, size_t max_rows = 20, double gate_delay_ps = 100.0) const;
+
+private:
+    std::vector<Phase_Timing>    phases;
+    std::vector<Component_Depth> depths;
+    uint32_t num_opaque = 0;
+};
@@ -0,0 +1,72 @@
+#include "worker_pool.hpp"
+
+Worker_Pool::Worker_Pool(uint16_t num_threads)
+{
+    for (uint16_t i = 1; i < num_threads; ++i)
+        workers.emplace_back(&Worker_Pool::_worker_loop, this);
+}
+
+Worker_Pool::~Worker_Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    job_ready.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+void Worker_Pool::run(size_t num_tasks_, const std::function<void(size_t)>& task_)
+{
+    if (workers.empty() || num_tasks_ <= 1)
+    {
+        for (size_t i = 0; i < num_tasks_; ++i)
+            task_(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &task_;
+        num_tasks = num_tasks_;
+        next_task.store(0, std::memory_order_relaxed);
+        busy_workers = workers.size();
+        ++generation;
+    }
+    job_ready.notify_all();
+
+    _run_tasks();
+
+    // Barrier: the job (and the caller's stack it references) must outlive every worker's part
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [this] { return busy_workers == 0; });
+    task = nullptr;
+}
+
+void Worker_Pool::_run_tasks()
+{
+    for (size_t i = next_task.fetch_add(1); i < num_tasks; i = next_task.fetch_add(1))
+        (*task)(i);
+}
+
+void Worker_Pool::_worker_loop()
+{
+    uint64_t seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_ready.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+        }
+
+        _run_tasks();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busy_workers == 0)
+            job_done.notify_one();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Persistent fork-join thread pool for splitting one evaluate() phase.
+ *
+ * The threads are started once and then sleep between jobs, so dispatching a
+ * job costs a wake-up rather than a thread start. run() hands out task
+ * indices 0..num_tasks-1 to the workers and to the calling thread, and
+ * returns only when every task has finished; each call is therefore one
+ * phase followed by a barrier.
+ *
+ * Tasks must not touch each other's data. Which thread runs a task is not
+ * fixed, so results are deterministic only if every task writes its own
+ * slice of the output (as the memory banks do).
+ *
+ * Usage:
+ *   Worker_Pool pool(4);
+ *   pool.run(num_banks, [&](size_t bank) { evaluate_bank(bank); });
+ */
+class Worker_Pool
+{
+public:
+    /**
+     * @param num_threads Threads working on each job, including the caller
+     *                    (1 = run everything on the calling thread)
+     */
+    explicit Worker_Pool(uint16_t num_threads);
+    ~Worker_Pool();
+
+    Worker_Pool(const Worker_Pool&) = delete;
+    Worker_Pool& operator=(const Worker_Pool&) = delete;
+
+    /** @brief Threads working on each job, including the caller. */
+    uint16_t get_num_threads() const { return static_cast<uint16_t>(workers.size() + 1); }
+
+    /** @brief Run task(i) for every i < num_tasks and wait for all of them. */
+    void run(size_t num_tasks, const std::function<void(size_t)>& task);
+
+private:
+    void _worker_loop();
+    void _run_tasks();
+
+    std::vector<std::thread> workers;
+
+    std::mutex              mutex;
+    std::condition_variable job_ready;
+    std::condition_variable job_done;
+    uint64_t                generation = 0;       ///< incremented per job
+    size_t                  busy_workers = 0;     ///< workers not yet finished with the current job
+    bool                    stopping = false;
+
+    const std::function<void(size_t)>* task = nullptr;
+    size_t                  num_tasks = 0;
+    std::atomic<size_t>     next_task{0};
+};